@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
+#include "../poly_roots.h"
 
 #define MAX_ITER 100
 #define TOLERANCE 0.001
@@ -159,8 +160,26 @@ void renderButton(SDL_Renderer* renderer, TTF_Font* font, Button* btn) {
     }
 }
 
-// Draw parabola graph with axes, grid, and root marker
-void drawGraph(SDL_Renderer* renderer, double a, double b, double c, double root, int hasRoot) {
+// A ring of the given radii as one polyline: a circle at each radius,
+// stepping out one pixel between them
+void drawRing(SDL_Renderer* renderer, int cx, int cy, int inner, int outer) {
+    SDL_Point points[4 * 49];
+    int count = 0;
+    for (int r = inner; r <= outer && count + 49 <= 4 * 49; r++) {
+        for (int k = 0; k <= 48; k++) {
+            double t = k * (2 * M_PI / 48);
+            points[count].x = cx + (int)lround(r * cos(t));
+            points[count].y = cy + (int)lround(r * sin(t));
+            count++;
+        }
+    }
+    SDL_RenderDrawLines(renderer, points, count);
+}
+
+// Draw parabola graph with axes, grid, and root markers: the fixed point
+// root as a red disc, every real root polySolve found as a blue ring
+void drawGraph(SDL_Renderer* renderer, double a, double b, double c, double root, int hasRoot,
+               const double* roots, int rootCount) {
     int graphX = 930;
     int graphY = 150;
     int graphW = 400;
@@ -208,6 +227,11 @@ void drawGraph(SDL_Renderer* renderer, double a, double b, double c, double root
             }
         }
     }
+    
+    SDL_SetRenderDrawColor(renderer, 80, 180, 255, 255);
+    for (int k = 0; k < rootCount; k++) {
+        drawRing(renderer, centerX + (int)(roots[k] * scale), centerY, 10, 12);
+    }
 }
 
 int main(int argc, char* argv[]) {
@@ -266,6 +290,11 @@ int main(int argc, char* argv[]) {
     char resultText[500] = "";
     double finalRoot = 0;
     int hasValidRoot = 0;
+    
+    // All roots of ax^2 + bx + c at once, the N = 2 case of polySolve
+    double realRoots[2];
+    int realRootCount = 0;
+    char rootsText[100] = "";
     double coefA = 0, coefB = 0, coefC = 0;
     IterationRow iterations[MAX_ITER];
     int totalIterations = 0;
@@ -317,6 +346,19 @@ int main(int argc, char* argv[]) {
                     double x0 = atof(inputs[3].value);
                     int method = selectedMethod;
                     
+                    double quadratic[] = {coefA, coefB, coefC};
+                    realRootCount = polyRealRoots(quadratic, 3, realRoots);
+                    if (realRootCount < 0) {
+                        strcpy(rootsText, "Roots: the solve gave up");
+                    } else if (realRootCount == 0) {
+                        strcpy(rootsText, "Roots: no real roots");
+                    } else {
+                        int len = sprintf(rootsText, "Roots:");
+                        for (int i = 0; i < realRootCount; i++) {
+                            len += sprintf(rootsText + len, "%s x = %.6lf", i ? "," : "", realRoots[i]);
+                        }
+                    }
+                    
                     {
                         // Fixed Point Iteration Algorithm
                         double x_current = x0;
@@ -373,6 +415,8 @@ int main(int argc, char* argv[]) {
                     }
                     strcpy(resultText, "");
                     hasValidRoot = 0;
+                    realRootCount = 0;
+                    rootsText[0] = '\0';
                     totalIterations = 0;
                     tableScrollOffset = 0;
                     clearBtn.clicked = 1;
@@ -605,7 +649,11 @@ int main(int argc, char* argv[]) {
         }
         
         renderText(renderer, font, "GRAPH", 950, 110, sectionColor);
-        drawGraph(renderer, coefA, coefB, coefC, finalRoot, hasValidRoot);
+        drawGraph(renderer, coefA, coefB, coefC, finalRoot, hasValidRoot, realRoots,
+                  realRootCount > 0 ? realRootCount : 0);
+        if (rootsText[0]) {
+            renderText(renderer, fontSmall, rootsText, 950, 460, subtitleColor);
+        }
         
         SDL_RenderPresent(renderer);
         SDL_Delay(16);
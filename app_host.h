@@ -0,0 +1,552 @@
+#ifndef APP_HOST_H
+#define APP_HOST_H
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdio.h>
+#include <string.h>
+#include "solve_worker.h"
+#include "mapped_file.h"
+#include "event_log.h"
+#include "stop_criteria.h"
+#include "draw_list.h"
+#include "session_log.h"
+#include "frame_hud.h"
+
+// A standalone program is a single translation unit, so it emits the
+// embedded assets and the trace buffer itself; the suite does it in
+// methods_suite.c
+#ifndef METHODS_SUITE
+#define EMBEDDED_ASSETS_IMPLEMENTATION
+#define TRACE_EVENTS_IMPLEMENTATION
+#endif
+#include "embedded_assets.h"
+#include "trace_events.h"
+
+#define APP_HOST_MAX_FONTS 16
+#define APP_HOST_MAX_TABS 16
+#define APP_TAB_HEIGHT 32
+#define APP_TAB_WIDTH 190       // narrower when the tabs do not fit the window
+#define APP_FONT_PATH "font.ttf"
+#define APP_PRESET_FIELDS 8
+#define APP_TRACE_PATH "trace.json"      // written on exit by -DTRACE_EVENTS builds
+
+// Process-wide resources shared by the method GUIs: SDL, the window and
+// renderer, the font and its opened sizes, and the solve worker pool.
+// A standalone program creates a host without tabs and runs its one method.
+// The suite (methods_suite.c) registers every method as a tab: the active
+// tab's run function owns the main loop until a tab switch or quit, and
+// draws below a strip of tab buttons. Ctrl+Tab / Ctrl+Shift+Tab and
+// Ctrl+1..9 switch tabs from the keyboard. One tab can open another with
+// its inputs filled in (appHostOpen), e.g. the sweep opening a cell.
+// What a tab shows (inputs, results, tables) is kept in a block the host
+// holds for it (appHostTabState), so switching away and back loses nothing;
+// a solve still running when the user leaves is cancelled.
+//
+// The input of a session can be recorded and replayed (event_log.h):
+//     METHODS_RECORD=session.evl    record every event polled
+//     METHODS_REPLAY=session.evl    replay it and print frame timings
+//     METHODS_FRAME_CSV=frames.csv  with replay, also write every frame time
+//     METHODS_HEADLESS=1            no display: offscreen (or dummy) video
+//                                   driver and the software renderer
+//
+// Each tab has its own stop rules (stop_criteria.h), applied over the
+// method's defaults to every solve it starts. F6 edits them for the
+// current tab; a tab that uses them calls appHostUseStopRules once:
+//     METHODS_STOP="rel=1e-12 iter=500"   the rules every tab starts with
+//
+// Finished solves can be appended to a session log (session_log.h) that
+// the History tab reopens later. Logging is off unless asked for:
+//     METHODS_SESSION=history.mtl   log every solve there. Nothing is logged
+//                                   in a replay.
+
+typedef struct AppHost AppHost;
+typedef int (*AppRunFn)(AppHost* host);
+
+typedef struct {
+    const char* name;       // tab label
+    const char* title;      // window title
+    int width, height;      // content size the method lays itself out for
+    AppRunFn run;
+} AppTab;
+
+typedef struct {
+    int size;
+    TTF_Font* font;
+} AppFont;
+
+// Tab label rendered once per look (inactive, current) and reused every frame
+typedef struct {
+    SDL_Texture* texture[2];
+    int w, h;
+} AppTabLabel;
+
+struct AppHost {
+    SDL_Window* window;
+    SDL_Renderer* renderer;
+    DrawList draw;          // the frame's UI chrome, submitted in batches
+    SolveWorkerPool pool;
+
+    const unsigned char* fontData;  // embedded or mapped font bytes
+    size_t fontSize;
+    MappedFile fontFile;            // font.ttf, mapped when not embedded
+    int fontLoaded;
+    AppFont fonts[APP_HOST_MAX_FONTS];
+    int fontCount;
+
+    const AppTab* tabs;
+    int tabCount;
+    int current;
+    int next;               // tab requested by the user, -1 if none
+    int offsetY;            // height of the tab strip above the content
+    AppTabLabel labels[APP_HOST_MAX_TABS];
+
+    char preset[APP_PRESET_FIELDS][32];     // input values for presetTab
+    int presetCount;
+    int presetTab;          // -1 if none
+
+    void* tabState[APP_HOST_MAX_TABS];          // kept across switches, see appHostTabState
+    void (*tabStateFree[APP_HOST_MAX_TABS])(void* state);
+
+    EventLog log;           // session being recorded or replayed
+    SessionLog session;     // solve history; solves append to it from the workers
+    char stopSpecs[APP_HOST_MAX_TABS][STOP_SPEC_SIZE];  // each tab's stop rules, METHODS_STOP at first
+    int stopRules;          // the running tab applies stop rules (F6 edits them)
+    int stopEditing;
+    char stopEdit[STOP_SPEC_SIZE];
+    char stopError[64];
+};
+
+// Open (once) and return the shared font at the given point size.
+// The font bytes come from the executable (embedded_assets.h) or from
+// font.ttf mapped once, and every size is a face over those same bytes, so
+// a size costs only its FreeType face and glyph cache, and it is created
+// the first time someone asks for it. Falls back to opening the file per
+// size where neither is available.
+static inline TTF_Font* appHostFont(AppHost* host, int size) {
+    for (int i = 0; i < host->fontCount; i++) {
+        if (host->fonts[i].size == size) return host->fonts[i].font;
+    }
+    if (host->fontCount == APP_HOST_MAX_FONTS) return NULL;
+
+    if (!host->fontLoaded) {
+        host->fontLoaded = 1;
+        host->fontData = embeddedFont(&host->fontSize);
+        if (!host->fontData && mappedFileOpen(&host->fontFile, APP_FONT_PATH) == 0) {
+            host->fontData = host->fontFile.data;
+            host->fontSize = host->fontFile.size;
+        }
+    }
+
+    TTF_Font* font;
+    if (host->fontData) {
+        SDL_RWops* rw = SDL_RWFromConstMem(host->fontData, (int)host->fontSize);
+        font = rw ? TTF_OpenFontRW(rw, 1, size) : NULL;
+    } else {
+        font = TTF_OpenFont(APP_FONT_PATH, size);
+    }
+    if (!font) {
+        printf("Error loading font: %s\n", TTF_GetError());
+        return NULL;
+    }
+    host->fonts[host->fontCount].size = size;
+    host->fonts[host->fontCount].font = font;
+    host->fontCount++;
+    return font;
+}
+
+// Content area below the tab strip
+static inline void appHostApplyViewport(AppHost* host) {
+    if (host->offsetY == 0) return;
+    int w, h;
+    SDL_GetRendererOutputSize(host->renderer, &w, &h);
+    SDL_Rect viewport = {0, host->offsetY, w, h - host->offsetY};
+    SDL_RenderSetViewport(host->renderer, &viewport);
+}
+
+// Width of one tab button
+static inline int appHostTabWidth(AppHost* host) {
+    int w, h;
+    SDL_GetRendererOutputSize(host->renderer, &w, &h);
+    int width = host->tabCount > 0 ? w / host->tabCount : APP_TAB_WIDTH;
+    return width < APP_TAB_WIDTH ? width : APP_TAB_WIDTH;
+}
+
+// Where solves are logged: METHODS_SESSION; "" when off
+static inline const char* appHostSessionPath(void) {
+    const char* path = SDL_getenv("METHODS_SESSION");
+    return path ? path : "";
+}
+
+// Stop rules of the running tab (or of the standalone program); copy them
+// into a job's spec when submitting it
+static inline const char* appHostStopSpec(const AppHost* host) {
+    return host->stopSpecs[host->tabCount > 0 ? host->current : 0];
+}
+
+// State the running tab keeps while the user is on other tabs: zeroed on
+// the tab's first run, then handed back as the tab left it. release, if
+// given, frees what the state owns (tables, buffers) when the host goes.
+static inline void* appHostTabState(AppHost* host, size_t size, void (*release)(void* state)) {
+    int i = host->tabCount > 0 ? host->current : 0;
+    if (!host->tabState[i]) {
+        host->tabState[i] = calloc(1, size);
+        host->tabStateFree[i] = release;
+    }
+    return host->tabState[i];
+}
+
+// Called by a tab whose solves apply stop rules, so F6 edits them there
+static inline void appHostUseStopRules(AppHost* host) {
+    host->stopRules = 1;
+}
+
+// F6 editor: Enter applies a spec that parses, Esc leaves the rules as they were
+static inline int appHostStopEvent(AppHost* host, SDL_Event* e) {
+    if (!host->stopRules) return 0;
+    if (!host->stopEditing) {
+        if (e->type != SDL_KEYDOWN || e->key.keysym.sym != SDLK_F6) return 0;
+        host->stopEditing = 1;
+        strcpy(host->stopEdit, appHostStopSpec(host));
+        host->stopError[0] = '\0';
+        return 1;
+    }
+
+    if (e->type == SDL_TEXTINPUT) {
+        size_t len = strlen(host->stopEdit);
+        size_t add = strlen(e->text.text);
+        if (len + add < sizeof(host->stopEdit)) memcpy(host->stopEdit + len, e->text.text, add + 1);
+        return 1;
+    }
+    if (e->type == SDL_KEYDOWN) {
+        SDL_Keycode key = e->key.keysym.sym;
+        size_t len = strlen(host->stopEdit);
+        if (key == SDLK_BACKSPACE && len > 0) {
+            host->stopEdit[len - 1] = '\0';
+        } else if (key == SDLK_ESCAPE || key == SDLK_F6) {
+            host->stopEditing = 0;
+        } else if (key == SDLK_RETURN || key == SDLK_KP_ENTER) {
+            StopPolicy check;
+            memset(&check, 0, sizeof(check));
+            if (stopPolicyParse(&check, host->stopEdit)) {
+                strcpy(host->stopSpecs[host->tabCount > 0 ? host->current : 0], host->stopEdit);
+                host->stopEditing = 0;
+            } else {
+                strcpy(host->stopError, "not a stop spec");
+            }
+        }
+        return 1;
+    }
+    // Keys typed into the editor must not reach the tab's input boxes
+    return e->type == SDL_KEYUP || e->type == SDL_TEXTEDITING;
+}
+
+// Make a tab current: resize and retitle the window for it
+static inline void appHostSelect(AppHost* host, int index) {
+    const AppTab* tab = &host->tabs[index];
+    host->current = index;
+    host->next = -1;
+    host->stopRules = 0;
+    host->stopEditing = 0;
+    SDL_SetWindowTitle(host->window, tab->title);
+    SDL_SetWindowSize(host->window, tab->width, tab->height + host->offsetY);
+    appHostApplyViewport(host);
+}
+
+// Start SDL and create the shared window, renderer and pool.
+// tabs may be NULL for a standalone program. Returns 0 on success.
+static inline int appHostInit(AppHost* host, const char* title, int width, int height,
+                              const AppTab* tabs, int tabCount) {
+    memset(host, 0, sizeof(*host));
+    host->tabs = tabs;
+    host->tabCount = tabCount;
+    host->next = -1;
+    host->presetTab = -1;
+    host->offsetY = tabCount > 0 ? APP_TAB_HEIGHT : 0;
+
+    // Headless: SDL builds without the offscreen driver still have dummy
+    int headless = SDL_getenv("METHODS_HEADLESS") != NULL;
+    if (headless) SDL_SetHint(SDL_HINT_VIDEODRIVER, "offscreen");
+    int videoOk = SDL_Init(SDL_INIT_VIDEO) == 0;
+    if (!videoOk && headless) {
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+        videoOk = SDL_Init(SDL_INIT_VIDEO) == 0;
+    }
+    if (!videoOk || TTF_Init() != 0) {
+        printf("Error initializing SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    host->window = SDL_CreateWindow(title,
+        SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
+        width, height + host->offsetY, SDL_WINDOW_SHOWN);
+    Uint32 rendererFlags = headless ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED;
+    host->renderer = host->window ? SDL_CreateRenderer(host->window, -1, rendererFlags) : NULL;
+    if (!host->renderer) {
+        printf("Error creating window: %s\n", SDL_GetError());
+        return 1;
+    }
+    drawListInit(&host->draw, host->renderer);
+    TRACE_INIT(APP_TRACE_PATH);
+
+    solvePoolStart(&host->pool, 0);
+
+    const char* record = SDL_getenv("METHODS_RECORD");
+    const char* replay = SDL_getenv("METHODS_REPLAY");
+    if (replay && eventLogReplayOpen(&host->log, replay) != 0) {
+        printf("Error opening event log %s\n", replay);
+    } else if (!replay && record && eventLogRecordOpen(&host->log, record) != 0) {
+        printf("Error creating event log %s\n", record);
+    }
+
+    // Validated once here; solves then apply it with stopPolicyParse
+    const char* stop = SDL_getenv("METHODS_STOP");
+    StopPolicy check;
+    memset(&check, 0, sizeof(check));
+    if (stop && (strlen(stop) >= STOP_SPEC_SIZE || !stopPolicyParse(&check, stop))) {
+        printf("Ignoring METHODS_STOP \"%s\": expected e.g. \"rel=1e-12 &res=1e-9 stag=5 iter=200 ms=10\"\n", stop);
+    } else if (stop) {
+        for (int i = 0; i < APP_HOST_MAX_TABS; i++) strcpy(host->stopSpecs[i], stop);
+    }
+
+    // A replay (e.g. the render benchmark) leaves the history alone
+    const char* session = appHostSessionPath();
+    if (host->log.mode != EVENT_LOG_REPLAY && session[0] && sessionLogOpen(&host->session, session) != 0) {
+        printf("Error opening session log %s\n", session);
+    }
+    return 0;
+}
+
+static inline void appHostFree(AppHost* host) {
+    eventLogClose(&host->log, SDL_getenv("METHODS_FRAME_CSV"));
+    solvePoolStop(&host->pool);
+    TRACE_SHUTDOWN();
+    sessionLogClose(&host->session);
+    for (int i = 0; i < APP_HOST_MAX_TABS; i++) {
+        if (host->tabState[i] && host->tabStateFree[i]) host->tabStateFree[i](host->tabState[i]);
+        free(host->tabState[i]);
+    }
+    for (int i = 0; i < host->fontCount; i++) {
+        TTF_CloseFont(host->fonts[i].font);
+    }
+    host->fontCount = 0;
+    for (int i = 0; i < APP_HOST_MAX_TABS; i++) {
+        for (int k = 0; k < 2; k++) {
+            if (host->labels[i].texture[k]) SDL_DestroyTexture(host->labels[i].texture[k]);
+        }
+    }
+    mappedFileClose(&host->fontFile);
+    drawListFree(&host->draw);
+    if (host->renderer) SDL_DestroyRenderer(host->renderer);
+    if (host->window) SDL_DestroyWindow(host->window);
+    TTF_Quit();
+    SDL_Quit();
+}
+
+// SDL_PollEvent for the method loops: records the event, or during a
+// replay returns the logged one instead. The user's own input is then
+// ignored, apart from closing the window.
+static inline int appHostPollEvent(AppHost* host, SDL_Event* e) {
+    if (host->log.mode == EVENT_LOG_REPLAY) {
+        while (SDL_PollEvent(e)) {
+            if (e->type == SDL_QUIT) return 1;
+        }
+        return eventLogNext(&host->log, e);
+    }
+    if (!SDL_PollEvent(e)) return 0;
+    if (host->log.mode == EVENT_LOG_RECORD) eventLogWrite(&host->log, e);
+    return 1;
+}
+
+// Last call of a frame, in place of the frame pacing delay. A replay runs
+// frames back to back and times each.
+static inline void appHostEndFrame(AppHost* host) {
+    eventLogEndFrame(&host->log);
+    if (host->log.mode != EVENT_LOG_REPLAY) SDL_Delay(16);
+}
+
+// Milliseconds for animations: virtual frame time during a replay so an
+// animation advances on the same frames it did when recorded
+static inline Uint32 appHostTicks(const AppHost* host) {
+    if (host->log.mode == EVENT_LOG_REPLAY) return host->log.frame * EVENT_LOG_FRAME_MS;
+    return SDL_GetTicks();
+}
+
+// True once the user picked another tab; the running method then leaves its loop
+static inline int appHostSwitching(const AppHost* host) {
+    return host->next >= 0;
+}
+
+static inline void appHostRequest(AppHost* host, int index) {
+    if (index >= 0 && index < host->tabCount && index != host->current) {
+        host->next = index;
+    }
+}
+
+// Index of the tab with the given name, -1 if there is none
+static inline int appHostFindTab(const AppHost* host, const char* name) {
+    for (int i = 0; i < host->tabCount; i++) {
+        if (strcmp(host->tabs[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+// Switch to a tab with its input boxes filled from values.
+// Returns 0 if there is no such tab (e.g. in a standalone program).
+static inline int appHostOpen(AppHost* host, int index, const char* const* values, int count) {
+    if (index < 0 || index >= host->tabCount) return 0;
+    if (count > APP_PRESET_FIELDS) count = APP_PRESET_FIELDS;
+    for (int i = 0; i < count; i++) {
+        snprintf(host->preset[i], sizeof(host->preset[i]), "%s", values[i]);
+    }
+    host->presetCount = count;
+    host->presetTab = index;
+    appHostRequest(host, index);
+    return 1;
+}
+
+// Value handed to input i of the tab being entered; leaves value alone
+// and returns 0 if the tab was not opened with one
+static inline int appHostPreset(const AppHost* host, int i, char* value, size_t size) {
+    if (host->presetTab != host->current || i >= host->presetCount) return 0;
+    snprintf(value, size, "%s", host->preset[i]);
+    return 1;
+}
+
+// Filter an event before the method sees it: tab switches are consumed and
+// mouse coordinates are moved into the content area. Returns 1 if consumed.
+static inline int appHostEvent(AppHost* host, SDL_Event* e) {
+    if (appHostStopEvent(host, e)) return 1;
+    if (host->tabCount == 0) return 0;
+
+    if (e->type == SDL_KEYDOWN && (e->key.keysym.mod & KMOD_CTRL)) {
+        SDL_Keycode key = e->key.keysym.sym;
+        if (key == SDLK_TAB) {
+            int step = (e->key.keysym.mod & KMOD_SHIFT) ? host->tabCount - 1 : 1;
+            appHostRequest(host, (host->current + step) % host->tabCount);
+            return 1;
+        }
+        if (key >= SDLK_1 && key <= SDLK_9) {
+            appHostRequest(host, key - SDLK_1);
+            return 1;
+        }
+    }
+
+    if (e->type == SDL_WINDOWEVENT && e->window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+        appHostApplyViewport(host);     // the renderer resets it on resize
+    }
+
+    if (e->type == SDL_MOUSEBUTTONDOWN || e->type == SDL_MOUSEBUTTONUP) {
+        if (e->button.y < host->offsetY) {
+            if (e->type == SDL_MOUSEBUTTONDOWN && e->button.button == SDL_BUTTON_LEFT) {
+                appHostRequest(host, e->button.x / appHostTabWidth(host));
+            }
+            return 1;
+        }
+        e->button.y -= host->offsetY;
+    }
+    if (e->type == SDL_MOUSEMOTION) {
+        e->motion.y -= host->offsetY;
+    }
+    return 0;
+}
+
+// Label texture of tab i, current or not, rendered on first use
+static inline SDL_Texture* appHostTabLabel(AppHost* host, int i, int current) {
+    AppTabLabel* label = &host->labels[i];
+    if (label->texture[current]) return label->texture[current];
+
+    TTF_Font* font = appHostFont(host, 14);
+    if (!font) return NULL;
+    char text[48];
+    snprintf(text, sizeof(text), "%d  %s", i + 1, host->tabs[i].name);
+    SDL_Color color = current ? (SDL_Color){30, 30, 40, 255} : (SDL_Color){220, 220, 230, 255};
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, color);
+    if (!surface) return NULL;
+    label->texture[current] = hudCreateTextureFromSurface(host->renderer, surface);
+    label->w = surface->w;
+    label->h = surface->h;
+    SDL_FreeSurface(surface);
+    return label->texture[current];
+}
+
+// Stop rules along the bottom of the window: the editor while it is open,
+// otherwise the current rules if the tab has any
+static inline void appHostRenderStopRules(AppHost* host, int w, int h) {
+    const char* spec = appHostStopSpec(host);
+    if (!host->stopRules || (!host->stopEditing && !spec[0])) return;
+    TTF_Font* font = appHostFont(host, 14);
+    if (!font) return;
+
+    char text[STOP_SPEC_SIZE + 128];
+    if (host->stopEditing) {
+        snprintf(text, sizeof(text), "Stop rules: %s_   Enter applies, Esc cancels, empty for the method's own%s%s",
+                 host->stopEdit, host->stopError[0] ? "   - " : "", host->stopError);
+    } else {
+        snprintf(text, sizeof(text), "Stop rules: %s   (F6 to edit)", spec);
+    }
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, (SDL_Color){240, 240, 245, 255});
+    if (!surface) return;
+    SDL_Rect bar = {0, h - surface->h - 8, host->stopEditing ? w : surface->w + 16, surface->h + 8};
+    drawListFillRect(&host->draw, &bar, host->stopError[0] ? (SDL_Color){120, 30, 30, 235}
+                                                           : (SDL_Color){45, 45, 55, 235});
+    SDL_Rect dst = {8, bar.y + 4, surface->w, surface->h};
+    drawListTexture(&host->draw, hudCreateTextureFromSurface(host->renderer, surface), NULL, &dst, 1);
+    SDL_FreeSurface(surface);
+}
+
+// Submit the frame's draw list and draw the tab strip and the stop rules;
+// call right before SDL_RenderPresent (anything drawn after it goes
+// straight to the renderer)
+static inline void appHostRenderTabs(AppHost* host) {
+    DrawList* draw = &host->draw;
+    drawListFlush(draw);
+    if (host->tabCount == 0) {
+        if (!host->stopRules) return;
+        int w, h;
+        SDL_GetRendererOutputSize(host->renderer, &w, &h);
+        appHostRenderStopRules(host, w, h);
+        drawListFlush(draw);
+        return;
+    }
+
+    int w, h;
+    SDL_GetRendererOutputSize(host->renderer, &w, &h);
+    SDL_RenderSetViewport(host->renderer, NULL);
+    int tabWidth = appHostTabWidth(host);
+
+    SDL_Rect strip = {0, 0, w, host->offsetY};
+    drawListFillRect(draw, &strip, (SDL_Color){45, 45, 55, 255});
+
+    for (int i = 0; i < host->tabCount && i < APP_HOST_MAX_TABS; i++) {
+        SDL_Rect tab = {i * tabWidth + 2, 4, tabWidth - 4, host->offsetY - 4};
+        SDL_Color fill = i == host->current ? (SDL_Color){240, 240, 245, 255} : (SDL_Color){85, 85, 100, 255};
+        drawListFillRect(draw, &tab, fill);
+
+        SDL_Texture* texture = appHostTabLabel(host, i, i == host->current);
+        if (!texture) continue;
+        // Labels too long for a narrowed tab are cut off at its edge
+        const AppTabLabel* label = &host->labels[i];
+        SDL_Rect dst = {tab.x + 10, tab.y + (tab.h - label->h) / 2, label->w, label->h};
+        if (dst.w > tab.w - 14) dst.w = tab.w - 14;
+        SDL_Rect src = {0, 0, dst.w, dst.h};
+        drawListTexture(draw, texture, &src, &dst, 0);
+    }
+    appHostRenderStopRules(host, w, h);
+
+    drawListFlush(draw);
+    appHostApplyViewport(host);
+}
+
+// Run tabs until the user quits, starting with the given one
+static inline void appHostRun(AppHost* host, int first) {
+    appHostSelect(host, first);
+    for (;;) {
+        if (host->tabs[host->current].run(host) != 0) break;
+        if (host->presetTab == host->current) host->presetTab = -1;
+        if (!appHostSwitching(host)) break;
+        appHostSelect(host, host->next);
+    }
+}
+
+#endif
@@ -0,0 +1,17 @@
+@echo off
+rem Build from this folder: the sources and the embedded font.ttf live here
+pushd "%~dp0"
+echo Building Render Benchmark...
+gcc render_bench.c secant_method_exponential.c newton_raphson_method_exponential.c false_position_exponential_v2.0.c gui_app.c fixed_point_iteration_exponential.c Elimination_Linear_Equation.c race_mode.c sweep_mode.c poly_mode.c history_mode.c -O2 -ftree-vectorize -fno-trapping-math -DMETHODS_SUITE -I"C:\SDL2\x86_64-w64-mingw32\include\SDL2" -L"C:\SDL2\x86_64-w64-mingw32\lib" -lmingw32 -lSDL2main -lSDL2 -lSDL2_ttf -o render_bench.exe
+if %errorlevel% equ 0 (
+    echo.
+    echo [SUCCESS] render_bench.exe compiled successfully!
+    echo Run with: render_bench.exe [frames per state] [tab number]
+    echo Building and running header tests...
+    gcc header_tests.c -O2 -ftree-vectorize -fno-trapping-math -I"C:\SDL2\x86_64-w64-mingw32\include\SDL2" -L"C:\SDL2\x86_64-w64-mingw32\lib" -lmingw32 -lSDL2main -lSDL2 -o header_tests.exe && header_tests.exe
+) else (
+    echo.
+    echo [FAILED] Compilation error!
+)
+popd
+pause
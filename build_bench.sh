@@ -0,0 +1,10 @@
+#!/bin/sh
+# Render benchmark for Linux build servers (no display needed)
+echo "Building Render Benchmark..."
+# Build from this folder: the sources and the embedded font.ttf live here
+cd "$(dirname "$0")" || exit 1
+gcc render_bench.c secant_method_exponential.c newton_raphson_method_exponential.c false_position_exponential_v2.0.c gui_app.c fixed_point_iteration_exponential.c Elimination_Linear_Equation.c race_mode.c sweep_mode.c poly_mode.c history_mode.c -O2 -ftree-vectorize -fno-trapping-math -DMETHODS_SUITE $(sdl2-config --cflags) $(sdl2-config --libs) -lSDL2_ttf -lm -o render_bench || exit 1
+echo "Building and running header tests..."
+gcc header_tests.c -O2 -ftree-vectorize -fno-trapping-math $(sdl2-config --cflags) $(sdl2-config --libs) -lm -o header_tests || exit 1
+./header_tests || exit 1
+echo "Run with: ./render_bench [frames per state] [tab number]"
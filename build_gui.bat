@@ -1,4 +1,6 @@
 @echo off
+rem Build from this folder: the sources and the embedded font.ttf live here
+pushd "%~dp0"
 echo Building GUI Application...
 gcc gui_app.c -I"C:\SDL2\x86_64-w64-mingw32\include\SDL2" -L"C:\SDL2\x86_64-w64-mingw32\lib" -lmingw32 -lSDL2main -lSDL2 -lSDL2_ttf -o gui_app.exe
 if %errorlevel% equ 0 (
@@ -9,4 +11,5 @@ if %errorlevel% equ 0 (
     echo.
     echo [FAILED] Compilation error!
 )
+popd
 pause
@@ -0,0 +1,15 @@
+@echo off
+rem Build from this folder: the sources and the embedded font.ttf live here
+pushd "%~dp0"
+echo Building Numerical Methods Suite...
+gcc methods_suite.c secant_method_exponential.c newton_raphson_method_exponential.c false_position_exponential_v2.0.c gui_app.c fixed_point_iteration_exponential.c Elimination_Linear_Equation.c race_mode.c sweep_mode.c poly_mode.c history_mode.c -O2 -ftree-vectorize -fno-trapping-math -DMETHODS_SUITE -I"C:\SDL2\x86_64-w64-mingw32\include\SDL2" -L"C:\SDL2\x86_64-w64-mingw32\lib" -lmingw32 -lSDL2main -lSDL2 -lSDL2_ttf -o methods_suite.exe
+if %errorlevel% equ 0 (
+    echo.
+    echo [SUCCESS] methods_suite.exe compiled successfully!
+    echo Run with: methods_suite.exe [tab number]
+) else (
+    echo.
+    echo [FAILED] Compilation error!
+)
+popd
+pause
@@ -0,0 +1,165 @@
+#ifndef CURVE_SAMPLER_H
+#define CURVE_SAMPLER_H
+
+#include <SDL.h>
+#include <math.h>
+#include "trace_events.h"
+#include "frame_hud.h"
+
+#define CURVE_COARSE_SAMPLES 32     // initial uniform intervals
+#define CURVE_MAX_DEPTH 8           // halvings allowed per coarse interval
+#define CURVE_MAX_POINTS 4096
+#define CURVE_MAX_RUNS 64
+
+// Adaptive plotting of y = f(x).
+// The range is sampled coarsely, then each interval is halved while its
+// midpoint lands more than `tolerance` pixels away from the chord, so flat
+// stretches cost a few evaluations and bends get as many as they need.
+// Non-finite values and jumps larger than the plot (asymptotes, steps)
+// break the polyline instead of being bridged by a vertical stroke.
+
+typedef double (*CurveFn)(double x, const void* user);
+// y[i] = f(x[i]) for n points in one call, so the coarse pass can vectorize
+typedef void (*CurveBatchFn)(const double* x, double* y, int n, const void* user);
+
+typedef struct {
+    double xMin, xMax;
+    double yMin, yMax;      // yMin maps to the bottom edge of rect
+    SDL_Rect rect;
+    double tolerance;       // pixels
+} CurveView;
+
+// Screen-space result: points split into runs that are drawn separately
+typedef struct {
+    SDL_Point points[CURVE_MAX_POINTS];
+    int count;
+    int runStart[CURVE_MAX_RUNS];
+    int runCount;
+    int penDown;
+    int evaluations;
+} CurvePolyline;
+
+static inline double curveScreenX(const CurveView* view, double x) {
+    return view->rect.x + (x - view->xMin) / (view->xMax - view->xMin) * view->rect.w;
+}
+
+static inline double curveScreenY(const CurveView* view, double y) {
+    return view->rect.y + view->rect.h - (y - view->yMin) / (view->yMax - view->yMin) * view->rect.h;
+}
+
+// -1 above the plot, 1 below it, 0 inside
+static inline int curveOffscreen(const CurveView* view, double sy) {
+    if (sy < view->rect.y) return -1;
+    if (sy > view->rect.y + view->rect.h) return 1;
+    return 0;
+}
+
+static inline void curvePoint(CurvePolyline* line, const CurveView* view, double x, double y) {
+    if (line->count == CURVE_MAX_POINTS) return;
+    if (!line->penDown) {
+        if (line->runCount == CURVE_MAX_RUNS) return;
+        line->runStart[line->runCount++] = line->count;
+        line->penDown = 1;
+    }
+
+    double sy = curveScreenY(view, y);
+    if (sy < -100000) sy = -100000;   // keep far off-screen values in int range
+    if (sy > 100000) sy = 100000;
+    line->points[line->count].x = (int)lround(curveScreenX(view, x));
+    line->points[line->count].y = (int)lround(sy);
+    line->count++;
+}
+
+static inline void curveSubdivide(CurvePolyline* line, const CurveView* view, CurveFn f, const void* user,
+                                  double x0, double y0, double x1, double y1, int depth) {
+    double xm = 0.5 * (x0 + x1);
+    double ym = f(xm, user);
+    line->evaluations++;
+
+    int finite0 = isfinite(y0), finite1 = isfinite(y1), finiteM = isfinite(ym);
+    double sy0 = curveScreenY(view, y0);
+    double sy1 = curveScreenY(view, y1);
+    double sym = curveScreenY(view, ym);
+
+    int refine;
+    if (!finite0 || !finite1 || !finiteM) {
+        // Locate the edge of the domain, unless nothing here is defined
+        refine = finite0 || finite1 || finiteM;
+    } else {
+        int side = curveOffscreen(view, sy0);
+        int hidden = side != 0 && side == curveOffscreen(view, sy1) && side == curveOffscreen(view, sym);
+        refine = !hidden && fabs(sym - 0.5 * (sy0 + sy1)) > view->tolerance;
+    }
+
+    double width = curveScreenX(view, x1) - curveScreenX(view, x0);
+    if (refine && depth < CURVE_MAX_DEPTH && width > 0.5) {
+        curveSubdivide(line, view, f, user, x0, y0, xm, ym, depth + 1);
+        curveSubdivide(line, view, f, user, xm, ym, x1, y1, depth + 1);
+        return;
+    }
+
+    // Leaf: connect to x1 unless the interval crosses a gap or a jump
+    if (!finite1) {
+        line->penDown = 0;
+        return;
+    }
+    if (!finite0 || !finiteM || (refine && fabs(sy1 - sy0) > view->rect.h)) {
+        line->penDown = 0;
+    }
+    curvePoint(line, view, x1, y1);
+}
+
+// Sample f over the view into line; batch may be NULL
+static inline void curveSample(CurvePolyline* line, const CurveView* view, CurveFn f, CurveBatchFn batch,
+                               const void* user) {
+    line->count = 0;
+    line->runCount = 0;
+    line->penDown = 0;
+    line->evaluations = 0;
+
+    TRACE_SCOPE("curveSample") {
+        double step = (view->xMax - view->xMin) / CURVE_COARSE_SAMPLES;
+        double xs[CURVE_COARSE_SAMPLES + 1], ys[CURVE_COARSE_SAMPLES + 1];
+        for (int i = 0; i < CURVE_COARSE_SAMPLES; i++) {
+            xs[i] = view->xMin + i * step;
+        }
+        xs[CURVE_COARSE_SAMPLES] = view->xMax;
+        if (batch) {
+            batch(xs, ys, CURVE_COARSE_SAMPLES + 1, user);
+        } else {
+            for (int i = 0; i <= CURVE_COARSE_SAMPLES; i++) ys[i] = f(xs[i], user);
+        }
+        line->evaluations += CURVE_COARSE_SAMPLES + 1;
+
+        if (isfinite(ys[0])) curvePoint(line, view, xs[0], ys[0]);
+        for (int i = 1; i <= CURVE_COARSE_SAMPLES; i++) {
+            curveSubdivide(line, view, f, user, xs[i - 1], ys[i - 1], xs[i], ys[i], 0);
+        }
+    }
+}
+
+// Draw every run clipped to the view; thickness stacks copies one pixel down
+static inline void curveRender(SDL_Renderer* renderer, CurvePolyline* line, const CurveView* view, int thickness) {
+    SDL_Rect oldClip;
+    int clipped = SDL_RenderIsClipEnabled(renderer);
+    if (clipped) SDL_RenderGetClipRect(renderer, &oldClip);
+    SDL_RenderSetClipRect(renderer, &view->rect);
+
+    for (int t = 0; t < thickness; t++) {
+        for (int r = 0; r < line->runCount; r++) {
+            int start = line->runStart[r];
+            int end = r + 1 < line->runCount ? line->runStart[r + 1] : line->count;
+            if (end - start >= 2) {
+                hudRenderDrawLines(renderer, line->points + start, end - start);
+            } else if (end - start == 1) {
+                hudRenderDrawPoint(renderer, line->points[start].x, line->points[start].y);
+            }
+        }
+        for (int i = 0; i < line->count; i++) line->points[i].y++;
+    }
+    for (int i = 0; i < line->count; i++) line->points[i].y -= thickness;
+
+    SDL_RenderSetClipRect(renderer, clipped ? &oldClip : NULL);
+}
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef DOUBLE_DOUBLE_H
+#define DOUBLE_DOUBLE_H
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// Double-double arithmetic: a value is the unevaluated sum hi + lo of two
+// doubles with |lo| <= ulp(hi)/2, which carries about 32 significant
+// digits. Sums and products use the error-free twoSum/twoProd transforms
+// (the latter through fma), after Dekker and the QD library.
+
+typedef struct {
+    double hi, lo;
+} DoubleDouble;
+
+#define DD_EPSILON 4.93038065763132e-32     // 2^-104
+
+static inline DoubleDouble ddMake(double hi, double lo) {
+    DoubleDouble r = {hi, lo};
+    return r;
+}
+
+static inline DoubleDouble ddFromDouble(double x) {
+    return ddMake(x, 0);
+}
+
+// hi + lo exactly, assuming |a| >= |b|
+static inline DoubleDouble ddQuickTwoSum(double a, double b) {
+    double s = a + b;
+    return ddMake(s, b - (s - a));
+}
+
+static inline DoubleDouble ddTwoSum(double a, double b) {
+    double s = a + b;
+    double bb = s - a;
+    return ddMake(s, (a - (s - bb)) + (b - bb));
+}
+
+static inline DoubleDouble ddTwoProd(double a, double b) {
+    double p = a * b;
+    return ddMake(p, fma(a, b, -p));
+}
+
+static inline DoubleDouble ddNeg(DoubleDouble a) {
+    return ddMake(-a.hi, -a.lo);
+}
+
+static inline DoubleDouble ddAdd(DoubleDouble a, DoubleDouble b) {
+    DoubleDouble s = ddTwoSum(a.hi, b.hi);
+    DoubleDouble t = ddTwoSum(a.lo, b.lo);
+    s.lo += t.hi;
+    s = ddQuickTwoSum(s.hi, s.lo);
+    s.lo += t.lo;
+    return ddQuickTwoSum(s.hi, s.lo);
+}
+
+static inline DoubleDouble ddSub(DoubleDouble a, DoubleDouble b) {
+    return ddAdd(a, ddNeg(b));
+}
+
+static inline DoubleDouble ddMul(DoubleDouble a, DoubleDouble b) {
+    DoubleDouble p = ddTwoProd(a.hi, b.hi);
+    p.lo += a.hi * b.lo + a.lo * b.hi;
+    return ddQuickTwoSum(p.hi, p.lo);
+}
+
+static inline DoubleDouble ddMulDouble(DoubleDouble a, double b) {
+    DoubleDouble p = ddTwoProd(a.hi, b);
+    p.lo += a.lo * b;
+    return ddQuickTwoSum(p.hi, p.lo);
+}
+
+// Long division: three quotient digits, each correcting the remainder
+static inline DoubleDouble ddDiv(DoubleDouble a, DoubleDouble b) {
+    double q1 = a.hi / b.hi;
+    DoubleDouble r = ddSub(a, ddMulDouble(b, q1));
+    double q2 = r.hi / b.hi;
+    r = ddSub(r, ddMulDouble(b, q2));
+    double q3 = r.hi / b.hi;
+    DoubleDouble q = ddQuickTwoSum(q1, q2);
+    return ddAdd(q, ddFromDouble(q3));
+}
+
+// Largest integer <= a: when hi is already an integer, lo decides, so
+// 3 - 1e-20 floors to 2
+static inline DoubleDouble ddFloor(DoubleDouble a) {
+    double hi = floor(a.hi);
+    if (hi != a.hi) return ddFromDouble(hi);
+    return ddQuickTwoSum(hi, floor(a.lo));
+}
+
+// a < b
+static inline int ddLess(DoubleDouble a, DoubleDouble b) {
+    return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+}
+
+// Multiply by 2^e, exact
+static inline DoubleDouble ddLdexp(DoubleDouble a, int e) {
+    return ddMake(ldexp(a.hi, e), ldexp(a.lo, e));
+}
+
+// a^n for integer n, by squaring
+static inline DoubleDouble ddPowInt(DoubleDouble a, int n) {
+    DoubleDouble r = ddFromDouble(1);
+    DoubleDouble s = a;
+    int m = n < 0 ? -n : n;
+    while (m) {
+        if (m & 1) r = ddMul(r, s);
+        s = ddMul(s, s);
+        m >>= 1;
+    }
+    return n < 0 ? ddDiv(ddFromDouble(1), r) : r;
+}
+
+// e^a: reduce to r = (a - k ln2) / 512, sum the Taylor series of e^r - 1,
+// square back up nine times and scale by 2^k
+static inline DoubleDouble ddExp(DoubleDouble a) {
+    const DoubleDouble ln2 = {6.931471805599452862e-01, 2.319046813846299558e-17};
+    if (a.hi > 709.78) return ddFromDouble(INFINITY);
+    if (a.hi < -745.0) return ddFromDouble(0);
+    if (a.hi == 0 && a.lo == 0) return ddFromDouble(1);
+
+    double k = floor(a.hi / ln2.hi + 0.5);
+    DoubleDouble r = ddLdexp(ddSub(a, ddMulDouble(ln2, k)), -9);
+
+    // s = e^r - 1; |r| < 0.0007 so about a dozen terms reach 2^-104
+    DoubleDouble s = r;
+    DoubleDouble term = r;
+    for (int i = 2; i < 20; i++) {
+        term = ddDiv(ddMul(term, r), ddFromDouble(i));
+        s = ddAdd(s, term);
+        if (fabs(term.hi) <= DD_EPSILON * fabs(s.hi)) break;
+    }
+
+    // (1 + s)^2 - 1 = 2s + s^2, which keeps the small part exact
+    for (int i = 0; i < 9; i++) {
+        s = ddAdd(ddLdexp(s, 1), ddMul(s, s));
+    }
+    return ddLdexp(ddAdd(s, ddFromDouble(1)), (int)k);
+}
+
+// Decimal text to double-double, so a coefficient like 0.1 keeps its full
+// value rather than the nearest double. Returns 0 if text is not a number.
+static inline int ddParse(const char* text, DoubleDouble* out) {
+    const char* p = text;
+    while (*p == ' ') p++;
+    int negative = *p == '-';
+    if (*p == '-' || *p == '+') p++;
+
+    DoubleDouble r = ddFromDouble(0);
+    int digits = 0, scale = 0, seenPoint = 0;
+    for (; (*p >= '0' && *p <= '9') || (*p == '.' && !seenPoint); p++) {
+        if (*p == '.') {
+            seenPoint = 1;
+            continue;
+        }
+        r = ddAdd(ddMulDouble(r, 10), ddFromDouble(*p - '0'));
+        digits++;
+        if (seenPoint) scale--;
+    }
+    if (digits == 0) return 0;
+
+    if (*p == 'e' || *p == 'E') {
+        int exponent = 0, sign = 1;
+        p++;
+        if (*p == '-' || *p == '+') sign = *p++ == '-' ? -1 : 1;
+        if (*p < '0' || *p > '9') return 0;
+        while (*p >= '0' && *p <= '9') exponent = exponent * 10 + (*p++ - '0');
+        scale += sign * exponent;
+    }
+    while (*p == ' ') p++;
+    if (*p) return 0;
+
+    if (scale > 0) r = ddMul(r, ddPowInt(ddFromDouble(10), scale));
+    if (scale < 0) r = ddDiv(r, ddPowInt(ddFromDouble(10), -scale));
+    *out = negative ? ddNeg(r) : r;
+    return 1;
+}
+
+// Format with the given significant digits (at most 32): plain notation for
+// moderate exponents, otherwise d.ddd...e+NN
+static inline void ddFormat(DoubleDouble a, int digits, char* buffer, size_t size) {
+    if (!isfinite(a.hi)) {
+        snprintf(buffer, size, "%g", a.hi);
+        return;
+    }
+    if (digits < 1) digits = 1;
+    if (digits > 32) digits = 32;
+    if (a.hi == 0) {
+        snprintf(buffer, size, "0");
+        return;
+    }
+
+    int negative = a.hi < 0;
+    if (negative) a = ddNeg(a);
+
+    // Scale into [1, 10)
+    int e10 = (int)floor(log10(a.hi));
+    DoubleDouble m = e10 >= 0 ? ddDiv(a, ddPowInt(ddFromDouble(10), e10))
+                              : ddMul(a, ddPowInt(ddFromDouble(10), -e10));
+    // hi alone can sit on the boundary (10 - 1e-25 has hi == 10), so compare
+    // the full value
+    if (!ddLess(m, ddFromDouble(10))) {
+        m = ddDiv(m, ddFromDouble(10));
+        e10++;
+    } else if (ddLess(m, ddFromDouble(1))) {
+        m = ddMulDouble(m, 10);
+        e10--;
+    }
+
+    // One extra digit for rounding. Each digit is the floor of the whole
+    // value, borrowing from hi when lo is negative, so the remainder stays
+    // in [0, 1) and later digits come out right.
+    char d[34];
+    for (int i = 0; i <= digits; i++) {
+        DoubleDouble digitDD = ddFloor(m);
+        int digit = (int)digitDD.hi;
+        if (digit < 0) digit = 0;
+        if (digit > 9) digit = 9;
+        d[i] = (char)digit;
+        m = ddMulDouble(ddSub(m, ddFromDouble(digit)), 10);
+    }
+    if (d[digits] >= 5) {
+        int i = digits - 1;
+        while (i >= 0 && ++d[i] == 10) d[i--] = 0;
+        if (i < 0) {
+            memmove(d + 1, d, digits - 1);
+            d[0] = 1;
+            e10++;
+        }
+    }
+
+    char text[80];
+    int n = 0;
+    if (negative) text[n++] = '-';
+    if (e10 >= -5 && e10 < digits) {
+        if (e10 < 0) {
+            text[n++] = '0';
+            text[n++] = '.';
+            for (int i = -1; i > e10; i--) text[n++] = '0';
+        }
+        for (int i = 0; i < digits; i++) {
+            text[n++] = (char)('0' + d[i]);
+            if (i == e10 && i < digits - 1) text[n++] = '.';
+        }
+        text[n] = '\0';
+    } else {
+        text[n++] = (char)('0' + d[0]);
+        if (digits > 1) text[n++] = '.';
+        for (int i = 1; i < digits; i++) text[n++] = (char)('0' + d[i]);
+        snprintf(text + n, sizeof(text) - n, "e%+03d", e10);
+    }
+    snprintf(buffer, size, "%s", text);
+}
+
+#endif
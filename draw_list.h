@@ -0,0 +1,293 @@
+#ifndef DRAW_LIST_H
+#define DRAW_LIST_H
+
+#include <SDL.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "frame_hud.h"
+
+// Immediate-mode draw list for the UI chrome.
+// Panels, boxes, buttons, grid lines and text are recorded here as quads
+// instead of going to the renderer one call (and one color change) at a
+// time, and drawListFlush submits them with one SDL_RenderGeometry call per
+// batch. A quad joins the most recent batch with the same texture unless a
+// batch recorded after that one overlaps it, so the picture comes out as
+// if drawn in order while all colored geometry of a frame, which seldom
+// overlaps itself, collapses into a few batches. Anything drawn straight
+// through the renderer (graph tiles, canvases, tables) and any clip,
+// viewport or target change must come after a flush.
+
+#define DRAW_LIST_LOOKBACK 64   // batches searched back for one to join
+
+typedef struct {
+    SDL_Texture* texture;   // NULL for colored geometry
+    int owned;              // destroyed once submitted (per-frame text)
+    SDL_Rect bounds;        // union of its quads
+    int quadCount;
+    int first;              // first quad once sorted, during a flush
+} DrawBatch;
+
+typedef struct {
+    int batch;
+    SDL_Vertex v[4];        // corners in the order top-left, top-right, bottom-left, bottom-right
+} DrawQuad;
+
+typedef struct {
+    SDL_Renderer* renderer;
+
+    DrawQuad* quads;
+    int quadCount;
+    int quadCapacity;
+    DrawBatch* batches;
+    int batchCount;
+    int batchCapacity;
+
+    // Submission buffers: vertices sorted by batch, two triangles per quad
+    SDL_Vertex* vertices;
+    int* indices;
+    int sortedCapacity;
+} DrawList;
+
+static inline void drawListInit(DrawList* list, SDL_Renderer* renderer) {
+    memset(list, 0, sizeof(*list));
+    list->renderer = renderer;
+}
+
+static inline void drawListFlush(DrawList* list);
+
+static inline void drawListFree(DrawList* list) {
+    drawListFlush(list);
+    free(list->quads);
+    free(list->batches);
+    free(list->vertices);
+    free(list->indices);
+    memset(list, 0, sizeof(*list));
+}
+
+static inline int drawListOverlap(const SDL_Rect* a, const SDL_Rect* b) {
+    return a->x < b->x + b->w && b->x < a->x + a->w && a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+// Room for one more quad and batch; flushes to make room if memory runs out
+static inline int drawListReserve(DrawList* list) {
+    if (list->quadCount == list->quadCapacity) {
+        int capacity = list->quadCapacity ? list->quadCapacity * 2 : 256;
+        DrawQuad* quads = (DrawQuad*)realloc(list->quads, capacity * sizeof(DrawQuad));
+        if (!quads) return 0;
+        list->quads = quads;
+        list->quadCapacity = capacity;
+    }
+    if (list->batchCount == list->batchCapacity) {
+        int capacity = list->batchCapacity ? list->batchCapacity * 2 : 64;
+        DrawBatch* batches = (DrawBatch*)realloc(list->batches, capacity * sizeof(DrawBatch));
+        if (!batches) return 0;
+        list->batches = batches;
+        list->batchCapacity = capacity;
+    }
+    return 1;
+}
+
+// Record one quad covering bounds
+static inline void drawListPush(DrawList* list, SDL_Texture* texture, int owned,
+                                const SDL_Rect* bounds, const SDL_Vertex* v) {
+    if (bounds->w <= 0 || bounds->h <= 0) {
+        if (owned) SDL_DestroyTexture(texture);
+        return;
+    }
+    if (!drawListReserve(list)) {
+        drawListFlush(list);
+        if (!drawListReserve(list)) {
+            // Out of memory: draw it on its own rather than drop it
+            static const int quadIndices[6] = {0, 1, 2, 2, 1, 3};
+            hudRenderGeometry(list->renderer, texture, v, 4, quadIndices, 6);
+            if (owned) SDL_DestroyTexture(texture);
+            return;
+        }
+    }
+
+    // Join the latest batch with this texture if nothing after it is in the way
+    int batch = -1;
+    int stop = list->batchCount > DRAW_LIST_LOOKBACK ? list->batchCount - DRAW_LIST_LOOKBACK : 0;
+    for (int i = list->batchCount - 1; i >= stop; i--) {
+        if (list->batches[i].texture == texture) {
+            batch = i;
+            break;
+        }
+        if (drawListOverlap(&list->batches[i].bounds, bounds)) break;
+    }
+
+    if (batch < 0) {
+        batch = list->batchCount++;
+        DrawBatch* b = &list->batches[batch];
+        b->texture = texture;
+        b->owned = 0;
+        b->bounds = *bounds;
+        b->quadCount = 0;
+    } else {
+        SDL_UnionRect(&list->batches[batch].bounds, bounds, &list->batches[batch].bounds);
+    }
+    DrawBatch* b = &list->batches[batch];
+    b->owned |= owned;
+    b->quadCount++;
+
+    DrawQuad* q = &list->quads[list->quadCount++];
+    q->batch = batch;
+    memcpy(q->v, v, sizeof(q->v));
+}
+
+static inline void drawListVertex(SDL_Vertex* v, float x, float y, SDL_Color color, float u, float t) {
+    v->position.x = x;
+    v->position.y = y;
+    v->color = color;
+    v->tex_coord.x = u;
+    v->tex_coord.y = t;
+}
+
+// Same pixels as SDL_RenderFillRect; fully transparent fills draw nothing
+static inline void drawListFillRect(DrawList* list, const SDL_Rect* rect, SDL_Color color) {
+    if (color.a == 0) return;
+    SDL_Vertex v[4];
+    float x0 = (float)rect->x, y0 = (float)rect->y;
+    float x1 = (float)(rect->x + rect->w), y1 = (float)(rect->y + rect->h);
+    drawListVertex(&v[0], x0, y0, color, 0, 0);
+    drawListVertex(&v[1], x1, y0, color, 0, 0);
+    drawListVertex(&v[2], x0, y1, color, 0, 0);
+    drawListVertex(&v[3], x1, y1, color, 0, 0);
+    drawListPush(list, NULL, 0, rect, v);
+}
+
+// One pixel outline, same pixels as SDL_RenderDrawRect
+static inline void drawListRect(DrawList* list, const SDL_Rect* rect, SDL_Color color) {
+    if (rect->w <= 0 || rect->h <= 0) return;
+    SDL_Rect top = {rect->x, rect->y, rect->w, 1};
+    SDL_Rect bottom = {rect->x, rect->y + rect->h - 1, rect->w, 1};
+    SDL_Rect left = {rect->x, rect->y + 1, 1, rect->h - 2};
+    SDL_Rect right = {rect->x + rect->w - 1, rect->y + 1, 1, rect->h - 2};
+    drawListFillRect(list, &top, color);
+    if (rect->h > 1) drawListFillRect(list, &bottom, color);
+    drawListFillRect(list, &left, color);
+    if (rect->w > 1) drawListFillRect(list, &right, color);
+}
+
+// One pixel line between pixel centers, endpoints included like
+// SDL_RenderDrawLine; horizontal and vertical lines come out exact
+static inline void drawListLine(DrawList* list, int x1, int y1, int x2, int y2, SDL_Color color) {
+    if (x1 == x2 || y1 == y2) {
+        SDL_Rect r = {x1 < x2 ? x1 : x2, y1 < y2 ? y1 : y2, abs(x2 - x1) + 1, abs(y2 - y1) + 1};
+        drawListFillRect(list, &r, color);
+        return;
+    }
+
+    // A one pixel wide quad along the line, half a pixel past each end
+    float dx = (float)(x2 - x1), dy = (float)(y2 - y1);
+    float length = sqrtf(dx * dx + dy * dy);
+    float ux = dx / length * 0.5f, uy = dy / length * 0.5f;
+    float ax = x1 + 0.5f - ux, ay = y1 + 0.5f - uy;
+    float bx = x2 + 0.5f + ux, by = y2 + 0.5f + uy;
+    SDL_Vertex v[4];
+    drawListVertex(&v[0], ax - uy, ay + ux, color, 0, 0);
+    drawListVertex(&v[1], bx - uy, by + ux, color, 0, 0);
+    drawListVertex(&v[2], ax + uy, ay - ux, color, 0, 0);
+    drawListVertex(&v[3], bx + uy, by - ux, color, 0, 0);
+    SDL_Rect bounds = {(x1 < x2 ? x1 : x2) - 1, (y1 < y2 ? y1 : y2) - 1, abs(x2 - x1) + 3, abs(y2 - y1) + 3};
+    drawListPush(list, NULL, 0, &bounds, v);
+}
+
+// Textured quad like SDL_RenderCopy (src NULL for the whole texture).
+// With owned set the list destroys the texture after submitting it, so
+// text rendered for this frame only can be handed over and forgotten.
+// Hand a texture over once, on the last quad that uses it.
+static inline void drawListTexture(DrawList* list, SDL_Texture* texture, const SDL_Rect* src,
+                                   const SDL_Rect* dst, int owned) {
+    if (!texture) return;
+    float u0 = 0, v0 = 0, u1 = 1, v1 = 1;
+    if (src) {
+        int w, h;
+        if (SDL_QueryTexture(texture, NULL, NULL, &w, &h) != 0 || w <= 0 || h <= 0) {
+            if (owned) SDL_DestroyTexture(texture);
+            return;
+        }
+        u0 = (float)src->x / w;
+        v0 = (float)src->y / h;
+        u1 = (float)(src->x + src->w) / w;
+        v1 = (float)(src->y + src->h) / h;
+    }
+
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Vertex v[4];
+    float x0 = (float)dst->x, y0 = (float)dst->y;
+    float x1 = (float)(dst->x + dst->w), y1 = (float)(dst->y + dst->h);
+    drawListVertex(&v[0], x0, y0, white, u0, v0);
+    drawListVertex(&v[1], x1, y0, white, u1, v0);
+    drawListVertex(&v[2], x0, y1, white, u0, v1);
+    drawListVertex(&v[3], x1, y1, white, u1, v1);
+    drawListPush(list, texture, owned, dst, v);
+}
+
+// Submit everything recorded, one SDL_RenderGeometry call per batch, and
+// start over. Colored geometry is blended by its alpha, as the UI's
+// translucent fills expect; opaque colors draw the same either way.
+static inline void drawListFlush(DrawList* list) {
+    if (list->quadCount == 0) return;
+
+    if (list->sortedCapacity < list->quadCount) {
+        int capacity = list->quadCapacity;
+        SDL_Vertex* vertices = (SDL_Vertex*)realloc(list->vertices, capacity * 4 * sizeof(SDL_Vertex));
+        if (vertices) list->vertices = vertices;
+        int* indices = (int*)realloc(list->indices, capacity * 6 * sizeof(int));
+        if (indices) list->indices = indices;
+        if (vertices && indices) {
+            for (int q = list->sortedCapacity; q < capacity; q++) {
+                int* index = &list->indices[q * 6];
+                index[0] = q * 4;
+                index[1] = q * 4 + 1;
+                index[2] = q * 4 + 2;
+                index[3] = q * 4 + 2;
+                index[4] = q * 4 + 1;
+                index[5] = q * 4 + 3;
+            }
+            list->sortedCapacity = capacity;
+        }
+    }
+
+    SDL_BlendMode oldBlend;
+    SDL_GetRenderDrawBlendMode(list->renderer, &oldBlend);
+    SDL_SetRenderDrawBlendMode(list->renderer, SDL_BLENDMODE_BLEND);
+
+    if (list->sortedCapacity >= list->quadCount) {
+        // Counting sort of the quads by batch, keeping their order within one
+        int first = 0;
+        for (int i = 0; i < list->batchCount; i++) {
+            list->batches[i].first = first;
+            first += list->batches[i].quadCount;
+        }
+        for (int i = 0; i < list->quadCount; i++) {
+            DrawBatch* b = &list->batches[list->quads[i].batch];
+            memcpy(&list->vertices[b->first * 4], list->quads[i].v, sizeof(list->quads[i].v));
+            b->first++;
+        }
+        for (int i = 0; i < list->batchCount; i++) {
+            DrawBatch* b = &list->batches[i];
+            int start = b->first - b->quadCount;
+            hudRenderGeometry(list->renderer, b->texture, &list->vertices[start * 4], b->quadCount * 4,
+                               list->indices, b->quadCount * 6);
+        }
+    } else {
+        // No memory for the sorted copy: one call per quad, still in order
+        static const int quadIndices[6] = {0, 1, 2, 2, 1, 3};
+        for (int i = 0; i < list->quadCount; i++) {
+            DrawQuad* q = &list->quads[i];
+            hudRenderGeometry(list->renderer, list->batches[q->batch].texture, q->v, 4, quadIndices, 6);
+        }
+    }
+
+    SDL_SetRenderDrawBlendMode(list->renderer, oldBlend);
+    for (int i = 0; i < list->batchCount; i++) {
+        if (list->batches[i].owned) SDL_DestroyTexture(list->batches[i].texture);
+    }
+    list->quadCount = 0;
+    list->batchCount = 0;
+}
+
+#endif
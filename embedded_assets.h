@@ -0,0 +1,71 @@
+#ifndef EMBEDDED_ASSETS_H
+#define EMBEDDED_ASSETS_H
+
+#include <stddef.h>
+
+// Assets compiled into the executable.
+// font.ttf is pulled in by the assembler (.incbin) at build time, so the
+// program needs no font file at run time and the bytes are read straight
+// from the read-only data section: SDL_RWFromConstMem over them is
+// zero-copy. The assembler looks the file up relative to its working
+// directory (then its -I include path), so the build scripts cd / pushd
+// into their own folder before compiling; when building from elsewhere,
+// pass -Wa,-I<repo dir> or define EMBEDDED_FONT_PATH (a string literal)
+// to name the file outright. Define APP_EXTERNAL_ASSETS, or use a
+// compiler without GNU inline assembly, to load font.ttf from disk instead.
+//
+// Exactly one translation unit emits the data: the one that defines
+// EMBEDDED_ASSETS_IMPLEMENTATION before including this header.
+
+#if defined(__GNUC__) && !defined(APP_EXTERNAL_ASSETS)
+#define EMBEDDED_ASSETS 1
+
+extern const unsigned char embeddedFontData[];
+extern const unsigned char embeddedFontEnd[];
+
+#ifdef EMBEDDED_ASSETS_IMPLEMENTATION
+
+#ifndef EMBEDDED_FONT_PATH
+#define EMBEDDED_FONT_PATH "font.ttf"
+#endif
+
+#define EMBED_STR2(x) #x
+#define EMBED_STR(x) EMBED_STR2(x)
+#define EMBED_SYMBOL(name) EMBED_STR(__USER_LABEL_PREFIX__) name
+
+#if defined(_WIN32)
+#define EMBED_SECTION ".section .rdata,\"dr\"\n"
+#elif defined(__APPLE__)
+#define EMBED_SECTION ".const_data\n"
+#else
+#define EMBED_SECTION ".section .rodata\n"
+#endif
+
+__asm__(EMBED_SECTION
+        ".balign 16\n"
+        ".globl " EMBED_SYMBOL("embeddedFontData") "\n"
+        EMBED_SYMBOL("embeddedFontData") ":\n"
+        ".incbin \"" EMBEDDED_FONT_PATH "\"\n"
+        ".globl " EMBED_SYMBOL("embeddedFontEnd") "\n"
+        EMBED_SYMBOL("embeddedFontEnd") ":\n"
+        ".byte 0\n"
+        ".text\n");
+
+#endif
+
+// Embedded font bytes, or NULL when assets are loaded from disk
+static inline const unsigned char* embeddedFont(size_t* size) {
+    *size = (size_t)(embeddedFontEnd - embeddedFontData);
+    return embeddedFontData;
+}
+
+#else
+
+static inline const unsigned char* embeddedFont(size_t* size) {
+    *size = 0;
+    return NULL;
+}
+
+#endif
+
+#endif
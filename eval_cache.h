@@ -0,0 +1,90 @@
+#ifndef EVAL_CACHE_H
+#define EVAL_CACHE_H
+
+#include <SDL.h>
+#include <string.h>
+#include "root_problem.h"
+
+#define EVAL_CACHE_SIZE 4096   // must be a power of two
+
+// Memoized f(x) for one problem at a time.
+// Direct-mapped: each x (by exact bit pattern) hashes to one slot and a
+// colliding x simply replaces it. Entries are tagged with a generation that
+// is bumped whenever the problem parameters change, which invalidates the
+// whole table without touching it. Not thread-safe: share it only between
+// code running on the same thread (worker solves feed it through their rows).
+typedef struct {
+    Uint64 xBits;
+    double y;
+    Uint32 generation;
+} EvalCacheEntry;
+
+typedef struct {
+    EvalCacheEntry entries[EVAL_CACHE_SIZE];
+    RootProblem problem;
+    Uint32 generation;
+    int hits;
+    int misses;
+} EvalCache;
+
+static inline void evalCacheInit(EvalCache* cache) {
+    memset(cache, 0, sizeof(*cache));
+    cache->generation = 1;
+}
+
+static inline void evalCacheClear(EvalCache* cache) {
+    cache->generation++;
+}
+
+static inline Uint64 evalCacheBits(double x) {
+    Uint64 bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+static inline EvalCacheEntry* evalCacheSlot(EvalCache* cache, Uint64 bits) {
+    Uint64 h = (bits ^ (bits >> 29)) * 0x9E3779B97F4A7C15ULL;
+    return &cache->entries[(h >> 40) & (EVAL_CACHE_SIZE - 1)];
+}
+
+// Switch to a problem, dropping every entry if its parameters differ
+static inline void evalCacheBind(EvalCache* cache, const RootProblem* problem) {
+    if (cache->problem.family != problem->family || cache->problem.a != problem->a ||
+        cache->problem.b != problem->b || cache->problem.c != problem->c) {
+        cache->problem = *problem;
+        evalCacheClear(cache);
+    }
+}
+
+// Record a value computed elsewhere, e.g. an f column streamed from a solve
+static inline void evalCacheStore(EvalCache* cache, const RootProblem* problem, double x, double y) {
+    evalCacheBind(cache, problem);
+    Uint64 bits = evalCacheBits(x);
+    EvalCacheEntry* entry = evalCacheSlot(cache, bits);
+    entry->xBits = bits;
+    entry->y = y;
+    entry->generation = cache->generation;
+}
+
+// f(x) from the cache, evaluating and storing it on a miss.
+// cost (may be NULL) counts the hit or the evaluation.
+static inline double evalCacheF(EvalCache* cache, const RootProblem* problem, double x, SolverCost* cost) {
+    evalCacheBind(cache, problem);
+    Uint64 bits = evalCacheBits(x);
+    EvalCacheEntry* entry = evalCacheSlot(cache, bits);
+
+    if (entry->generation == cache->generation && entry->xBits == bits) {
+        cache->hits++;
+        if (cost) cost->cacheHits++;
+        return entry->y;
+    }
+
+    cache->misses++;
+    double y = problemF(problem, x, cost);
+    entry->xBits = bits;
+    entry->y = y;
+    entry->generation = cache->generation;
+    return y;
+}
+
+#endif
@@ -0,0 +1,362 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <SDL.h>
+#include <stdio.h>
+#include <string.h>
+#include "mapped_file.h"
+#include "frame_stats.h"
+
+#define EVENT_LOG_MAGIC "EVLG"
+#define EVENT_LOG_VERSION 1
+#define EVENT_LOG_FRAME_MS 16       // virtual frame length during replay
+
+// Recording and replay of the input a session consumed.
+// Recording appends every input event to a compact binary file, tagged
+// with the frame it was polled in. Replay feeds the same events back on
+// the same frames, with virtual timestamps of EVENT_LOG_FRAME_MS per
+// frame, runs frames back to back without the idle delay, and reports how
+// long each frame took. The same session can so be timed before and after
+// a change to the rendering. A log may also carry marks that split the
+// session into named segments, each timed on its own; frames in a segment
+// with an empty name are not timed at all (see render_bench.c).
+//
+// File: magic "EVLG", a version byte, then one record per event:
+// varint frame delta, kind byte, payload. Integers are LEB128 varints,
+// signed ones zigzag encoded first.
+
+enum { EVENT_LOG_OFF, EVENT_LOG_RECORD, EVENT_LOG_REPLAY };
+
+enum {
+    EVLOG_QUIT,
+    EVLOG_KEY_DOWN,
+    EVLOG_KEY_UP,
+    EVLOG_TEXT,
+    EVLOG_BUTTON_DOWN,
+    EVLOG_BUTTON_UP,
+    EVLOG_MOTION,
+    EVLOG_WHEEL,
+    EVLOG_WINDOW,
+    EVLOG_MARK
+};
+
+typedef struct {
+    int mode;
+    unsigned frame;                 // frames ended so far
+    int events;                     // events written or replayed
+
+    FILE* out;
+    unsigned lastFrame;             // frame of the last record written
+
+    MappedFile in;
+    size_t pos;
+    int hasNext;                    // next is decoded and waits for nextFrame
+    unsigned nextFrame;
+    SDL_Event next;
+    int quitSent;
+    int nextMark;                   // next is a mark named nextLabel
+    char nextLabel[32];
+
+    FrameStats stats;               // every frame
+    FrameStats segment;             // frames since the last mark
+    char label[32];
+    int marked;                     // a mark was replayed
+    Uint64 frameStart;
+} EventLog;
+
+static inline void eventLogPutVarint(FILE* out, unsigned long long v) {
+    while (v >= 0x80) {
+        fputc((int)(v & 0x7F) | 0x80, out);
+        v >>= 7;
+    }
+    fputc((int)v, out);
+}
+
+static inline void eventLogPutSigned(FILE* out, long long v) {
+    eventLogPutVarint(out, ((unsigned long long)v << 1) ^ (unsigned long long)(v >> 63));
+}
+
+// Returns 0 past the end of the file
+static inline int eventLogGetVarint(EventLog* log, unsigned long long* v) {
+    *v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (log->pos >= log->in.size) return 0;
+        unsigned char byte = log->in.data[log->pos++];
+        *v |= (unsigned long long)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return 1;
+    }
+    return 0;
+}
+
+static inline int eventLogGetSigned(EventLog* log, int* v) {
+    unsigned long long u;
+    if (!eventLogGetVarint(log, &u)) return 0;
+    *v = (int)(long long)((u >> 1) ^ (~(u & 1) + 1));
+    return 1;
+}
+
+static inline int eventLogRecordOpen(EventLog* log, const char* path) {
+    memset(log, 0, sizeof(*log));
+    log->out = fopen(path, "wb");
+    if (!log->out) return -1;
+    fwrite(EVENT_LOG_MAGIC, 1, 4, log->out);
+    fputc(EVENT_LOG_VERSION, log->out);
+    log->mode = EVENT_LOG_RECORD;
+    return 0;
+}
+
+static inline int eventLogReplayOpen(EventLog* log, const char* path) {
+    memset(log, 0, sizeof(*log));
+    if (mappedFileOpen(&log->in, path) != 0) return -1;
+    if (log->in.size < 5 || memcmp(log->in.data, EVENT_LOG_MAGIC, 4) != 0 ||
+        log->in.data[4] != EVENT_LOG_VERSION) {
+        mappedFileClose(&log->in);
+        return -1;
+    }
+    log->pos = 5;
+    log->mode = EVENT_LOG_REPLAY;
+    log->frameStart = SDL_GetPerformanceCounter();
+    return 0;
+}
+
+// Append an input event; anything else (e.g. user events) is not recorded
+static inline void eventLogWrite(EventLog* log, const SDL_Event* e) {
+    int kind;
+    switch (e->type) {
+        case SDL_QUIT:            kind = EVLOG_QUIT; break;
+        case SDL_KEYDOWN:         kind = EVLOG_KEY_DOWN; break;
+        case SDL_KEYUP:           kind = EVLOG_KEY_UP; break;
+        case SDL_TEXTINPUT:       kind = EVLOG_TEXT; break;
+        case SDL_MOUSEBUTTONDOWN: kind = EVLOG_BUTTON_DOWN; break;
+        case SDL_MOUSEBUTTONUP:   kind = EVLOG_BUTTON_UP; break;
+        case SDL_MOUSEMOTION:     kind = EVLOG_MOTION; break;
+        case SDL_MOUSEWHEEL:      kind = EVLOG_WHEEL; break;
+        case SDL_WINDOWEVENT:     kind = EVLOG_WINDOW; break;
+        default: return;
+    }
+
+    FILE* out = log->out;
+    eventLogPutVarint(out, log->frame - log->lastFrame);
+    log->lastFrame = log->frame;
+    fputc(kind, out);
+
+    switch (kind) {
+        case EVLOG_KEY_DOWN:
+        case EVLOG_KEY_UP:
+            eventLogPutVarint(out, (unsigned)e->key.keysym.sym);
+            eventLogPutVarint(out, (unsigned)e->key.keysym.scancode);
+            eventLogPutVarint(out, e->key.keysym.mod);
+            fputc(e->key.repeat, out);
+            break;
+        case EVLOG_TEXT: {
+            size_t len = strlen(e->text.text);
+            fputc((int)len, out);
+            fwrite(e->text.text, 1, len, out);
+            break;
+        }
+        case EVLOG_BUTTON_DOWN:
+        case EVLOG_BUTTON_UP:
+            fputc(e->button.button, out);
+            fputc(e->button.clicks, out);
+            eventLogPutSigned(out, e->button.x);
+            eventLogPutSigned(out, e->button.y);
+            break;
+        case EVLOG_MOTION:
+            eventLogPutVarint(out, e->motion.state);
+            eventLogPutSigned(out, e->motion.x);
+            eventLogPutSigned(out, e->motion.y);
+            eventLogPutSigned(out, e->motion.xrel);
+            eventLogPutSigned(out, e->motion.yrel);
+            break;
+        case EVLOG_WHEEL:
+            eventLogPutSigned(out, e->wheel.x);
+            eventLogPutSigned(out, e->wheel.y);
+            fputc((int)e->wheel.direction, out);
+            break;
+        case EVLOG_WINDOW:
+            fputc(e->window.event, out);
+            eventLogPutSigned(out, e->window.data1);
+            eventLogPutSigned(out, e->window.data2);
+            break;
+    }
+    log->events++;
+}
+
+// Start a new segment at the current frame; "" leaves it untimed
+static inline void eventLogMark(EventLog* log, const char* label) {
+    size_t len = strlen(label);
+    if (len >= sizeof(log->label)) len = sizeof(log->label) - 1;
+    eventLogPutVarint(log->out, log->frame - log->lastFrame);
+    log->lastFrame = log->frame;
+    fputc(EVLOG_MARK, log->out);
+    fputc((int)len, log->out);
+    fwrite(label, 1, len, log->out);
+}
+
+// Decode the record at pos into next; returns 0 at the end or on a bad record
+static inline int eventLogDecode(EventLog* log) {
+    unsigned long long delta, u;
+    int x, y;
+    if (!eventLogGetVarint(log, &delta) || log->pos >= log->in.size) return 0;
+    int kind = log->in.data[log->pos++];
+
+    SDL_Event* e = &log->next;
+    memset(e, 0, sizeof(*e));
+    log->nextMark = 0;
+    switch (kind) {
+        case EVLOG_QUIT:
+            e->type = SDL_QUIT;
+            break;
+        case EVLOG_KEY_DOWN:
+        case EVLOG_KEY_UP:
+            e->type = kind == EVLOG_KEY_DOWN ? SDL_KEYDOWN : SDL_KEYUP;
+            e->key.state = kind == EVLOG_KEY_DOWN ? SDL_PRESSED : SDL_RELEASED;
+            if (!eventLogGetVarint(log, &u)) return 0;
+            e->key.keysym.sym = (SDL_Keycode)u;
+            if (!eventLogGetVarint(log, &u)) return 0;
+            e->key.keysym.scancode = (SDL_Scancode)u;
+            if (!eventLogGetVarint(log, &u)) return 0;
+            e->key.keysym.mod = (Uint16)u;
+            if (log->pos >= log->in.size) return 0;
+            e->key.repeat = log->in.data[log->pos++];
+            break;
+        case EVLOG_TEXT: {
+            if (log->pos >= log->in.size) return 0;
+            size_t len = log->in.data[log->pos++];
+            if (len >= sizeof(e->text.text) || log->pos + len > log->in.size) return 0;
+            e->type = SDL_TEXTINPUT;
+            memcpy(e->text.text, log->in.data + log->pos, len);
+            log->pos += len;
+            break;
+        }
+        case EVLOG_BUTTON_DOWN:
+        case EVLOG_BUTTON_UP:
+            e->type = kind == EVLOG_BUTTON_DOWN ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+            e->button.state = kind == EVLOG_BUTTON_DOWN ? SDL_PRESSED : SDL_RELEASED;
+            if (log->pos + 2 > log->in.size) return 0;
+            e->button.button = log->in.data[log->pos++];
+            e->button.clicks = log->in.data[log->pos++];
+            if (!eventLogGetSigned(log, &x) || !eventLogGetSigned(log, &y)) return 0;
+            e->button.x = x;
+            e->button.y = y;
+            break;
+        case EVLOG_MOTION:
+            e->type = SDL_MOUSEMOTION;
+            if (!eventLogGetVarint(log, &u)) return 0;
+            e->motion.state = (Uint32)u;
+            if (!eventLogGetSigned(log, &x) || !eventLogGetSigned(log, &y)) return 0;
+            e->motion.x = x;
+            e->motion.y = y;
+            if (!eventLogGetSigned(log, &x) || !eventLogGetSigned(log, &y)) return 0;
+            e->motion.xrel = x;
+            e->motion.yrel = y;
+            break;
+        case EVLOG_WHEEL:
+            e->type = SDL_MOUSEWHEEL;
+            if (!eventLogGetSigned(log, &x) || !eventLogGetSigned(log, &y)) return 0;
+            e->wheel.x = x;
+            e->wheel.y = y;
+            if (log->pos >= log->in.size) return 0;
+            e->wheel.direction = log->in.data[log->pos++];
+            break;
+        case EVLOG_WINDOW:
+            e->type = SDL_WINDOWEVENT;
+            if (log->pos >= log->in.size) return 0;
+            e->window.event = log->in.data[log->pos++];
+            if (!eventLogGetSigned(log, &x) || !eventLogGetSigned(log, &y)) return 0;
+            e->window.data1 = x;
+            e->window.data2 = y;
+            break;
+        case EVLOG_MARK: {
+            if (log->pos >= log->in.size) return 0;
+            size_t len = log->in.data[log->pos++];
+            if (len >= sizeof(log->nextLabel) || log->pos + len > log->in.size) return 0;
+            memcpy(log->nextLabel, log->in.data + log->pos, len);
+            log->nextLabel[len] = '\0';
+            log->pos += len;
+            log->nextMark = 1;
+            break;
+        }
+        default:
+            return 0;
+    }
+
+    log->nextFrame += (unsigned)delta;
+    return 1;
+}
+
+// Print the timings of the segment that just ended
+static inline void eventLogEndSegment(EventLog* log) {
+    if (log->label[0] && log->segment.count > 0) {
+        char summary[160];
+        frameStatsFormat(&log->segment, summary, sizeof(summary));
+        printf("  %-12s %s\n", log->label, summary);
+    }
+    log->segment.count = 0;
+}
+
+// Replay: the next event due in the current frame. Once the log is used
+// up a single SDL_QUIT ends the session.
+static inline int eventLogNext(EventLog* log, SDL_Event* e) {
+    for (;;) {
+        if (!log->hasNext) {
+            log->hasNext = eventLogDecode(log);
+            if (!log->hasNext) {
+                if (log->quitSent) return 0;
+                log->quitSent = 1;
+                memset(e, 0, sizeof(*e));
+                e->type = SDL_QUIT;
+                e->common.timestamp = log->frame * EVENT_LOG_FRAME_MS;
+                return 1;
+            }
+        }
+        if (log->nextFrame > log->frame) return 0;
+        log->hasNext = 0;
+
+        if (!log->nextMark) break;
+        eventLogEndSegment(log);
+        memcpy(log->label, log->nextLabel, sizeof(log->label));
+        log->marked = 1;
+    }
+
+    *e = log->next;
+    e->common.timestamp = log->frame * EVENT_LOG_FRAME_MS;
+    log->events++;
+    if (e->type == SDL_QUIT) log->quitSent = 1;
+    return 1;
+}
+
+// End of a frame; during replay also times it
+static inline void eventLogEndFrame(EventLog* log) {
+    log->frame++;
+    if (log->mode != EVENT_LOG_REPLAY) return;
+    Uint64 now = SDL_GetPerformanceCounter();
+    double ms = (now - log->frameStart) * 1000.0 / SDL_GetPerformanceFrequency();
+    log->frameStart = now;
+    if (log->marked && !log->label[0]) return;
+    frameStatsAdd(&log->stats, ms);
+    frameStatsAdd(&log->segment, ms);
+}
+
+// Finish the file, or print the replay timings (and write them per frame
+// to csvPath if given)
+static inline void eventLogClose(EventLog* log, const char* csvPath) {
+    if (log->mode == EVENT_LOG_RECORD) {
+        fclose(log->out);
+        printf("Recorded %d events over %u frames\n", log->events, log->frame);
+    } else if (log->mode == EVENT_LOG_REPLAY) {
+        eventLogEndSegment(log);
+        char summary[160];
+        frameStatsFormat(&log->stats, summary, sizeof(summary));
+        printf("Replayed %d events: %s\n", log->events, summary);
+        if (csvPath && !frameStatsWrite(&log->stats, csvPath)) {
+            printf("Error writing %s\n", csvPath);
+        }
+        mappedFileClose(&log->in);
+        frameStatsFree(&log->stats);
+        frameStatsFree(&log->segment);
+    }
+    memset(log, 0, sizeof(*log));
+}
+
+#endif
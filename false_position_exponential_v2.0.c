@@ -3,24 +3,21 @@
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
+#include "frame_hud.h"
+#include "trace_events.h"
+#include "iteration_table.h"
+#include "solve_worker.h"
+#include "app_host.h"
+#include "root_solvers.h"
+#include "graph_view.h"
+#include "raster_canvas.h"
+#include "root_polish.h"
 
-#define MAX_ITER 100
+#define MAX_ITER 100          // default budget; a stop spec may raise it
 #define TOLERANCE 0.0001
 #define WINDOW_WIDTH 1400
 #define WINDOW_HEIGHT 800
 
-// Data structure for storing iteration results
-typedef struct {
-    int iteration;
-    double x0;
-    double x1;
-    double x2;
-    double fx0;
-    double fx1;
-    double fx2;
-    double error;
-} IterationRow;
-
 // UI component structures
 typedef struct {
     SDL_Rect rect;
@@ -36,13 +33,29 @@ typedef struct {
     int clicked;
 } Button;
 
+// What the tab shows, kept while the user is on other tabs (appHostTabState)
+typedef struct {
+    int saved;
+    char values[4][50];
+    char resultText[500];
+    double finalRoot;
+    int hasValidRoot;
+    double coefA, coefB;
+    RootProblemDD precise;
+    int preciseOk;
+    int polishMode;
+    char polishText[128];
+    int tableScrollOffset;
+    IterationTable table;
+} FalsePositionState;
+
 // Original exponential function f(x) = e^x - ax - b
-double f(double x, double a, double b) {
+static double f(double x, double a, double b) {
     return exp(x) - a * x - b;
 }
 
 // Format equation with proper notation
-void formatEquation(char* buffer, int a, int b) {
+static void formatEquation(char* buffer, int a, int b) {
     char part1[50], part2[50];
     
     if (a == 0) {
@@ -69,136 +82,142 @@ void formatEquation(char* buffer, int a, int b) {
 }
 
 // Render text with UTF-8 support for Unicode characters
-void renderText(SDL_Renderer* renderer, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
+// (the draw list frees the texture once the frame is submitted)
+static void renderText(DrawList* draw, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
     SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, color);
     if (!surface) return;
     
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
     SDL_Rect rect = {x, y, surface->w, surface->h};
-    SDL_RenderCopy(renderer, texture, NULL, &rect);
+    drawListTexture(draw, texture, NULL, &rect, 1);
     
     SDL_FreeSurface(surface);
-    SDL_DestroyTexture(texture);
 }
 
 // Render input box with label and value
-void renderInputBox(SDL_Renderer* renderer, TTF_Font* font, InputBox* box) {
+static void renderInputBox(DrawList* draw, TTF_Font* font, InputBox* box) {
+    SDL_Color fill;
     if (box->active) {
-        SDL_SetRenderDrawColor(renderer, 255, 248, 220, 255);
+        fill = (SDL_Color){255, 248, 220, 255};
     } else {
-        SDL_SetRenderDrawColor(renderer, 255, 252, 235, 255);
+        fill = (SDL_Color){255, 252, 235, 255};
     }
-    SDL_RenderFillRect(renderer, &box->rect);
+    drawListFillRect(draw, &box->rect, fill);
     
-    SDL_SetRenderDrawColor(renderer, 200, 160, 40, 255);
-    SDL_RenderDrawRect(renderer, &box->rect);
+    drawListRect(draw, &box->rect, (SDL_Color){200, 160, 40, 255});
     
     SDL_Color labelColor = {130, 90, 0, 255};
-    renderText(renderer, font, box->label, box->rect.x - 80, box->rect.y + 5, labelColor);
+    renderText(draw, font, box->label, box->rect.x - 80, box->rect.y + 5, labelColor);
     
     SDL_Color textColor = {80, 50, 0, 255};
     if (strlen(box->value) > 0) {
-        renderText(renderer, font, box->value, box->rect.x + 5, box->rect.y + 5, textColor);
+        renderText(draw, font, box->value, box->rect.x + 5, box->rect.y + 5, textColor);
     }
 }
 
 // Render button with hover and click effects
-void renderButton(SDL_Renderer* renderer, TTF_Font* font, Button* btn) {
+static void renderButton(DrawList* draw, TTF_Font* font, Button* btn) {
+    SDL_Color fill;
     if (btn->clicked) {
-        SDL_SetRenderDrawColor(renderer, 180, 130, 0, 255);
+        fill = (SDL_Color){180, 130, 0, 255};
     } else if (btn->hovered) {
-        SDL_SetRenderDrawColor(renderer, 220, 170, 20, 255);
+        fill = (SDL_Color){220, 170, 20, 255};
     } else {
-        SDL_SetRenderDrawColor(renderer, 200, 160, 40, 255);
+        fill = (SDL_Color){200, 160, 40, 255};
     }
-    SDL_RenderFillRect(renderer, &btn->rect);
+    drawListFillRect(draw, &btn->rect, fill);
     
-    SDL_SetRenderDrawColor(renderer, 150, 110, 0, 255);
-    SDL_RenderDrawRect(renderer, &btn->rect);
+    drawListRect(draw, &btn->rect, (SDL_Color){150, 110, 0, 255});
     
     SDL_Color textColor = {255, 255, 255, 255};
     SDL_Surface* surface = TTF_RenderText_Blended(font, btn->text, textColor);
     if (surface) {
         int textX = btn->rect.x + (btn->rect.w - surface->w) / 2;
         int textY = btn->rect.y + (btn->rect.h - surface->h) / 2;
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+        SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
         SDL_Rect textRect = {textX, textY, surface->w, surface->h};
-        SDL_RenderCopy(renderer, texture, NULL, &textRect);
+        drawListTexture(draw, texture, NULL, &textRect, 1);
         SDL_FreeSurface(surface);
-        SDL_DestroyTexture(texture);
     }
 }
 
-// Draw exponential curve with axes, grid, and root marker
-void drawGraph(SDL_Renderer* renderer, double a, double b, double root, int hasRoot) {
-    int graphX = 980;
-    int graphY = 220;
-    int graphW = 400;
-    int graphH = 440;
-    int scale = 50;
-    int centerX = graphX + graphW / 2;
-    int centerY = graphY + graphH / 2;
-    
-    SDL_SetRenderDrawColor(renderer, 255, 252, 235, 255);
-    SDL_Rect graphRect = {graphX, graphY, graphW, graphH};
-    SDL_RenderFillRect(renderer, &graphRect);
-    
-    SDL_SetRenderDrawColor(renderer, 240, 220, 180, 255);
-    for (int i = graphX; i <= graphX + graphW; i += 50) {
-        SDL_RenderDrawLine(renderer, i, graphY, i, graphY + graphH);
-    }
-    for (int i = graphY; i <= graphY + graphH; i += 50) {
-        SDL_RenderDrawLine(renderer, graphX, i, graphX + graphW, i);
-    }
+// False position solve run on a worker thread
+// params: a, b, x0, x1 (bracket); spec: stop rules; rows: x0, x1, x2, f(x2), error
+static void falsePositionJob(SolveJob* job) {
+    RootProblem problem = {PROBLEM_EXPONENTIAL, job->params[0], job->params[1], 0};
+    RootSolver solver;
+    solverInit(&solver, SOLVER_FALSE_POSITION, &problem, job->params[2], job->params[3], TOLERANCE, MAX_ITER);
+    stopPolicyParse(&solver.stop, job->spec);
     
-    SDL_SetRenderDrawColor(renderer, 180, 140, 20, 255);
-    SDL_RenderDrawLine(renderer, centerX, graphY, centerX, graphY + graphH);
-    SDL_RenderDrawLine(renderer, graphX, centerY, graphX + graphW, centerY);
+    SessionTrace trace;
+    sessionTraceBegin(&trace, job->session, &solver);
     
-    SDL_SetRenderDrawColor(renderer, 200, 150, 0, 255);
-    for (int px = graphX; px < graphX + graphW; px++) {
-        double x = (px - centerX) / (double)scale;
-        double y = f(x, a, b);
-        int py = centerY - (int)(y * 20);
-        
-        if (py >= graphY && py < graphY + graphH && fabs(y) < 50) {
-            SDL_RenderDrawPoint(renderer, px, py);
-            SDL_RenderDrawPoint(renderer, px, py + 1);
+    SolverRow row;
+    int status;
+    do {
+        status = solverStep(&solver, &row);
+        sessionTraceAdd(&trace, &row);
+        if (row.count && !solveJobRow(job, row.n, row.v, row.count)) {
+            sessionTraceFree(&trace);
+            solveJobFinish(job, SOLVE_CANCELLED, 0);
+            return;
         }
-    }
+    } while (status == SOLVER_RUNNING);
+    sessionLogSolve(job->session, &solver, &trace);
     
-    if (hasRoot) {
-        SDL_SetRenderDrawColor(renderer, 200, 80, 0, 255);
-        int root_x = centerX + (int)(root * scale);
-        for (int i = -8; i <= 8; i++) {
-            for (int j = -8; j <= 8; j++) {
-                if (i*i + j*j <= 64) {
-                    SDL_RenderDrawPoint(renderer, root_x + i, centerY + j);
-                }
-            }
-        }
+    if (status == SOLVER_CONVERGED) {
+        sprintf(job->message, "SUCCESS!\nRoot: x = %.6f\nIterations: %d", solver.root, solver.n);
+    } else {
+        sprintf(job->message, "FAILED: %s after %d iterations\nTry different initial guesses",
+                solverFailureName(solver.failure), solver.n);
     }
+    solverAppendCost(job->message, sizeof(job->message), &solver.cost);
+    solveJobFinish(job, status == SOLVER_CONVERGED ? SOLVE_CONVERGED : SOLVE_FAILED, solver.root);
 }
 
-int main(int argc, char* argv[]) {
-    SDL_Init(SDL_INIT_VIDEO);
-    TTF_Init();
+// Draw exponential curve with axes, grid, and root marker
+// The view pans and zooms; the curve itself comes from its tile cache
+static void drawGraph(DrawList* draw, GraphView* view, RasterCanvas* marks, double a, double b, double root, int hasRoot) {
+    SDL_Renderer* renderer = draw->renderer;
+    drawListFillRect(draw, &view->rect, (SDL_Color){255, 252, 235, 255});
+    graphDrawGrid(draw, view, 50, (SDL_Color){240, 220, 180, 255});
+    graphDrawAxes(draw, view, (SDL_Color){180, 140, 20, 255});
+    drawListFlush(draw);
     
-    SDL_Window* window = SDL_CreateWindow("False Position Method - Exponential",
-        SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
-        WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_SHOWN);
+    RootProblem problem = {PROBLEM_EXPONENTIAL, a, b, 0};
+    graphViewSetProblem(view, &problem);
+    graphViewRender(renderer, view);
     
-    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    // Root marker, redrawn only when the view or the root moves
+    double key[] = {view->cx, view->cy, graphPpuX(view), graphPpuY(view), root, hasRoot};
+    if (canvasBegin(marks, key, sizeof(key))) {
+        canvasClear(marks, 0);
+        if (hasRoot) {
+            canvasDisc(marks, graphToScreenX(view, root) - view->rect.x + 0.5,
+                       graphToScreenY(view, 0) - view->rect.y + 0.5, 8.5, 0xFFC85000);
+        }
+    }
+    canvasRender(renderer, marks, view->rect.x, view->rect.y);
+}
+
+static void falsePositionStateFree(void* state) {
+    FalsePositionState* saved = state;
+    if (saved->saved) tableFree(&saved->table);
+}
+
+int falsePositionRun(AppHost* host) {
+    SDL_Renderer* renderer = host->renderer;
+    DrawList* draw = &host->draw;
     
     // Load fonts
-    TTF_Font* font = TTF_OpenFont("font.ttf", 18);
-    TTF_Font* fontSmall = TTF_OpenFont("font.ttf", 14);
-    TTF_Font* fontMedium = TTF_OpenFont("font.ttf", 16);
-    TTF_Font* fontLarge = TTF_OpenFont("font.ttf", 20);
-    TTF_Font* fontTitle = TTF_OpenFont("font.ttf", 24);
-    
-    if (!font || !fontSmall || !fontMedium || !fontLarge || !fontTitle) {
-        printf("Error loading font: %s\n", TTF_GetError());
+    TTF_Font* font = appHostFont(host, 18);
+    TTF_Font* fontSmall = appHostFont(host, 14);
+    TTF_Font* fontMedium = appHostFont(host, 16);
+    TTF_Font* fontLarge = appHostFont(host, 20);
+    TTF_Font* fontTitle = appHostFont(host, 24);
+    
+    FalsePositionState* saved = appHostTabState(host, sizeof(FalsePositionState), falsePositionStateFree);
+    if (!font || !fontSmall || !fontMedium || !fontLarge || !fontTitle || !saved) {
         return 1;
     }
     
@@ -208,29 +227,86 @@ int main(int argc, char* argv[]) {
     for (int i = 0; i < 4; i++) {
         inputs[i].rect = (SDL_Rect){140, 230 + i * 60, 150, 35};
         strcpy(inputs[i].label, labels[i]);
-        strcpy(inputs[i].value, "");
+        strcpy(inputs[i].value, saved->saved ? saved->values[i] : "");
         inputs[i].active = 0;
     }
     
+    // Inputs handed over by another tab, e.g. a cell picked in the sweep
+    for (int i = 0; i < 4; i++) {
+        appHostPreset(host, i, inputs[i].value, sizeof(inputs[i].value));
+    }
+    
     Button computeBtn = {{50, 490, 120, 40}, "COMPUTE", 0, 0};
     Button clearBtn = {{190, 490, 120, 40}, "CLEAR", 0, 0};
     
+    // Iteration table (rows formatted once per solve)
+    const int tableColumns[] = {10, 60, 160, 260, 360, 480};
+    IterationTable table;
+    if (saved->saved) {
+        table = saved->table;
+    } else {
+        tableInit(&table, fontSmall, 600, 25, 3, 6, tableColumns, (SDL_Color){60, 40, 10, 255},
+                  (SDL_Color){255, 252, 235, 255}, (SDL_Color){250, 245, 220, 255});
+    }
+    
     // State variables
     char resultText[500] = "Enter coefficients and initial guesses (x0 and x1)";
     double finalRoot = 0;
     int hasValidRoot = 0;
     double coefA = 0, coefB = 0;
-    IterationRow iterations[MAX_ITER];
+    
+    // Root polished to ~30 digits in double-double, toggled with F4
+    RootProblemDD precise;
+    int preciseOk = 0;
+    int polishMode = 0;
+    char polishText[128] = "";
     int totalIterations = 0;
     
     int activeInput = -1;
     int quit = 0;
     int tableScrollOffset = 0;
+    
+    // Back on this tab: show what it showed when the user left
+    if (saved->saved) {
+        strcpy(resultText, saved->resultText);
+        finalRoot = saved->finalRoot;
+        hasValidRoot = saved->hasValidRoot;
+        coefA = saved->coefA;
+        coefB = saved->coefB;
+        precise = saved->precise;
+        preciseOk = saved->preciseOk;
+        polishMode = saved->polishMode;
+        strcpy(polishText, saved->polishText);
+        tableScrollOffset = saved->tableScrollOffset;
+        totalIterations = table.rowCount;
+    }
+    
+    // Solves run on the host's worker pool and stream their rows back,
+    // with this tab's stop rules (F6)
+    SolveWorkerPool* pool = &host->pool;
+    appHostUseStopRules(host);
+    SolveJob* activeJob = NULL;
+    
+    // Pannable graph; curve tiles are rasterized on a background thread
+    GraphView graphView;
+    graphViewInit(&graphView, (SDL_Rect){980, 220, 400, 440}, (SDL_Color){200, 150, 0, 255}, 2);
+    graphViewFrame(&graphView, -4, 4, -11, 11);
+    RasterCanvas markCanvas;
+    canvasInit(&markCanvas, renderer, graphView.rect.w, graphView.rect.h);
+    
+    // Frame timing overlay, toggled with F3
+    FrameHud hud;
+    hudInit(&hud);
     SDL_Event e;
     
     // Main event loop
-    while (!quit) {
-        while (SDL_PollEvent(&e)) {
+    while (!quit && !appHostSwitching(host)) {
+        hudBeginFrame(&hud);
+        
+        while (appHostPollEvent(host, &e)) {
+            if (appHostEvent(host, &e)) continue;
+            if (graphViewHandleEvent(&graphView, &e)) continue;
+            
             if (e.type == SDL_QUIT) {
                 quit = 1;
             }
@@ -253,67 +329,61 @@ int main(int argc, char* argv[]) {
                     my >= computeBtn.rect.y && my <= computeBtn.rect.y + computeBtn.rect.h) {
                     computeBtn.clicked = 1;
                     
-                    // Parse input values
-                    coefA = atof(inputs[0].value);
-                    coefB = atof(inputs[1].value);
-                    double x0 = atof(inputs[2].value);
-                    double x1 = atof(inputs[3].value);
-                    
-                    double fx0 = f(x0, coefA, coefB);
-                    double fx1 = f(x1, coefA, coefB);
-                    
-                    // Check bracketing condition
-                    if (fx0 * fx1 >= 0) {
-                        sprintf(resultText, "ERROR: f(x0) and f(x1) must have opposite signs!\nf(%.2f)=%.4f, f(%.2f)=%.4f", 
-                                x0, fx0, x1, fx1);
-                        hasValidRoot = 0;
-                        totalIterations = 0;
+                    if (activeJob) {
+                        // Button reads CANCEL while a solve is running
+                        solveJobCancel(activeJob);
+                        solveJobRelease(activeJob);
+                        activeJob = NULL;
+                        strcpy(computeBtn.text, "COMPUTE");
+                        sprintf(resultText, "CANCELLED after %d iterations\nPress COMPUTE to start again", totalIterations);
                     } else {
+                        // Parse input values
+                        coefA = atof(inputs[0].value);
+                        coefB = atof(inputs[1].value);
+                        preciseOk = polishProblemParse(&precise, PROBLEM_EXPONENTIAL, inputs[0].value, inputs[1].value, NULL);
+                        double x0 = atof(inputs[2].value);
+                        double x1 = atof(inputs[3].value);
+                        
+                        double fx0 = f(x0, coefA, coefB);
+                        double fx1 = f(x1, coefA, coefB);
+                        
                         totalIterations = 0;
                         hasValidRoot = 0;
+                        tableScrollOffset = 0;
+                        tableClear(&table);
+                        polishDescribe(polishText, sizeof(polishText), "\n", polishMode, NULL, 0, 0);
                         
-                        // False Position Algorithm
-                        for (int iter = 0; iter < MAX_ITER; iter++) {
-                            double x2 = x1 - fx1 * (x1 - x0) / (fx1 - fx0);
-                            double fx2 = f(x2, coefA, coefB);
-                            double error = fabs(fx2);
-                            
-                            iterations[iter].iteration = iter + 1;
-                            iterations[iter].x0 = x0;
-                            iterations[iter].x1 = x1;
-                            iterations[iter].x2 = x2;
-                            iterations[iter].fx0 = fx0;
-                            iterations[iter].fx1 = fx1;
-                            iterations[iter].fx2 = fx2;
-                            iterations[iter].error = error;
-                            totalIterations++;
-                            
-                            if (error < TOLERANCE) {
-                                hasValidRoot = 1;
-                                finalRoot = x2;
-                                sprintf(resultText, "SUCCESS!\nRoot: x = %.6f\nIterations: %d", x2, iter + 1);
-                                break;
-                            }
-                            
-                            // Update interval
-                            if (fx0 * fx2 < 0) {
-                                x1 = x2;
-                                fx1 = fx2;
-                            } else {
-                                x0 = x2;
-                                fx0 = fx2;
+                        // Check bracketing condition
+                        if (fx0 * fx1 >= 0) {
+                            sprintf(resultText, "ERROR: f(x0) and f(x1) must have opposite signs!\nf(%.2f)=%.4f, f(%.2f)=%.4f", 
+                                    x0, fx0, x1, fx1);
+                        } else {
+                            // False Position runs on the worker pool
+                            activeJob = solveJobCreate(falsePositionJob);
+                            if (activeJob) {
+                                activeJob->params[0] = coefA;
+                                activeJob->params[1] = coefB;
+                                activeJob->params[2] = x0;
+                                activeJob->params[3] = x1;
+                                snprintf(activeJob->spec, sizeof(activeJob->spec), "%s", appHostStopSpec(host));
+                                activeJob->session = &host->session;
+                                solvePoolSubmit(pool, activeJob);
+                                strcpy(computeBtn.text, "CANCEL");
+                                strcpy(resultText, "Solving...");
                             }
                         }
-                        
-                        if (!hasValidRoot) {
-                            sprintf(resultText, "FAILED: Did not converge\nTry different initial guesses");
-                        }
                     }
                 }
                 
                 // Clear button: Reset all inputs and state
                 if (mx >= clearBtn.rect.x && mx <= clearBtn.rect.x + clearBtn.rect.w &&
                     my >= clearBtn.rect.y && my <= clearBtn.rect.y + clearBtn.rect.h) {
+                    if (activeJob) {
+                        solveJobCancel(activeJob);
+                        solveJobRelease(activeJob);
+                        activeJob = NULL;
+                        strcpy(computeBtn.text, "COMPUTE");
+                    }
                     for (int i = 0; i < 4; i++) {
                         strcpy(inputs[i].value, "");
                     }
@@ -321,6 +391,8 @@ int main(int argc, char* argv[]) {
                     hasValidRoot = 0;
                     totalIterations = 0;
                     tableScrollOffset = 0;
+                    tableClear(&table);
+                    polishDescribe(polishText, sizeof(polishText), "\n", polishMode, NULL, 0, 0);
                     clearBtn.clicked = 1;
                 }
             }
@@ -353,6 +425,16 @@ int main(int argc, char* argv[]) {
                 }
             }
             
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F3) {
+                hudToggle(&hud);
+            }
+            
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F4) {
+                polishMode = !polishMode;
+                polishDescribe(polishText, sizeof(polishText), "\n", polishMode,
+                               preciseOk ? &precise : NULL, hasValidRoot, finalRoot);
+            }
+            
             if (e.type == SDL_KEYDOWN && activeInput >= 0) {
                 if (e.key.keysym.sym == SDLK_BACKSPACE) {
                     int len = strlen(inputs[activeInput].value);
@@ -376,48 +458,87 @@ int main(int argc, char* argv[]) {
             }
         }
         
+        hudPhase(&hud, HUD_SOLVE);
+        
+        // Drain rows streamed back from the solver worker
+        if (activeJob) {
+            SolveMessage msg;
+            int budget = SOLVE_DRAIN_BUDGET;
+            while (activeJob && budget-- > 0 && solveJobPop(activeJob, &msg)) {
+                if (msg.type == SOLVE_MSG_ROW) {
+                    // Rows go straight into the table, which grows as needed
+                    int row = tableAppendRow(&table);
+                    if (row < 0) continue;
+                    totalIterations = table.rowCount;
+                    tableSetCell(&table, row, 0, "%d", msg.n);
+                    tableSetCell(&table, row, 1, "%.3lf", msg.v[0]);
+                    tableSetCell(&table, row, 2, "%.3lf", msg.v[1]);
+                    tableSetCell(&table, row, 3, "%.3lf", msg.v[2]);
+                    tableSetCell(&table, row, 4, "%.3lf", msg.v[3]);
+                    tableSetCell(&table, row, 5, "%.3lf", msg.v[4]);
+                    sprintf(resultText, "Solving...\nIterations so far: %d", totalIterations);
+                } else if (msg.type == SOLVE_MSG_DONE) {
+                    strcpy(resultText, activeJob->message);
+                    if (activeJob->status == SOLVE_CONVERGED) {
+                        finalRoot = activeJob->root;
+                        hasValidRoot = 1;
+                    }
+                    polishDescribe(polishText, sizeof(polishText), "\n", polishMode,
+                                   preciseOk ? &precise : NULL, hasValidRoot, finalRoot);
+                    solveJobRelease(activeJob);
+                    activeJob = NULL;
+                    strcpy(computeBtn.text, "COMPUTE");
+                }
+            }
+        }
+        
         // Clear screen
+        hudPhase(&hud, HUD_TEXT);
         SDL_SetRenderDrawColor(renderer, 255, 250, 230, 255);
-        SDL_RenderClear(renderer);
+        hudRenderClear(renderer);
         
         // Render header information (centered at top)
         SDL_Color headerColor = {153, 102, 0, 255};
-        renderText(renderer, fontTitle, "MT211 - Numerical Method", 500, 15, headerColor);
-        renderText(renderer, fontLarge, "Semestral Project", 560, 45, headerColor);
+        renderText(draw, fontTitle, "MT211 - Numerical Method", 500, 15, headerColor);
+        renderText(draw, fontLarge, "Semestral Project", 560, 45, headerColor);
         
         SDL_Color submittedColor = {160, 120, 0, 255};
-        renderText(renderer, fontLarge, "Submitted By:", 575, 75, submittedColor);
-        renderText(renderer, fontLarge, "BSCPE 22001", 575, 100, submittedColor);
-        renderText(renderer, fontLarge, "Kerlstein Aleizon Codoy", 545, 125, submittedColor);
-        renderText(renderer, fontLarge, "Maria Angela Mendoza", 545, 150, submittedColor);
+        renderText(draw, fontLarge, "Submitted By:", 575, 75, submittedColor);
+        renderText(draw, fontLarge, "BSCPE 22001", 575, 100, submittedColor);
+        renderText(draw, fontLarge, "Kerlstein Aleizon Codoy", 545, 125, submittedColor);
+        renderText(draw, fontLarge, "Maria Angela Mendoza", 545, 150, submittedColor);
         
         SDL_Color titleColor = {153, 102, 0, 255};
-        renderText(renderer, fontTitle, "FALSE POSITION METHOD", 20, 40, titleColor);
+        renderText(draw, fontTitle, "FALSE POSITION METHOD", 20, 40, titleColor);
         
         SDL_Color subtitleColor = {160, 120, 0, 255};
-        renderText(renderer, fontLarge, "Exponential Equation: eˣ - ax - b = 0", 30, 75, subtitleColor);
+        renderText(draw, fontLarge, "Exponential Equation: eˣ - ax - b = 0", 30, 75, subtitleColor);
         
         // Render input section
         SDL_Color sectionColor = {153, 102, 0, 255};
-        renderText(renderer, font, "INPUT:", 55, 180, sectionColor);
+        renderText(draw, font, "INPUT:", 55, 180, sectionColor);
         
         for (int i = 0; i < 4; i++) {
-            renderInputBox(renderer, font, &inputs[i]);
+            renderInputBox(draw, font, &inputs[i]);
         }
         
-        renderButton(renderer, font, &computeBtn);
-        renderButton(renderer, font, &clearBtn);
+        renderButton(draw, font, &computeBtn);
+        renderButton(draw, font, &clearBtn);
         
-        renderText(renderer, font, "STATUS", 70, 600, sectionColor);
+        renderText(draw, font, "STATUS", 70, 600, sectionColor);
         
         if (strlen(resultText) > 0) {
-            char resultCopy[500];
+            char resultCopy[640];
             strcpy(resultCopy, resultText);
+            if (polishText[0]) {
+                strcat(resultCopy, "\n");
+                strcat(resultCopy, polishText);
+            }
             char* line = strtok(resultCopy, "\n");
             int y = 625;
             while (line) {
                 SDL_Color resultColor = hasValidRoot ? (SDL_Color){0, 128, 0, 255} : (SDL_Color){178, 34, 34, 255};
-                renderText(renderer, fontSmall, line, 80, y, resultColor);
+                renderText(draw, fontSmall, line, 80, y, resultColor);
                 y += 20;
                 line = strtok(NULL, "\n");
             }
@@ -425,67 +546,32 @@ int main(int argc, char* argv[]) {
         
         // Render iteration table
         if (totalIterations > 0) {
-            renderText(renderer, font, "ITERATION TABLE", 575, 200, sectionColor);
+            renderText(draw, font, "ITERATION TABLE", 575, 200, sectionColor);
             
-            SDL_SetRenderDrawColor(renderer, 200, 160, 40, 255);
             SDL_Rect tableHeader = {350, 230, 600, 30};
-            SDL_RenderFillRect(renderer, &tableHeader);
+            drawListFillRect(draw, &tableHeader, (SDL_Color){200, 160, 40, 255});
             
             SDL_Color headerColor2 = {255, 255, 255, 255};
-            renderText(renderer, fontSmall, "n", 360, 235, headerColor2);
-            renderText(renderer, fontSmall, "x0", 410, 235, headerColor2);
-            renderText(renderer, fontSmall, "x1", 510, 235, headerColor2);
-            renderText(renderer, fontSmall, "x2", 610, 235, headerColor2);
-            renderText(renderer, fontSmall, "f(x2)", 710, 235, headerColor2);
-            renderText(renderer, fontSmall, "Error", 830, 235, headerColor2);
+            renderText(draw, fontSmall, "n", 360, 235, headerColor2);
+            renderText(draw, fontSmall, "x0", 410, 235, headerColor2);
+            renderText(draw, fontSmall, "x1", 510, 235, headerColor2);
+            renderText(draw, fontSmall, "x2", 610, 235, headerColor2);
+            renderText(draw, fontSmall, "f(x2)", 710, 235, headerColor2);
+            renderText(draw, fontSmall, "Error", 830, 235, headerColor2);
             
             int maxVisibleRows = 10;
             int startRow = tableScrollOffset;
-            int endRow = startRow + maxVisibleRows;
-            if (endRow > totalIterations) endRow = totalIterations;
             
-            for (int i = startRow; i < endRow; i++) {
-                int displayIndex = i - startRow;
-                int y = 265 + displayIndex * 25;
-                
-                if (i % 2 == 0) {
-                    SDL_SetRenderDrawColor(renderer, 255, 252, 235, 255);
-                } else {
-                    SDL_SetRenderDrawColor(renderer, 250, 245, 220, 255);
-                }
-                SDL_Rect row = {350, y, 600, 25};
-                SDL_RenderFillRect(renderer, &row);
-                
-                SDL_Color textColor = {60, 40, 10, 255};
-                char buffer[50];
-                
-                sprintf(buffer, "%d", iterations[i].iteration);
-                renderText(renderer, fontSmall, buffer, 360, y + 3, textColor);
-                
-                sprintf(buffer, "%.3lf", iterations[i].x0);
-                renderText(renderer, fontSmall, buffer, 410, y + 3, textColor);
-                
-                sprintf(buffer, "%.3lf", iterations[i].x1);
-                renderText(renderer, fontSmall, buffer, 510, y + 3, textColor);
-                
-                sprintf(buffer, "%.3lf", iterations[i].x2);
-                renderText(renderer, fontSmall, buffer, 610, y + 3, textColor);
-                
-                sprintf(buffer, "%.3lf", iterations[i].fx2);
-                renderText(renderer, fontSmall, buffer, 710, y + 3, textColor);
-                
-                sprintf(buffer, "%.3lf", iterations[i].error);
-                renderText(renderer, fontSmall, buffer, 830, y + 3, textColor);
-            }
+            drawListFlush(draw);
+            tableRender(renderer, &table, 350, 265, startRow, maxVisibleRows);
             
             if (totalIterations > maxVisibleRows) {
                 int scrollbarX = 960;
                 int scrollbarY = 265;
                 int scrollbarHeight = maxVisibleRows * 25;
                 
-                SDL_SetRenderDrawColor(renderer, 240, 220, 180, 255);
                 SDL_Rect scrollbarTrack = {scrollbarX, scrollbarY, 10, scrollbarHeight};
-                SDL_RenderFillRect(renderer, &scrollbarTrack);
+                drawListFillRect(draw, &scrollbarTrack, (SDL_Color){240, 220, 180, 255});
                 
                 float thumbRatio = (float)maxVisibleRows / totalIterations;
                 int thumbHeight = (int)(scrollbarHeight * thumbRatio);
@@ -494,56 +580,94 @@ int main(int argc, char* argv[]) {
                 float scrollRatio = (float)tableScrollOffset / (totalIterations - maxVisibleRows);
                 int thumbY = scrollbarY + (int)((scrollbarHeight - thumbHeight) * scrollRatio);
                 
-                SDL_SetRenderDrawColor(renderer, 200, 160, 40, 255);
                 SDL_Rect scrollbarThumb = {scrollbarX, thumbY, 10, thumbHeight};
-                SDL_RenderFillRect(renderer, &scrollbarThumb);
+                drawListFillRect(draw, &scrollbarThumb, (SDL_Color){200, 160, 40, 255});
             }
         }
         
         // Render conclusion box with final results
         if (hasValidRoot) {
             int conclusionY = 550;
-            renderText(renderer, font, "CONCLUSION", 350, conclusionY, sectionColor);
+            renderText(draw, font, "CONCLUSION", 350, conclusionY, sectionColor);
             
-            SDL_SetRenderDrawColor(renderer, 255, 255, 230, 255);
             SDL_Rect conclusionBox = {350, conclusionY + 30, 600, 90};
-            SDL_RenderFillRect(renderer, &conclusionBox);
+            drawListFillRect(draw, &conclusionBox, (SDL_Color){255, 255, 230, 255});
             
-            SDL_SetRenderDrawColor(renderer, 200, 160, 40, 255);
-            SDL_RenderDrawRect(renderer, &conclusionBox);
+            drawListRect(draw, &conclusionBox, (SDL_Color){200, 160, 40, 255});
             
             SDL_Color conclusionColor = {130, 90, 0, 255};
             char buffer[200];
             
             formatEquation(buffer, (int)coefA, (int)coefB);
-            renderText(renderer, font, buffer, 360, conclusionY + 40, conclusionColor);
-            renderText(renderer, font, buffer, 361 , conclusionY + 40, conclusionColor);
+            renderText(draw, font, buffer, 360, conclusionY + 40, conclusionColor);
+            renderText(draw, font, buffer, 361 , conclusionY + 40, conclusionColor);
             
             sprintf(buffer, "Approximate Root: x = %.6lf", finalRoot);
-            renderText(renderer, font, buffer, 360, conclusionY + 65, conclusionColor);
-            renderText(renderer, font, buffer, 361, conclusionY + 65, conclusionColor);
+            renderText(draw, font, buffer, 360, conclusionY + 65, conclusionColor);
+            renderText(draw, font, buffer, 361, conclusionY + 65, conclusionColor);
             
             sprintf(buffer, "Total Iterations: %d   |   Tolerance: %.4lf", totalIterations, TOLERANCE);
-            renderText(renderer, font, buffer, 360, conclusionY + 90, conclusionColor);
-            renderText(renderer, font, buffer, 361, conclusionY + 90, conclusionColor);
+            renderText(draw, font, buffer, 360, conclusionY + 90, conclusionColor);
+            renderText(draw, font, buffer, 361, conclusionY + 90, conclusionColor);
+        }
+        
+        renderText(draw, font, "GRAPH", 970, 180, sectionColor);
+        hudPhase(&hud, HUD_GRAPH);
+        TRACE_SCOPE("drawGraph") {
+            drawGraph(draw, &graphView, &markCanvas, coefA, coefB, finalRoot, hasValidRoot);
         }
+        hudPhase(&hud, HUD_TEXT);
         
-        renderText(renderer, font, "GRAPH", 970, 180, sectionColor);
-        drawGraph(renderer, coefA, coefB, finalRoot, hasValidRoot);
+        appHostRenderTabs(host);
+        hudRender(renderer, fontSmall, &hud, WINDOW_WIDTH - 270, 10);
         
-        SDL_RenderPresent(renderer);
-        SDL_Delay(16);
+        hudPhase(&hud, HUD_PRESENT);
+        TRACE_SCOPE("SDL_RenderPresent") {
+            SDL_RenderPresent(renderer);
+        }
+        hudPhase(&hud, HUD_IDLE);
+        appHostEndFrame(host);
+    }
+    
+    // A solve still running is cancelled; everything else is kept for the
+    // next visit
+    if (activeJob) {
+        solveJobCancel(activeJob);
+        solveJobRelease(activeJob);
+        sprintf(resultText, "CANCELLED after %d iterations\nPress COMPUTE to start again", totalIterations);
     }
+    graphViewFree(&graphView);
+    canvasFree(&markCanvas);
     
-    TTF_CloseFont(font);
-    TTF_CloseFont(fontSmall);
-    TTF_CloseFont(fontMedium);
-    TTF_CloseFont(fontLarge);
-    TTF_CloseFont(fontTitle);
-    SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
-    TTF_Quit();
-    SDL_Quit();
+    for (int i = 0; i < 4; i++) {
+        strcpy(saved->values[i], inputs[i].value);
+    }
+    strcpy(saved->resultText, resultText);
+    saved->finalRoot = finalRoot;
+    saved->hasValidRoot = hasValidRoot;
+    saved->coefA = coefA;
+    saved->coefB = coefB;
+    saved->precise = precise;
+    saved->preciseOk = preciseOk;
+    saved->polishMode = polishMode;
+    strcpy(saved->polishText, polishText);
+    saved->tableScrollOffset = tableScrollOffset;
+    saved->table = table;
+    saved->saved = 1;
     
     return 0;
 }
+
+#ifndef METHODS_SUITE
+int main(int argc, char* argv[]) {
+    AppHost host;
+    if (appHostInit(&host, "False Position Method - Exponential", WINDOW_WIDTH, WINDOW_HEIGHT, NULL, 0) != 0) {
+        return 1;
+    }
+    
+    int result = falsePositionRun(&host);
+    
+    appHostFree(&host);
+    return result;
+}
+#endif
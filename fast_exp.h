@@ -0,0 +1,99 @@
+#ifndef FAST_EXP_H
+#define FAST_EXP_H
+
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+
+// Approximate e^x over arrays, for plotting only, never for a solver's
+// iterates. x = k ln2 + r with |r| <= ln2 / 2; e^r comes from a degree 10
+// polynomial fitted at Chebyshev nodes and 2^k is built straight into the
+// exponent bits. There are no branches or table lookups, so the loop
+// vectorizes (GCC needs -fno-trapping-math to turn the range selects into
+// masks).
+// Error: within 4 ulp of exp() for -708 <= x <= 709.78 (22M samples; 3 ulp
+// or less in all but a handful, all near -708). Below that the result
+// flushes to 0 instead of going subnormal, above it is INFINITY, and NaN
+// passes through.
+//
+// The kernel only beats libm with 256-bit vectors and FMA, which the
+// shipped x86-64 builds cannot assume, so fastExpArray checks the CPU at
+// run time: with AVX2 and FMA it runs the kernel compiled for them,
+// anywhere else it calls exp() and is exact. Measured on x86-64 with
+// glibc 2.36, per value: 0.8 ns against 3.1 ns for exp(); the same kernel
+// built for baseline SSE2 takes 3.7 ns. One value at a time it loses to
+// exp() even with FMA, since a solver's next x waits on the whole
+// polynomial, so there is no scalar form.
+
+#define FAST_EXP_MIN -708.0
+#define FAST_EXP_MAX 709.782712893384   // ln(DBL_MAX)
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FAST_EXP_DISPATCH
+#endif
+
+static inline double fastExpKernel(double x) {
+    const double log2e = 1.4426950408889634;
+    const double ln2Hi = 6.93147180369123816490e-01;   // ln2 split so k * ln2Hi is exact
+    const double ln2Lo = 1.90821492927058770002e-10;
+    const double shifter = 0x1.8p52;                     // rounds to an integer in the low bits
+
+    double t = x < FAST_EXP_MIN ? FAST_EXP_MIN : x;
+    t = t > FAST_EXP_MAX ? FAST_EXP_MAX : t;
+
+    double kd = t * log2e + shifter;
+    int64_t bits;
+    memcpy(&bits, &kd, sizeof(bits));
+    kd -= shifter;
+    double r = t - kd * ln2Hi - kd * ln2Lo;
+
+    double p = 0x1.28a2c273b03b9p-22;
+    p = p * r + 0x1.72faf2d7d210dp-19;
+    p = p * r + 0x1.a019a668bb4f4p-16;
+    p = p * r + 0x1.a01978c422e23p-13;
+    p = p * r + 0x1.6c16c17f44310p-10;
+    p = p * r + 0x1.1111112dd74dbp-7;
+    p = p * r + 0x1.55555555520adp-5;
+    p = p * r + 0x1.555555554b751p-3;
+    p = p * r + 0x1.0000000000005p-1;
+    p = p * r + 0x1.000000000001ep+0;
+    p = p * r + 1.0;
+
+    // k sits in the low bits of the shifted value; 2^(k-1) keeps k = 1024 in range
+    int64_t scaleBits = (bits - (int64_t)0x4338000000000000 + 1022) << 52;
+    double scale;
+    memcpy(&scale, &scaleBits, sizeof(scale));
+    double y = p * scale * 2;
+
+    y = x < FAST_EXP_MIN ? 0 : y;
+    y = x > FAST_EXP_MAX ? INFINITY : y;
+    return x != x ? x : y;
+}
+
+#ifdef FAST_EXP_DISPATCH
+__attribute__((target("avx2,fma"))) static inline void fastExpArrayAvx2(const double* x, double* out, int n) {
+    for (int i = 0; i < n; i++) {
+        out[i] = fastExpKernel(x[i]);
+    }
+}
+
+// Both are needed: the polynomial is contracted to FMAs
+static inline int fastExpHasAvx2(void) {
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+#endif
+
+// out[i] = e^x[i]; out may alias x
+static inline void fastExpArray(const double* x, double* out, int n) {
+#ifdef FAST_EXP_DISPATCH
+    if (fastExpHasAvx2()) {
+        fastExpArrayAvx2(x, out, n);
+        return;
+    }
+#endif
+    for (int i = 0; i < n; i++) {
+        out[i] = exp(x[i]);
+    }
+}
+
+#endif
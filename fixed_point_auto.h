@@ -0,0 +1,56 @@
+#ifndef FIXED_POINT_AUTO_H
+#define FIXED_POINT_AUTO_H
+
+#include <math.h>
+#include "root_problem.h"
+
+// Automatic choice among the fixed point rearrangements x = g(x).
+// Iteration settles on a root only where |g'| < 1, and the smaller |g'|
+// the faster, so each form's contraction is estimated around x0 by central
+// differences and only the contractive ones are worth running. The
+// estimate is local: a form that contracts at x0 can still wander off on
+// the way to the root, so the candidates are raced rather than trusted.
+
+#define FP_AUTO_FORMS 5
+#define FP_AUTO_MAX_CONTRACTION 1.0
+
+typedef struct {
+    int form;
+    double contraction;     // |g'| around x0; INFINITY outside the form's domain
+} FormEstimate;
+
+// |g'(x)| by central difference; INFINITY where g is not defined
+static inline double fixedPointSlope(const RootProblem* p, double x, int form, SolverCost* cost) {
+    double h = 1e-6 * fmax(1, fabs(x));
+    double up = problemG(p, x + h, form, cost);
+    double down = problemG(p, x - h, form, cost);
+    double slope = fabs(up - down) / (2 * h);
+    return isfinite(slope) ? slope : INFINITY;
+}
+
+// The larger slope at x0 and at the first iterate g(x0), so a form that
+// only contracts at the very start does not pass
+static inline double fixedPointContraction(const RootProblem* p, double x0, int form, SolverCost* cost) {
+    double x1 = problemG(p, x0, form, cost);
+    if (!isfinite(x1)) return INFINITY;
+    return fmax(fixedPointSlope(p, x0, form, cost), fixedPointSlope(p, x1, form, cost));
+}
+
+// Estimate every form at x0 into out[FP_AUTO_FORMS], most contractive
+// first. Returns how many are contractive.
+static inline int fixedPointRankForms(const RootProblem* p, double x0, FormEstimate* out, SolverCost* cost) {
+    int count = 0;
+    for (int form = 1; form <= FP_AUTO_FORMS; form++) {
+        FormEstimate e = {form, fixedPointContraction(p, x0, form, cost)};
+        int i = form - 1;
+        while (i > 0 && out[i - 1].contraction > e.contraction) {
+            out[i] = out[i - 1];
+            i--;
+        }
+        out[i] = e;
+        count += e.contraction < FP_AUTO_MAX_CONTRACTION;
+    }
+    return count;
+}
+
+#endif
@@ -0,0 +1,844 @@
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include "frame_hud.h"
+#include "trace_events.h"
+#include "iteration_table.h"
+#include "solve_worker.h"
+#include "app_host.h"
+#include "root_solvers.h"
+#include "graph_view.h"
+#include "raster_canvas.h"
+#include "root_polish.h"
+#include "fixed_point_race.h"
+
+#define MAX_ITER 50           // default budget; a stop spec may raise it
+#define TOLERANCE 0.01
+#define WINDOW_WIDTH 1400
+#define WINDOW_HEIGHT 800
+#define FORM_COUNT 5
+#define OPTION_COUNT (FORM_COUNT + 1)   // g1-g5 and auto
+
+// UI component structures
+typedef struct {
+    SDL_Rect rect;
+    char label[50];
+    char value[50];
+    int active;
+} InputBox;
+
+typedef struct {
+    SDL_Rect rect;
+    char text[50];
+    int hovered;
+    int clicked;
+} Button;
+
+typedef struct {
+    SDL_Rect rect;
+    char formula[100];
+    int selected;
+    int hovered;
+} MethodOption;
+
+// What the tab shows, kept while the user is on other tabs (appHostTabState)
+typedef struct {
+    int saved;
+    char values[3][50];
+    int selectedForm;       // 1-5, or 0 for auto
+    char resultText[500];
+    double finalRoot;
+    int hasValidRoot;
+    double coefA, coefB;
+    RootProblemDD precise;
+    int preciseOk;
+    int polishMode;
+    char polishText[128];
+    int tableScrollOffset;
+    IterationTable table;
+} FixedPointExpState;
+
+// Format equation with proper notation
+static void formatEquation(char* buffer, double a, double b) {
+    char part1[50], part2[50];
+    int aInt = (int)a;
+    int bInt = (int)b;
+    
+    if (aInt == 0) {
+        strcpy(part1, "");
+    } else if (aInt == 1) {
+        strcpy(part1, " - x");
+    } else if (aInt == -1) {
+        strcpy(part1, " + x");
+    } else if (aInt > 0) {
+        sprintf(part1, " - %dx", aInt);
+    } else {
+        sprintf(part1, " + %dx", -aInt);
+    }
+    
+    if (bInt == 0) {
+        strcpy(part2, "");
+    } else if (bInt > 0) {
+        sprintf(part2, " - %d", bInt);
+    } else {
+        sprintf(part2, " + %d", -bInt);
+    }
+    
+    sprintf(buffer, "Equation: eˣ%s%s = 0", part1, part2);
+}
+
+// Render text with UTF-8 support for Unicode characters
+// (the draw list frees the texture once the frame is submitted)
+static void renderText(DrawList* draw, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, color);
+    if (!surface) return;
+    
+    SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+    SDL_Rect rect = {x, y, surface->w, surface->h};
+    drawListTexture(draw, texture, NULL, &rect, 1);
+    
+    SDL_FreeSurface(surface);
+}
+
+// Render input box with label and value
+static void renderInputBox(DrawList* draw, TTF_Font* font, InputBox* box) {
+    SDL_Color fill;
+    if (box->active) {
+        fill = (SDL_Color){255, 240, 245, 255};
+    } else {
+        fill = (SDL_Color){255, 228, 235, 255};
+    }
+    drawListFillRect(draw, &box->rect, fill);
+    
+    drawListRect(draw, &box->rect, (SDL_Color){219, 112, 147, 255});
+    
+    SDL_Color labelColor = {50, 50, 50, 255};
+    renderText(draw, font, box->label, box->rect.x - 80, box->rect.y + 5, labelColor);
+    
+    SDL_Color textColor = {0, 0, 0, 255};
+    if (strlen(box->value) > 0) {
+        renderText(draw, font, box->value, box->rect.x + 5, box->rect.y + 5, textColor);
+    }
+}
+
+// Render button with hover and click effects
+static void renderButton(DrawList* draw, TTF_Font* font, Button* btn) {
+    SDL_Color fill;
+    if (btn->clicked) {
+        fill = (SDL_Color){219, 112, 147, 255};
+    } else if (btn->hovered) {
+        fill = (SDL_Color){255, 182, 193, 255};
+    } else {
+        fill = (SDL_Color){255, 160, 180, 255};
+    }
+    drawListFillRect(draw, &btn->rect, fill);
+    
+    drawListRect(draw, &btn->rect, (SDL_Color){199, 92, 127, 255});
+    
+    SDL_Color textColor = {255, 255, 255, 255};
+    SDL_Surface* surface = TTF_RenderText_Blended(font, btn->text, textColor);
+    if (surface) {
+        int textX = btn->rect.x + (btn->rect.w - surface->w) / 2;
+        int textY = btn->rect.y + (btn->rect.h - surface->h) / 2;
+        SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+        SDL_Rect textRect = {textX, textY, surface->w, surface->h};
+        drawListTexture(draw, texture, NULL, &textRect, 1);
+        SDL_FreeSurface(surface);
+    }
+}
+
+// Fixed point solve of e^x - ax - b run on a worker thread
+// params: a, b, x0; intParams: form g1-g5; spec: stop rules; rows: x_n, x_(n+1), error
+// data: the auto mode's race, if raced; stats: failure code, won the race
+static void fixedPointExpJob(SolveJob* job) {
+    RootProblem problem = {PROBLEM_EXPONENTIAL, job->params[0], job->params[1], 0};
+    RootSolver solver;
+    solverInit(&solver, SOLVER_FIXED_POINT, &problem, job->params[2], 0, TOLERANCE, MAX_ITER);
+    solver.form = job->intParams[0];
+    stopPolicyParse(&solver.stop, job->spec);
+    
+    SessionTrace trace;
+    sessionTraceBegin(&trace, job->session, &solver);
+    
+    SolverRow row;
+    int status;
+    do {
+        status = solverStep(&solver, &row);
+        sessionTraceAdd(&trace, &row);
+        if (row.count && !solveJobRow(job, row.n, row.v, row.count)) {
+            fixedPointLaneLog(job, &solver, &trace, 0);
+            solveJobFinish(job, SOLVE_CANCELLED, 0);
+            return;
+        }
+    } while (status == SOLVER_RUNNING);
+    fixedPointLaneLog(job, &solver, &trace, status == SOLVER_CONVERGED);
+    
+    if (status == SOLVER_CONVERGED) {
+        sprintf(job->message, "SUCCESS!\nRoot: x = %.4lf\nIterations: %d", solver.root, solver.n);
+    } else {
+        sprintf(job->message, "FAILED: %s\nTry different method or x0", solverFailureName(solver.failure));
+    }
+    solverAppendCost(job->message, sizeof(job->message), &solver.cost);
+    job->stats[0] = solver.failure;
+    solveJobFinish(job, status == SOLVER_CONVERGED ? SOLVE_CONVERGED : SOLVE_FAILED, solver.root);
+}
+
+// Form picked by option i: g1-g5, then auto (0)
+static int optionForm(int i) {
+    return i < FORM_COUNT ? i + 1 : 0;
+}
+
+// Draw exponential curve with axes, grid, and root marker
+// The view pans and zooms; the curve itself comes from its tile cache
+static void drawGraph(DrawList* draw, GraphView* view, RasterCanvas* marks, double a, double b, double root, int hasRoot) {
+    SDL_Renderer* renderer = draw->renderer;
+    drawListFillRect(draw, &view->rect, (SDL_Color){250, 235, 245, 255});
+    graphDrawGrid(draw, view, 20, (SDL_Color){255, 228, 240, 255});
+    graphDrawAxes(draw, view, (SDL_Color){216, 191, 216, 255});
+    drawListFlush(draw);
+    
+    RootProblem problem = {PROBLEM_EXPONENTIAL, a, b, 0};
+    graphViewSetProblem(view, &problem);
+    graphViewRender(renderer, view);
+    
+    // Root marker, redrawn only when the view or the root moves
+    double key[] = {view->cx, view->cy, graphPpuX(view), graphPpuY(view), root, hasRoot};
+    if (canvasBegin(marks, key, sizeof(key))) {
+        canvasClear(marks, 0);
+        if (hasRoot) {
+            canvasDisc(marks, graphToScreenX(view, root) - view->rect.x + 0.5,
+                       graphToScreenY(view, 0) - view->rect.y + 0.5, 8.5, 0xFFFF1493);
+        }
+    }
+    canvasRender(renderer, marks, view->rect.x, view->rect.y);
+}
+
+static void fixedPointExpStateFree(void* state) {
+    FixedPointExpState* saved = state;
+    if (saved->saved) tableFree(&saved->table);
+}
+
+int fixedPointExpRun(AppHost* host) {
+    SDL_Renderer* renderer = host->renderer;
+    DrawList* draw = &host->draw;
+    
+    // Load fonts
+    TTF_Font* font = appHostFont(host, 18);
+    TTF_Font* fontSmall = appHostFont(host, 14);
+    TTF_Font* fontMedium = appHostFont(host, 16);
+    TTF_Font* fontLarge = appHostFont(host, 20);
+    TTF_Font* fontTitle = appHostFont(host, 24);
+    
+    FixedPointExpState* saved = appHostTabState(host, sizeof(FixedPointExpState), fixedPointExpStateFree);
+    if (!font || !fontSmall || !fontMedium || !fontLarge || !fontTitle || !saved) {
+        return 1;
+    }
+    
+    // Initialize input boxes
+    InputBox inputs[3];
+    const char* labels[] = {"a:", "b:", "x0:"};
+    for (int i = 0; i < 3; i++) {
+        inputs[i].rect = (SDL_Rect){140, 240 + i * 60, 150, 35};
+        strcpy(inputs[i].label, labels[i]);
+        strcpy(inputs[i].value, saved->saved ? saved->values[i] : "");
+        inputs[i].active = 0;
+    }
+    
+    // Inputs handed over by another tab, e.g. a cell picked in the sweep:
+    // a, b, x0 and the form
+    int selectedForm = saved->saved ? saved->selectedForm : 1;
+    for (int i = 0; i < 3; i++) {
+        appHostPreset(host, i, inputs[i].value, sizeof(inputs[i].value));
+    }
+    char presetForm[8];
+    if (appHostPreset(host, 3, presetForm, sizeof(presetForm))) {
+        int form = atoi(presetForm);
+        if (form >= 1 && form <= FORM_COUNT) selectedForm = form;
+    }
+    
+    // Initialize method selection options
+    MethodOption methods[OPTION_COUNT];
+    const char* formulas[] = {
+        "g(x) = ln(ax + b)",
+        "g(x) = (eˣ - b) / a",
+        "g(x) = ln((eˣ - b) / a)",
+        "g(x) = eˣ/a - b/a",
+        "g(x) = x - 0.1(eˣ - ax - b)",
+        "Auto: race the contractive g"
+    };
+    for (int i = 0; i < OPTION_COUNT; i++) {
+        methods[i].rect = (SDL_Rect){50, 438 + i * 26, 260, 24};
+        strcpy(methods[i].formula, formulas[i]);
+        methods[i].selected = (optionForm(i) == selectedForm);
+        methods[i].hovered = 0;
+    }
+    
+    Button computeBtn = {{50, 610, 120, 40}, "COMPUTE", 0, 0};
+    Button clearBtn = {{190, 610, 120, 40}, "CLEAR", 0, 0};
+    
+    // Iteration table (rows formatted once per solve)
+    const int tableColumns[] = {10, 80, 210, 350};
+    IterationTable table;
+    if (saved->saved) {
+        table = saved->table;
+    } else {
+        tableInit(&table, fontSmall, 460, 25, 3, 4, tableColumns, (SDL_Color){20, 20, 20, 255},
+                  (SDL_Color){255, 240, 250, 255}, (SDL_Color){255, 228, 245, 255});
+    }
+    
+    // State variables
+    char resultText[500] = "";
+    double finalRoot = 0;
+    int hasValidRoot = 0;
+    double coefA = 0, coefB = 0;
+    
+    // Root polished to ~30 digits in double-double, toggled with F4
+    RootProblemDD precise;
+    int preciseOk = 0;
+    int polishMode = 0;
+    char polishText[128] = "";
+    int totalIterations = 0;
+    
+    int activeInput = -1;
+    int quit = 0;
+    int tableScrollOffset = 0;
+    
+    // Back on this tab: show what it showed when the user left
+    if (saved->saved) {
+        strcpy(resultText, saved->resultText);
+        finalRoot = saved->finalRoot;
+        hasValidRoot = saved->hasValidRoot;
+        coefA = saved->coefA;
+        coefB = saved->coefB;
+        precise = saved->precise;
+        preciseOk = saved->preciseOk;
+        polishMode = saved->polishMode;
+        strcpy(polishText, saved->polishText);
+        tableScrollOffset = saved->tableScrollOffset;
+        totalIterations = table.rowCount;
+    }
+    
+    // Solves run on the host's worker pool and stream their rows back,
+    // with this tab's stop rules (F6)
+    SolveWorkerPool* pool = &host->pool;
+    appHostUseStopRules(host);
+    SolveJob* activeJob = NULL;
+    
+    // Auto mode: every form that contracts near x0 runs at once, the first
+    // to converge wins and the rest are cancelled
+    FormEstimate ranking[FP_AUTO_FORMS];
+    AutoLane lanes[FP_AUTO_FORMS];
+    memset(lanes, 0, sizeof(lanes));
+    int laneCount = 0;
+    int racing = 0;
+    
+    // Pannable graph; curve tiles are rasterized on a background thread
+    GraphView graphView;
+    graphViewInit(&graphView, (SDL_Rect){950, 150, 400, 300}, (SDL_Color){186, 85, 211, 255}, 2);
+    graphViewFrame(&graphView, -10, 10, -7.5, 7.5);
+    RasterCanvas markCanvas;
+    canvasInit(&markCanvas, renderer, graphView.rect.w, graphView.rect.h);
+    
+    // Frame timing overlay, toggled with F3
+    FrameHud hud;
+    hudInit(&hud);
+    SDL_Event e;
+    
+    // Main event loop
+    while (!quit && !appHostSwitching(host)) {
+        hudBeginFrame(&hud);
+        
+        while (appHostPollEvent(host, &e)) {
+            if (appHostEvent(host, &e)) continue;
+            if (graphViewHandleEvent(&graphView, &e)) continue;
+            
+            if (e.type == SDL_QUIT) {
+                quit = 1;
+            }
+            
+            // Handle mouse clicks
+            if (e.type == SDL_MOUSEBUTTONDOWN) {
+                int mx = e.button.x;
+                int my = e.button.y;
+                
+                activeInput = -1;
+                for (int i = 0; i < 3; i++) {
+                    if (mx >= inputs[i].rect.x && mx <= inputs[i].rect.x + inputs[i].rect.w &&
+                        my >= inputs[i].rect.y && my <= inputs[i].rect.y + inputs[i].rect.h) {
+                        activeInput = i;
+                    }
+                    inputs[i].active = (i == activeInput);
+                }
+                
+                for (int i = 0; i < OPTION_COUNT; i++) {
+                    if (mx >= methods[i].rect.x && mx <= methods[i].rect.x + methods[i].rect.w &&
+                        my >= methods[i].rect.y && my <= methods[i].rect.y + methods[i].rect.h) {
+                        selectedForm = optionForm(i);
+                        for (int j = 0; j < OPTION_COUNT; j++) {
+                            methods[j].selected = (j == i);
+                        }
+                    }
+                }
+                
+                if (mx >= computeBtn.rect.x && mx <= computeBtn.rect.x + computeBtn.rect.w &&
+                    my >= computeBtn.rect.y && my <= computeBtn.rect.y + computeBtn.rect.h) {
+                    computeBtn.clicked = 1;
+                    
+                    if (activeJob) {
+                        // Button reads CANCEL while a solve is running
+                        solveJobCancel(activeJob);
+                        solveJobRelease(activeJob);
+                        activeJob = NULL;
+                        strcpy(computeBtn.text, "COMPUTE");
+                        sprintf(resultText, "CANCELLED after %d iterations\nPress COMPUTE to start again", totalIterations);
+                    } else if (racing) {
+                        autoCancel(lanes, laneCount);
+                        racing = 0;
+                        strcpy(computeBtn.text, "COMPUTE");
+                        sprintf(resultText, "CANCELLED the race of %d forms\nPress COMPUTE to start again", laneCount);
+                    } else {
+                        // Parse input values
+                        coefA = atof(inputs[0].value);
+                        coefB = atof(inputs[1].value);
+                        preciseOk = polishProblemParse(&precise, PROBLEM_EXPONENTIAL, inputs[0].value, inputs[1].value, NULL);
+                        double x0 = atof(inputs[2].value);
+                        
+                        totalIterations = 0;
+                        hasValidRoot = 0;
+                        tableScrollOffset = 0;
+                        tableClear(&table);
+                        polishDescribe(polishText, sizeof(polishText), "\n", polishMode, NULL, 0, 0);
+                        
+                        if (selectedForm == 0) {
+                            // Rank the forms by |g'| near x0 and race the contractive ones
+                            RootProblem problem = {PROBLEM_EXPONENTIAL, coefA, coefB, 0};
+                            int contractive = fixedPointRankForms(&problem, x0, ranking, NULL);
+                            FixedPointRace* race = contractive ? fixedPointRaceCreate() : NULL;
+                            laneCount = 0;
+                            for (int i = 0; race && i < contractive; i++) {
+                                AutoLane* lane = &lanes[laneCount];
+                                lane->job = solveJobCreate(fixedPointExpJob);
+                                if (!lane->job) break;
+                                lane->estimate = ranking[i];
+                                lane->rowCount = 0;
+                                lane->status = SOLVE_RUNNING;
+                                lane->won = 0;
+                                lane->job->params[0] = coefA;
+                                lane->job->params[1] = coefB;
+                                lane->job->params[2] = x0;
+                                lane->job->intParams[0] = ranking[i].form;
+                                snprintf(lane->job->spec, sizeof(lane->job->spec), "%s", appHostStopSpec(host));
+                                lane->job->session = &host->session;
+                                fixedPointRaceJoin(race, lane->job);
+                                solvePoolSubmit(pool, lane->job);
+                                laneCount++;
+                            }
+                            fixedPointRaceRelease(race);
+                            racing = laneCount;
+                            if (racing) {
+                                strcpy(computeBtn.text, "CANCEL");
+                                sprintf(resultText, "Auto: racing %d of %d forms...", racing, FORM_COUNT);
+                            } else if (contractive) {
+                                strcpy(resultText, "Error: could not start the race\nOut of memory");
+                            } else {
+                                sprintf(resultText, "FAILED: no form contracts near x0\nSmallest |g'|: g%d = %.3g\nTry a different x0",
+                                        ranking[0].form, ranking[0].contraction);
+                            }
+                        } else {
+                            // Fixed Point Iteration runs on the worker pool
+                            activeJob = solveJobCreate(fixedPointExpJob);
+                            if (activeJob) {
+                                activeJob->params[0] = coefA;
+                                activeJob->params[1] = coefB;
+                                activeJob->params[2] = x0;
+                                activeJob->intParams[0] = selectedForm;
+                                snprintf(activeJob->spec, sizeof(activeJob->spec), "%s", appHostStopSpec(host));
+                                activeJob->session = &host->session;
+                                solvePoolSubmit(pool, activeJob);
+                                strcpy(computeBtn.text, "CANCEL");
+                                strcpy(resultText, "Solving...");
+                            }
+                        }
+                    }
+                }
+                
+                // Clear button: Reset all inputs and state
+                if (mx >= clearBtn.rect.x && mx <= clearBtn.rect.x + clearBtn.rect.w &&
+                    my >= clearBtn.rect.y && my <= clearBtn.rect.y + clearBtn.rect.h) {
+                    if (activeJob) {
+                        solveJobCancel(activeJob);
+                        solveJobRelease(activeJob);
+                        activeJob = NULL;
+                    }
+                    autoCancel(lanes, laneCount);
+                    racing = 0;
+                    strcpy(computeBtn.text, "COMPUTE");
+                    for (int i = 0; i < 3; i++) {
+                        strcpy(inputs[i].value, "");
+                    }
+                    selectedForm = 1;
+                    for (int i = 0; i < OPTION_COUNT; i++) {
+                        methods[i].selected = (i == 0);
+                    }
+                    strcpy(resultText, "");
+                    hasValidRoot = 0;
+                    totalIterations = 0;
+                    tableScrollOffset = 0;
+                    tableClear(&table);
+                    polishDescribe(polishText, sizeof(polishText), "\n", polishMode, NULL, 0, 0);
+                    clearBtn.clicked = 1;
+                }
+            }
+            
+            if (e.type == SDL_MOUSEBUTTONUP) {
+                computeBtn.clicked = 0;
+                clearBtn.clicked = 0;
+            }
+            
+            if (e.type == SDL_MOUSEMOTION) {
+                int mx = e.motion.x;
+                int my = e.motion.y;
+                
+                computeBtn.hovered = (mx >= computeBtn.rect.x && mx <= computeBtn.rect.x + computeBtn.rect.w &&
+                                     my >= computeBtn.rect.y && my <= computeBtn.rect.y + computeBtn.rect.h);
+                
+                clearBtn.hovered = (mx >= clearBtn.rect.x && mx <= clearBtn.rect.x + clearBtn.rect.w &&
+                                   my >= clearBtn.rect.y && my <= clearBtn.rect.y + clearBtn.rect.h);
+                
+                for (int i = 0; i < OPTION_COUNT; i++) {
+                    methods[i].hovered = (mx >= methods[i].rect.x && mx <= methods[i].rect.x + methods[i].rect.w &&
+                                         my >= methods[i].rect.y && my <= methods[i].rect.y + methods[i].rect.h);
+                }
+            }
+            
+            // Handle text input for active input box
+            if (e.type == SDL_TEXTINPUT && activeInput >= 0) {
+                // Allow numbers, decimal point, and minus sign
+                char c = e.text.text[0];
+                if ((c >= '0' && c <= '9') || c == '.' || c == '-') {
+                    int len = strlen(inputs[activeInput].value);
+                    if (len < 19) {
+                        inputs[activeInput].value[len] = c;
+                        inputs[activeInput].value[len + 1] = '\0';
+                    }
+                }
+            }
+            
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F3) {
+                hudToggle(&hud);
+            }
+            
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F4) {
+                polishMode = !polishMode;
+                polishDescribe(polishText, sizeof(polishText), "\n", polishMode,
+                               preciseOk ? &precise : NULL, hasValidRoot, finalRoot);
+            }
+            
+            if (e.type == SDL_KEYDOWN && activeInput >= 0) {
+                if (e.key.keysym.sym == SDLK_BACKSPACE) {
+                    int len = strlen(inputs[activeInput].value);
+                    if (len > 0) {
+                        inputs[activeInput].value[len - 1] = '\0';
+                    }
+                }
+            }
+            
+            // Handle mouse wheel for table scrolling
+            if (e.type == SDL_MOUSEWHEEL) {
+                if (totalIterations > 0) {
+                    tableScrollOffset -= e.wheel.y * 2;
+                    if (tableScrollOffset < 0) tableScrollOffset = 0;
+                    
+                    int maxVisibleRows = 13;
+                    int maxScroll = totalIterations - maxVisibleRows;
+                    if (maxScroll < 0) maxScroll = 0;
+                    if (tableScrollOffset > maxScroll) tableScrollOffset = maxScroll;
+                }
+            }
+        }
+        
+        hudPhase(&hud, HUD_SOLVE);
+        
+        // Drain rows streamed back from the solver worker
+        if (activeJob) {
+            SolveMessage msg;
+            int budget = SOLVE_DRAIN_BUDGET;
+            while (activeJob && budget-- > 0 && solveJobPop(activeJob, &msg)) {
+                if (msg.type == SOLVE_MSG_ROW) {
+                    // Rows go straight into the table, which grows as needed
+                    int row = tableAppendRow(&table);
+                    if (row < 0) continue;
+                    totalIterations = table.rowCount;
+                    tableSetCell(&table, row, 0, "%d", msg.n);
+                    tableSetCell(&table, row, 1, "%.4lf", msg.v[0]);
+                    tableSetCell(&table, row, 2, "%.4lf", msg.v[1]);
+                    tableSetCell(&table, row, 3, "%.6lf", msg.v[2]);
+                    sprintf(resultText, "Solving...\nIterations so far: %d", totalIterations);
+                } else if (msg.type == SOLVE_MSG_DONE) {
+                    strcpy(resultText, activeJob->message);
+                    if (activeJob->status == SOLVE_CONVERGED) {
+                        finalRoot = activeJob->root;
+                        hasValidRoot = 1;
+                    }
+                    polishDescribe(polishText, sizeof(polishText), "\n", polishMode,
+                                   preciseOk ? &precise : NULL, hasValidRoot, finalRoot);
+                    solveJobRelease(activeJob);
+                    activeJob = NULL;
+                    strcpy(computeBtn.text, "COMPUTE");
+                }
+            }
+        }
+        
+        // Drain the raced forms; the lane that claimed the race wins and
+        // the rest are cancelled
+        if (racing) {
+            int winner = autoDrain(lanes, laneCount, &racing);
+            
+            if (winner >= 0) {
+                autoCancel(lanes, laneCount);
+                racing = 0;
+                AutoLane* lane = &lanes[winner];
+                for (int i = 0; i < lane->rowCount; i++) {
+                    const double* v = lane->rows + (size_t)i * 3;
+                    int row = tableAppendRow(&table);
+                    if (row < 0) break;
+                    tableSetCell(&table, row, 0, "%d", i + 1);
+                    tableSetCell(&table, row, 1, "%.4lf", v[0]);
+                    tableSetCell(&table, row, 2, "%.4lf", v[1]);
+                    tableSetCell(&table, row, 3, "%.6lf", v[2]);
+                }
+                totalIterations = table.rowCount;
+                
+                // The winner's own message, with its first line naming the form
+                const char* rest = strchr(lane->message, '\n');
+                snprintf(resultText, sizeof(resultText), "SUCCESS! Auto: g%d, |g'| ~ %.2f%s",
+                         lane->estimate.form, lane->estimate.contraction, rest ? rest : "");
+                finalRoot = lane->root;
+                hasValidRoot = 1;
+                polishDescribe(polishText, sizeof(polishText), "\n", polishMode,
+                               preciseOk ? &precise : NULL, hasValidRoot, finalRoot);
+                strcpy(computeBtn.text, "COMPUTE");
+            } else if (!racing) {
+                int len = sprintf(resultText, "FAILED: none of the %d raced forms converged", laneCount);
+                for (int i = 0; i < laneCount && i < 3; i++) {
+                    len += sprintf(resultText + len, "\ng%d (|g'| ~ %.2f): %s", lanes[i].estimate.form,
+                                   lanes[i].estimate.contraction, solverFailureName(lanes[i].failure));
+                }
+                strcpy(computeBtn.text, "COMPUTE");
+            }
+        }
+        
+        // Clear screen
+        hudPhase(&hud, HUD_TEXT);
+        SDL_SetRenderDrawColor(renderer, 250, 240, 255, 255);
+        hudRenderClear(renderer);
+        
+        // Render header information (centered at top)
+        SDL_Color headerColor = {138, 43, 226, 255};
+        renderText(draw, fontTitle, "MT211 - Numerical Method", 500, 15, headerColor);
+        renderText(draw, fontLarge, "Semestral Project", 560, 45, headerColor);
+        
+        SDL_Color submittedColor = {147, 112, 219, 255};
+        renderText(draw, fontLarge, "Submitted By:", 575, 75, submittedColor);
+        renderText(draw, fontLarge, "BSCPE 22001", 585, 100, submittedColor);
+        renderText(draw, fontLarge, "Jovielyn B. Panes", 570, 125, submittedColor);
+        renderText(draw, fontLarge, "Princess Ella M. Panes", 550, 150, submittedColor);
+        
+        SDL_Color titleColor = {138, 43, 226, 255};
+        renderText(draw, fontTitle, "FIXED POINT ITERATION METHOD", 20, 40, titleColor);
+        
+        SDL_Color subtitleColor = {147, 112, 219, 255};
+        renderText(draw, fontLarge, "Exponential Equation: eˣ - ax - b = 0", 30, 75, subtitleColor);
+        
+        // Render input section
+        SDL_Color sectionColor = {138, 43, 226, 255};
+        renderText(draw, font, "INPUT", 120, 200, sectionColor);
+        
+        for (int i = 0; i < 3; i++) {
+            renderInputBox(draw, font, &inputs[i]);
+        }
+        
+        // Render method selection
+        renderText(draw, font, "SELECT g(x):", 50, 412, sectionColor);
+        
+        for (int i = 0; i < OPTION_COUNT; i++) {
+            SDL_Color fill;
+            if (methods[i].selected) {
+                fill = (SDL_Color){255, 192, 203, 255};
+            } else if (methods[i].hovered) {
+                fill = (SDL_Color){255, 228, 235, 255};
+            } else {
+                fill = (SDL_Color){255, 245, 250, 255};
+            }
+            drawListFillRect(draw, &methods[i].rect, fill);
+            
+            SDL_Color border = methods[i].selected ? (SDL_Color){219, 112, 147, 255} : (SDL_Color){216, 191, 216, 255};
+            drawListRect(draw, &methods[i].rect, border);
+            
+            SDL_Color methodColor = methods[i].selected ? (SDL_Color){138, 43, 226, 255} : (SDL_Color){147, 112, 219, 255};
+            renderText(draw, fontSmall, methods[i].formula, methods[i].rect.x + 5, methods[i].rect.y + 3, methodColor);
+        }
+        
+        renderButton(draw, font, &computeBtn);
+        renderButton(draw, font, &clearBtn);
+        
+        renderText(draw, font, "STATUS", 70, 660, sectionColor);
+        
+        if (strlen(resultText) > 0) {
+            char resultCopy[500];
+            strcpy(resultCopy, resultText);
+            char* line = strtok(resultCopy, "\n");
+            int y = 685;
+            while (line) {
+                SDL_Color resultColor = hasValidRoot ? (SDL_Color){20, 120, 20, 255} : (SDL_Color){180, 20, 20, 255};
+                renderText(draw, fontSmall, line, 80, y, resultColor);
+                y += 20;
+                line = strtok(NULL, "\n");
+            }
+        }
+        
+        // Render iteration table
+        if (totalIterations > 0) {
+            renderText(draw, font, "ITERATION TABLE", 390, 240, sectionColor);
+            
+            SDL_Rect tableHeader = {390, 275, 460, 30};
+            drawListFillRect(draw, &tableHeader, (SDL_Color){186, 85, 211, 255});
+            
+            SDL_Color headerColor2 = {255, 255, 255, 255};
+            renderText(draw, fontSmall, "n", 410, 280, headerColor2);
+            renderText(draw, fontSmall, "x_n", 470, 280, headerColor2);
+            renderText(draw, fontSmall, "x_(n+1)", 600, 280, headerColor2);
+            renderText(draw, fontSmall, "error", 760, 280, headerColor2);
+            
+            int maxVisibleRows = 13;
+            int startRow = tableScrollOffset;
+            
+            drawListFlush(draw);
+            tableRender(renderer, &table, 390, 310, startRow, maxVisibleRows);
+            
+            if (totalIterations > maxVisibleRows) {
+                int scrollbarX = 895;
+                int scrollbarY = 310;
+                int scrollbarHeight = maxVisibleRows * 25;
+                
+                SDL_Rect scrollbarTrack = {scrollbarX, scrollbarY, 10, scrollbarHeight};
+                drawListFillRect(draw, &scrollbarTrack, (SDL_Color){255, 228, 235, 255});
+                
+                float thumbRatio = (float)maxVisibleRows / totalIterations;
+                int thumbHeight = (int)(scrollbarHeight * thumbRatio);
+                if (thumbHeight < 20) thumbHeight = 20;
+                
+                float scrollRatio = (float)tableScrollOffset / (totalIterations - maxVisibleRows);
+                int thumbY = scrollbarY + (int)((scrollbarHeight - thumbHeight) * scrollRatio);
+                
+                SDL_Rect scrollbarThumb = {scrollbarX, thumbY, 10, thumbHeight};
+                drawListFillRect(draw, &scrollbarThumb, (SDL_Color){219, 112, 147, 255});
+            }
+        }
+        
+        // Render conclusion box with final results
+        if (hasValidRoot) {
+            int conclusionY = 650;
+            renderText(draw, font, "CONCLUSION", 380, conclusionY, sectionColor);
+            
+            SDL_Rect conclusionBox = {380, conclusionY + 30, 480, 110};
+            drawListFillRect(draw, &conclusionBox, (SDL_Color){255, 240, 250, 255});
+            
+            drawListRect(draw, &conclusionBox, (SDL_Color){219, 112, 147, 255});
+            
+            SDL_Color conclusionColor = {138, 43, 226, 255};
+            char buffer[200];
+            
+            formatEquation(buffer, coefA, coefB);
+            renderText(draw, font, buffer, 390, conclusionY + 40, conclusionColor);
+            renderText(draw, font, buffer, 391, conclusionY + 40, conclusionColor);
+            
+            sprintf(buffer, "Approximate Root: x = %.6lf", finalRoot);
+            renderText(draw, font, buffer, 390, conclusionY + 65, conclusionColor);
+            renderText(draw, font, buffer, 391, conclusionY + 65, conclusionColor);
+            
+            sprintf(buffer, "Total Iterations: %d   |   Tolerance: %.2lf", totalIterations, TOLERANCE);
+            renderText(draw, font, buffer, 390, conclusionY + 90, conclusionColor);
+            renderText(draw, font, buffer, 391, conclusionY + 90, conclusionColor);
+        }
+        
+        renderText(draw, font, "GRAPH", 950, 115, sectionColor);
+        hudPhase(&hud, HUD_GRAPH);
+        TRACE_SCOPE("drawGraph") {
+            drawGraph(draw, &graphView, &markCanvas, coefA, coefB, finalRoot, hasValidRoot);
+        }
+        hudPhase(&hud, HUD_TEXT);
+        
+        // Polished root, under the graph
+        if (polishText[0]) {
+            char polishCopy[128];
+            strcpy(polishCopy, polishText);
+            char* line = strtok(polishCopy, "\n");
+            int y = 470;
+            while (line) {
+                renderText(draw, fontSmall, line, 950, y, (SDL_Color){138, 43, 226, 255});
+                y += 20;
+                line = strtok(NULL, "\n");
+            }
+        }
+        
+        appHostRenderTabs(host);
+        hudRender(renderer, fontSmall, &hud, WINDOW_WIDTH - 270, 10);
+        
+        hudPhase(&hud, HUD_PRESENT);
+        TRACE_SCOPE("SDL_RenderPresent") {
+            SDL_RenderPresent(renderer);
+        }
+        hudPhase(&hud, HUD_IDLE);
+        appHostEndFrame(host);
+    }
+    
+    // A solve still running is cancelled; everything else is kept for the
+    // next visit
+    if (activeJob) {
+        solveJobCancel(activeJob);
+        solveJobRelease(activeJob);
+        sprintf(resultText, "CANCELLED after %d iterations\nPress COMPUTE to start again", totalIterations);
+    } else if (racing) {
+        sprintf(resultText, "CANCELLED the race of %d forms\nPress COMPUTE to start again", laneCount);
+    }
+    autoCancel(lanes, laneCount);
+    for (int i = 0; i < FP_AUTO_FORMS; i++) free(lanes[i].rows);
+    graphViewFree(&graphView);
+    canvasFree(&markCanvas);
+    
+    for (int i = 0; i < 3; i++) {
+        strcpy(saved->values[i], inputs[i].value);
+    }
+    saved->selectedForm = selectedForm;
+    strcpy(saved->resultText, resultText);
+    saved->finalRoot = finalRoot;
+    saved->hasValidRoot = hasValidRoot;
+    saved->coefA = coefA;
+    saved->coefB = coefB;
+    saved->precise = precise;
+    saved->preciseOk = preciseOk;
+    saved->polishMode = polishMode;
+    strcpy(saved->polishText, polishText);
+    saved->tableScrollOffset = tableScrollOffset;
+    saved->table = table;
+    saved->saved = 1;
+    
+    return 0;
+}
+
+#ifndef METHODS_SUITE
+int main(int argc, char* argv[]) {
+    AppHost host;
+    if (appHostInit(&host, "Fixed Point Iteration - Exponential", WINDOW_WIDTH, WINDOW_HEIGHT, NULL, 0) != 0) {
+        return 1;
+    }
+    
+    int result = fixedPointExpRun(&host);
+    
+    appHostFree(&host);
+    return result;
+}
+#endif
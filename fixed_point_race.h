@@ -0,0 +1,132 @@
+#ifndef FIXED_POINT_RACE_H
+#define FIXED_POINT_RACE_H
+
+#include <SDL.h>
+#include <stdlib.h>
+#include <string.h>
+#include "solve_worker.h"
+#include "session_log.h"
+#include "fixed_point_auto.h"
+
+// The auto mode of the fixed point tabs: every form that contracts near x0
+// (fixedPointRankForms) runs as its own job and the first to converge wins.
+// The lanes share a race whose flag the first converged lane claims, so only
+// that lane is appended to the session log; lanes that lose, fail or are
+// cancelled leave no record. The lanes hold the race and the last to finish
+// frees it; a lane the pool drops unrun lets go through its drop hook.
+typedef struct {
+    SDL_atomic_t refs;
+    SDL_atomic_t claimed;
+} FixedPointRace;
+
+// One raced form as the UI sees it
+typedef struct {
+    SolveJob* job;
+    FormEstimate estimate;
+    double* rows;          // x_n, x_(n+1), error per row, kept until the race is decided
+    int rowCount;
+    int rowCapacity;
+    int status;
+    int failure;
+    int won;               // claimed the race, so its solve is the one logged
+    double root;
+    char message[300];
+} AutoLane;
+
+static inline FixedPointRace* fixedPointRaceCreate(void) {
+    FixedPointRace* race = calloc(1, sizeof(FixedPointRace));
+    if (race) SDL_AtomicSet(&race->refs, 1);
+    return race;
+}
+
+static inline void fixedPointRaceRelease(FixedPointRace* race) {
+    if (race && SDL_AtomicAdd(&race->refs, -1) == 1) free(race);
+}
+
+// Drop hook: a lane that never ran still leaves the race
+static inline void fixedPointRaceDrop(SolveJob* job) {
+    fixedPointRaceRelease(job->data);
+}
+
+// Enter a job in the race before it is submitted
+static inline void fixedPointRaceJoin(FixedPointRace* race, SolveJob* job) {
+    SDL_AtomicAdd(&race->refs, 1);
+    job->data = race;
+    job->drop = fixedPointRaceDrop;
+}
+
+// End of a fixed point job's solve: a job outside a race logs as usual; a
+// raced lane logs only if it converged first, and sets stats[1] so the UI
+// knows it won. Either way the trace is consumed and the race let go.
+static inline void fixedPointLaneLog(SolveJob* job, const RootSolver* solver, SessionTrace* trace, int converged) {
+    FixedPointRace* race = job->data;
+    if (!race) {
+        sessionLogSolve(job->session, solver, trace);
+        return;
+    }
+    if (converged && SDL_AtomicCAS(&race->claimed, 0, 1)) {
+        job->stats[1] = 1;
+        sessionLogSolve(job->session, solver, trace);
+    } else {
+        sessionTraceFree(trace);
+    }
+    job->data = NULL;
+    fixedPointRaceRelease(race);
+}
+
+// Buffer one row of a raced form (0 if out of memory)
+static inline int autoLaneRow(AutoLane* lane, const double* v) {
+    if (lane->rowCount == lane->rowCapacity) {
+        int capacity = lane->rowCapacity ? lane->rowCapacity * 2 : 128;
+        double* rows = realloc(lane->rows, (size_t)capacity * 3 * sizeof(double));
+        if (!rows) return 0;
+        lane->rows = rows;
+        lane->rowCapacity = capacity;
+    }
+    double* row = lane->rows + (size_t)lane->rowCount++ * 3;
+    row[0] = v[0];
+    row[1] = v[1];
+    row[2] = v[2];
+    return 1;
+}
+
+// Drop every lane still running; the pool finishes them as cancelled
+static inline void autoCancel(AutoLane* lanes, int count) {
+    for (int i = 0; i < count; i++) {
+        if (lanes[i].job) {
+            solveJobCancel(lanes[i].job);
+            solveJobRelease(lanes[i].job);
+            lanes[i].job = NULL;
+        }
+    }
+}
+
+// Drain the lanes' rows and results into the UI, a budget per frame.
+// Returns the lane that won the race once it is done, else -1; *racing
+// counts the lanes still running.
+static inline int autoDrain(AutoLane* lanes, int count, int* racing) {
+    int winner = -1;
+    int budget = SOLVE_DRAIN_BUDGET;
+    for (int i = 0; i < count; i++) {
+        AutoLane* lane = &lanes[i];
+        SolveMessage msg;
+        while (lane->job && budget-- > 0 && solveJobPop(lane->job, &msg)) {
+            if (msg.type == SOLVE_MSG_ROW) {
+                autoLaneRow(lane, msg.v);
+            } else if (msg.type == SOLVE_MSG_DONE) {
+                lane->status = lane->job->status;
+                lane->failure = (int)lane->job->stats[0];
+                lane->won = lane->job->stats[1] != 0;
+                lane->root = lane->job->root;
+                strcpy(lane->message, lane->job->message);
+                solveJobRelease(lane->job);
+                lane->job = NULL;
+                (*racing)--;
+                if (lane->won) winner = i;
+            }
+        }
+    }
+    return winner;
+}
+
+#endif
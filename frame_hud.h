@@ -0,0 +1,227 @@
+#ifndef FRAME_HUD_H
+#define FRAME_HUD_H
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdio.h>
+#include <string.h>
+
+// Frame-time overlay.
+// Draw and texture calls are counted through the hudRender* / hudCreate*
+// wrappers below; the render helpers (draw list, table, graph, canvas)
+// use them, and so should any direct SDL drawing in the apps.
+
+#define HUD_HISTORY 120
+#define HUD_GRAPH_MS 50.0   // sparkline full-scale frame time
+
+enum {
+    HUD_EVENTS,
+    HUD_SOLVE,
+    HUD_TEXT,
+    HUD_GRAPH,
+    HUD_PRESENT,
+    HUD_IDLE,       // frame pacing delay
+    HUD_PHASE_COUNT
+};
+
+static const char* hudPhaseNames[HUD_PHASE_COUNT] = {
+    "events", "solve", "text", "graph", "present", "idle"
+};
+
+static int hudDrawCalls;
+static int hudTextureCreates;
+
+// Counted SDL calls
+static inline int hudRenderClear(SDL_Renderer* renderer) {
+    hudDrawCalls++;
+    return SDL_RenderClear(renderer);
+}
+
+static inline int hudRenderDrawPoint(SDL_Renderer* renderer, int x, int y) {
+    hudDrawCalls++;
+    return SDL_RenderDrawPoint(renderer, x, y);
+}
+
+static inline int hudRenderDrawLine(SDL_Renderer* renderer, int x1, int y1, int x2, int y2) {
+    hudDrawCalls++;
+    return SDL_RenderDrawLine(renderer, x1, y1, x2, y2);
+}
+
+static inline int hudRenderDrawLines(SDL_Renderer* renderer, const SDL_Point* points, int count) {
+    hudDrawCalls++;
+    return SDL_RenderDrawLines(renderer, points, count);
+}
+
+static inline int hudRenderFillRect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+    hudDrawCalls++;
+    return SDL_RenderFillRect(renderer, rect);
+}
+
+static inline int hudRenderCopy(SDL_Renderer* renderer, SDL_Texture* texture,
+                                const SDL_Rect* src, const SDL_Rect* dst) {
+    hudDrawCalls++;
+    return SDL_RenderCopy(renderer, texture, src, dst);
+}
+
+static inline int hudRenderGeometry(SDL_Renderer* renderer, SDL_Texture* texture,
+                                    const SDL_Vertex* vertices, int vertexCount,
+                                    const int* indices, int indexCount) {
+    hudDrawCalls++;
+    return SDL_RenderGeometry(renderer, texture, vertices, vertexCount, indices, indexCount);
+}
+
+static inline SDL_Texture* hudCreateTexture(SDL_Renderer* renderer, Uint32 format, int access, int w, int h) {
+    hudTextureCreates++;
+    return SDL_CreateTexture(renderer, format, access, w, h);
+}
+
+static inline SDL_Texture* hudCreateTextureFromSurface(SDL_Renderer* renderer, SDL_Surface* surface) {
+    hudTextureCreates++;
+    return SDL_CreateTextureFromSurface(renderer, surface);
+}
+
+typedef struct {
+    int visible;
+    double msPerTick;
+
+    // Frame being measured
+    Uint64 frameStart;
+    Uint64 phaseStart;
+    int phase;
+    double phaseMs[HUD_PHASE_COUNT];
+    int drawCallsBase;
+    int texturesBase;
+    int ownDrawCalls;       // the overlay's own calls, excluded from the counts
+    int ownTextures;
+
+    // Last completed frame, phases smoothed for readability
+    double frameMs;
+    double avgPhaseMs[HUD_PHASE_COUNT];
+    int drawCalls;
+    int textureCreates;
+
+    float history[HUD_HISTORY];
+    int historyNext;
+} FrameHud;
+
+static inline void hudInit(FrameHud* hud) {
+    memset(hud, 0, sizeof(*hud));
+    hud->msPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    hud->phase = -1;
+}
+
+static inline void hudToggle(FrameHud* hud) {
+    hud->visible = !hud->visible;
+}
+
+// Charge the time since the last mark to the current phase and switch to
+// the given one; phases may be entered several times per frame
+static inline void hudPhase(FrameHud* hud, int phase) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (hud->phase >= 0) {
+        hud->phaseMs[hud->phase] += (double)(now - hud->phaseStart) * hud->msPerTick;
+    }
+    hud->phase = phase;
+    hud->phaseStart = now;
+}
+
+// Call at the top of the main loop: closes the previous frame (including its
+// present and delay) and starts timing the event phase of the next one
+static inline void hudBeginFrame(FrameHud* hud) {
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    if (hud->frameStart) {
+        hudPhase(hud, HUD_EVENTS);
+        hud->frameMs = (double)(now - hud->frameStart) * hud->msPerTick;
+        for (int i = 0; i < HUD_PHASE_COUNT; i++) {
+            hud->avgPhaseMs[i] = hud->avgPhaseMs[i] * 0.9 + hud->phaseMs[i] * 0.1;
+        }
+        hud->drawCalls = hudDrawCalls - hud->drawCallsBase - hud->ownDrawCalls;
+        hud->textureCreates = hudTextureCreates - hud->texturesBase - hud->ownTextures;
+        hud->history[hud->historyNext] = (float)hud->frameMs;
+        hud->historyNext = (hud->historyNext + 1) % HUD_HISTORY;
+    }
+
+    memset(hud->phaseMs, 0, sizeof(hud->phaseMs));
+    hud->drawCallsBase = hudDrawCalls;
+    hud->texturesBase = hudTextureCreates;
+    hud->ownDrawCalls = 0;
+    hud->ownTextures = 0;
+    hud->frameStart = now;
+    hud->phase = HUD_EVENTS;
+    hud->phaseStart = now;
+}
+
+static inline void hudText(SDL_Renderer* renderer, TTF_Font* font, const char* text, int x, int y) {
+    SDL_Color color = {220, 255, 220, 255};
+    SDL_Surface* surface = TTF_RenderText_Blended(font, text, color);
+    if (!surface) return;
+
+    SDL_Texture* texture = hudCreateTextureFromSurface(renderer, surface);
+    SDL_Rect rect = {x, y, surface->w, surface->h};
+    hudRenderCopy(renderer, texture, NULL, &rect);
+
+    SDL_FreeSurface(surface);
+    SDL_DestroyTexture(texture);
+}
+
+// Draw the overlay (stats of the last completed frame) with its top-left at (x, y)
+static inline void hudRender(SDL_Renderer* renderer, TTF_Font* font, FrameHud* hud, int x, int y) {
+    if (!hud->visible) return;
+
+    int drawCallsBefore = hudDrawCalls;
+    int texturesBefore = hudTextureCreates;
+    int lineHeight = TTF_FontLineSkip(font);
+    int width = 260;
+    int height = lineHeight * (HUD_PHASE_COUNT + 3) + 60;
+    char line[80];
+
+    // The overlay blends; the caller's blend mode is put back afterwards
+    SDL_BlendMode blendMode;
+    SDL_GetRenderDrawBlendMode(renderer, &blendMode);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 190);
+    SDL_Rect bg = {x, y, width, height};
+    hudRenderFillRect(renderer, &bg);
+
+    int ty = y + 6;
+    sprintf(line, "frame %.2f ms (%.0f fps)", hud->frameMs, hud->frameMs > 0 ? 1000.0 / hud->frameMs : 0.0);
+    hudText(renderer, font, line, x + 8, ty);
+    ty += lineHeight;
+
+    for (int i = 0; i < HUD_PHASE_COUNT; i++) {
+        sprintf(line, "  %-8s %6.2f ms", hudPhaseNames[i], hud->avgPhaseMs[i]);
+        hudText(renderer, font, line, x + 8, ty);
+        ty += lineHeight;
+    }
+
+    sprintf(line, "draw calls %d", hud->drawCalls);
+    hudText(renderer, font, line, x + 8, ty);
+    ty += lineHeight;
+    sprintf(line, "textures created %d", hud->textureCreates);
+    hudText(renderer, font, line, x + 8, ty);
+    ty += lineHeight + 4;
+
+    // Sparkline, oldest sample on the left, with a 16.7 ms reference line
+    int graphH = 50;
+    int baseY = ty + graphH;
+    SDL_SetRenderDrawColor(renderer, 255, 200, 80, 120);
+    int refY = baseY - (int)(16.7 / HUD_GRAPH_MS * graphH);
+    hudRenderDrawLine(renderer, x + 8, refY, x + 8 + 2 * (HUD_HISTORY - 1), refY);
+
+    SDL_Point points[HUD_HISTORY];
+    for (int i = 0; i < HUD_HISTORY; i++) {
+        double ms = hud->history[(hud->historyNext + i) % HUD_HISTORY];
+        if (ms > HUD_GRAPH_MS) ms = HUD_GRAPH_MS;
+        points[i].x = x + 8 + 2 * i;
+        points[i].y = baseY - (int)(ms / HUD_GRAPH_MS * graphH);
+    }
+    SDL_SetRenderDrawColor(renderer, 120, 255, 120, 255);
+    hudRenderDrawLines(renderer, points, HUD_HISTORY);
+    SDL_SetRenderDrawBlendMode(renderer, blendMode);
+
+    hud->ownDrawCalls += hudDrawCalls - drawCallsBefore;
+    hud->ownTextures += hudTextureCreates - texturesBefore;
+}
+
+#endif
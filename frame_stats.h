@@ -0,0 +1,82 @@
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Frame times collected over a whole run, summarized as percentiles.
+// Unlike the HUD's short history this keeps every frame, for benchmarks.
+
+typedef struct {
+    double* ms;
+    int count;
+    int capacity;
+} FrameStats;
+
+static inline void frameStatsAdd(FrameStats* stats, double ms) {
+    if (stats->count == stats->capacity) {
+        int capacity = stats->capacity ? stats->capacity * 2 : 1024;
+        double* grown = realloc(stats->ms, sizeof(double) * capacity);
+        if (!grown) return;
+        stats->ms = grown;
+        stats->capacity = capacity;
+    }
+    stats->ms[stats->count++] = ms;
+}
+
+static inline void frameStatsFree(FrameStats* stats) {
+    free(stats->ms);
+    memset(stats, 0, sizeof(*stats));
+}
+
+static inline int frameStatsCompare(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return x < y ? -1 : x > y;
+}
+
+// Nearest-rank percentile of the sorted times, p in [0, 100]
+static inline double frameStatsPercentile(const double* sorted, int count, double p) {
+    if (count == 0) return 0;
+    int rank = (int)(p / 100.0 * count + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1];
+}
+
+// One line: frames, mean, p50, p90, p99 and max in ms
+static inline void frameStatsFormat(const FrameStats* stats, char* buffer, size_t size) {
+    if (stats->count == 0) {
+        snprintf(buffer, size, "0 frames");
+        return;
+    }
+    double* sorted = malloc(sizeof(double) * stats->count);
+    if (!sorted) {
+        snprintf(buffer, size, "%d frames", stats->count);
+        return;
+    }
+    memcpy(sorted, stats->ms, sizeof(double) * stats->count);
+    qsort(sorted, stats->count, sizeof(double), frameStatsCompare);
+
+    double total = 0;
+    for (int i = 0; i < stats->count; i++) total += sorted[i];
+    snprintf(buffer, size, "%d frames, mean %.3f ms, p50 %.3f, p90 %.3f, p99 %.3f, max %.3f",
+             stats->count, total / stats->count, frameStatsPercentile(sorted, stats->count, 50),
+             frameStatsPercentile(sorted, stats->count, 90), frameStatsPercentile(sorted, stats->count, 99),
+             sorted[stats->count - 1]);
+    free(sorted);
+}
+
+// Every frame time as CSV (frame, ms)
+static inline int frameStatsWrite(const FrameStats* stats, const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) return 0;
+    fprintf(file, "frame,ms\n");
+    for (int i = 0; i < stats->count; i++) {
+        fprintf(file, "%d,%.4f\n", i, stats->ms[i]);
+    }
+    fclose(file);
+    return 1;
+}
+
+#endif
@@ -0,0 +1,464 @@
+#ifndef GRAPH_VIEW_H
+#define GRAPH_VIEW_H
+
+#include <SDL.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "root_problem.h"
+#include "curve_sampler.h"
+#include "trace_events.h"
+#include "draw_list.h"
+#include "frame_hud.h"
+
+#define GRAPH_TILE_SIZE 128
+#define GRAPH_TILE_CACHE 128
+#define GRAPH_MIN_LEVEL -10
+#define GRAPH_MAX_LEVEL 16
+
+// Pannable, zoomable plot of one RootProblem.
+// The curve is rasterized into 128x128 tiles on a background thread. Tiles
+// sit on a fixed grid in level space, where level L draws at 2^L times the
+// base pixels-per-unit, so panning reuses every tile already on screen and
+// zooming back to a level visited before is free. Missing tiles are drawn
+// from their parent level, scaled up, until the worker delivers them.
+
+enum { TILE_FREE, TILE_QUEUED, TILE_RENDERED, TILE_READY };
+
+typedef struct {
+    int level, tx, ty;
+    Uint32 generation;
+    SDL_atomic_t state;
+    Uint32 lastUsed;
+
+    // Job description, written by the UI before queueing
+    RootProblem problem;
+    double ppuX, ppuY;
+
+    Uint32* pixels;         // GRAPH_TILE_SIZE^2 ARGB, written by the worker
+    SDL_Texture* texture;
+} GraphTile;
+
+typedef struct {
+    SDL_Rect rect;
+    double cx, cy;              // world point shown at the centre of rect
+    double basePpuX, basePpuY;  // pixels per unit at level 0
+    int level;
+    double homeX, homeY;        // centre set by graphViewFrame, restored on right-click
+    RootProblem problem;
+    Uint32 curveColor;          // ARGB
+    int thickness;
+
+    int dragging;
+    int dragX, dragY;
+    int mouseX, mouseY;         // last pointer position seen in an event
+
+    GraphTile tiles[GRAPH_TILE_CACHE];
+    Uint32 generation;          // bumped when the problem or base scale changes
+    Uint32 frame;
+
+    SDL_Thread* thread;
+    SDL_mutex* lock;
+    SDL_cond* wake;
+    int quit;
+    int queue[GRAPH_TILE_CACHE];    // LIFO: the newest request is rendered first
+    int queued;
+    CurvePolyline* scratch;         // worker-owned
+} GraphView;
+
+static inline double graphPpuX(const GraphView* view) { return ldexp(view->basePpuX, view->level); }
+static inline double graphPpuY(const GraphView* view) { return ldexp(view->basePpuY, view->level); }
+
+static inline double graphToScreenX(const GraphView* view, double x) {
+    return view->rect.x + view->rect.w / 2.0 + (x - view->cx) * graphPpuX(view);
+}
+
+static inline double graphToScreenY(const GraphView* view, double y) {
+    return view->rect.y + view->rect.h / 2.0 - (y - view->cy) * graphPpuY(view);
+}
+
+static inline double graphToWorldX(const GraphView* view, double sx) {
+    return view->cx + (sx - view->rect.x - view->rect.w / 2.0) / graphPpuX(view);
+}
+
+static inline double graphToWorldY(const GraphView* view, double sy) {
+    return view->cy - (sy - view->rect.y - view->rect.h / 2.0) / graphPpuY(view);
+}
+
+// World-space extent of the panel
+static inline void graphBounds(const GraphView* view, double* xMin, double* xMax, double* yMin, double* yMax) {
+    *xMin = graphToWorldX(view, view->rect.x);
+    *xMax = graphToWorldX(view, view->rect.x + view->rect.w);
+    *yMin = graphToWorldY(view, view->rect.y + view->rect.h);
+    *yMax = graphToWorldY(view, view->rect.y);
+}
+
+// Grid spacing in world units: the smallest 1, 2 or 5 x 10^k that is at
+// least minPixels apart on screen
+static inline double graphGridStep(double ppu, double minPixels) {
+    double base = pow(10, floor(log10(minPixels / ppu)));
+    const double steps[] = {1, 2, 5, 10};
+    for (int i = 0; i < 4; i++) {
+        if (base * steps[i] * ppu >= minPixels) return base * steps[i];
+    }
+    return base * 10;
+}
+
+// Grid lines that move with the view
+static inline void graphDrawGrid(DrawList* draw, const GraphView* view, double minPixels, SDL_Color color) {
+    double xMin, xMax, yMin, yMax;
+    graphBounds(view, &xMin, &xMax, &yMin, &yMax);
+    int right = view->rect.x + view->rect.w, bottom = view->rect.y + view->rect.h;
+
+    double step = graphGridStep(graphPpuX(view), minPixels);
+    for (double x = ceil(xMin / step) * step; x <= xMax; x += step) {
+        int sx = (int)lround(graphToScreenX(view, x));
+        drawListLine(draw, sx, view->rect.y, sx, bottom, color);
+    }
+    step = graphGridStep(graphPpuY(view), minPixels);
+    for (double y = ceil(yMin / step) * step; y <= yMax; y += step) {
+        int sy = (int)lround(graphToScreenY(view, y));
+        drawListLine(draw, view->rect.x, sy, right, sy, color);
+    }
+}
+
+// x and y axes where they are on screen
+static inline void graphDrawAxes(DrawList* draw, const GraphView* view, SDL_Color color) {
+    int sx = (int)lround(graphToScreenX(view, 0));
+    int sy = (int)lround(graphToScreenY(view, 0));
+    if (sy >= view->rect.y && sy <= view->rect.y + view->rect.h) {
+        drawListLine(draw, view->rect.x, sy, view->rect.x + view->rect.w, sy, color);
+    }
+    if (sx >= view->rect.x && sx <= view->rect.x + view->rect.w) {
+        drawListLine(draw, sx, view->rect.y, sx, view->rect.y + view->rect.h, color);
+    }
+}
+
+static inline void graphTilePlot(Uint32* pixels, int x, int y, Uint32 color) {
+    if (x >= 0 && x < GRAPH_TILE_SIZE && y >= 0 && y < GRAPH_TILE_SIZE) {
+        pixels[y * GRAPH_TILE_SIZE + x] = color;
+    }
+}
+
+// Bresenham line, clipped to the tile first so far off-tile points are cheap
+static inline void graphTileLine(Uint32* pixels, double x0, double y0, double x1, double y1,
+                                 Uint32 color, int thickness) {
+    double t0 = 0, t1 = 1;
+    double dx = x1 - x0, dy = y1 - y0;
+    double p[4] = {-dx, dx, -dy, dy};
+    double q[4] = {x0 + 1, GRAPH_TILE_SIZE - x0, y0 + thickness, GRAPH_TILE_SIZE - y0};
+    for (int i = 0; i < 4; i++) {
+        if (p[i] == 0) {
+            if (q[i] < 0) return;
+        } else {
+            double t = q[i] / p[i];
+            if (p[i] < 0) { if (t > t1) return; if (t > t0) t0 = t; }
+            else          { if (t < t0) return; if (t < t1) t1 = t; }
+        }
+    }
+
+    int ax = (int)lround(x0 + t0 * dx), ay = (int)lround(y0 + t0 * dy);
+    int bx = (int)lround(x0 + t1 * dx), by = (int)lround(y0 + t1 * dy);
+    int sx = ax < bx ? 1 : -1, sy = ay < by ? 1 : -1;
+    int ex = abs(bx - ax), ey = -abs(by - ay);
+    int err = ex + ey;
+
+    for (;;) {
+        for (int t = 0; t < thickness; t++) graphTilePlot(pixels, ax, ay + t, color);
+        if (ax == bx && ay == by) break;
+        int e2 = 2 * err;
+        if (e2 >= ey) { err += ey; ax += sx; }
+        if (e2 <= ex) { err += ex; ay += sy; }
+    }
+}
+
+static inline double graphCurveF(double x, const void* user) {
+    return problemF(user, x, NULL);
+}
+
+static inline void graphCurveBatch(const double* x, double* y, int n, const void* user) {
+    problemFArray(user, x, y, n);
+}
+
+// Worker side: sample the curve over the tile and draw it into tile->pixels
+static inline void graphRasterTile(GraphView* view, GraphTile* tile) {
+    TRACE_SCOPE("graphRasterTile") {
+        memset(tile->pixels, 0, GRAPH_TILE_SIZE * GRAPH_TILE_SIZE * sizeof(Uint32));
+
+        // Level-space pixel (px, py) is world (px / ppuX, -py / ppuY)
+        CurveView cv;
+        cv.xMin = tile->tx * GRAPH_TILE_SIZE / tile->ppuX;
+        cv.xMax = (tile->tx + 1) * GRAPH_TILE_SIZE / tile->ppuX;
+        cv.yMin = -(tile->ty + 1) * GRAPH_TILE_SIZE / tile->ppuY;
+        cv.yMax = -tile->ty * GRAPH_TILE_SIZE / tile->ppuY;
+        cv.rect = (SDL_Rect){0, 0, GRAPH_TILE_SIZE, GRAPH_TILE_SIZE};
+        cv.tolerance = 0.5;
+
+        CurvePolyline* line = view->scratch;
+        curveSample(line, &cv, graphCurveF, graphCurveBatch, &tile->problem);
+
+        for (int r = 0; r < line->runCount; r++) {
+            int start = line->runStart[r];
+            int end = r + 1 < line->runCount ? line->runStart[r + 1] : line->count;
+            for (int i = start; i < end; i++) {
+                SDL_Point a = line->points[i];
+                SDL_Point b = i + 1 < end ? line->points[i + 1] : a;
+                graphTileLine(tile->pixels, a.x, a.y, b.x, b.y, view->curveColor, view->thickness);
+            }
+        }
+    }
+}
+
+static inline int graphWorkerMain(void* data) {
+    GraphView* view = data;
+
+    for (;;) {
+        SDL_LockMutex(view->lock);
+        while (!view->quit && view->queued == 0) {
+            SDL_CondWait(view->wake, view->lock);
+        }
+        if (view->quit) {
+            SDL_UnlockMutex(view->lock);
+            return 0;
+        }
+        GraphTile* tile = &view->tiles[view->queue[--view->queued]];
+        SDL_UnlockMutex(view->lock);
+
+        graphRasterTile(view, tile);
+        SDL_MemoryBarrierRelease();
+        SDL_AtomicSet(&tile->state, TILE_RENDERED);
+    }
+}
+
+// color is the curve color; thickness in pixels
+static inline int graphViewInit(GraphView* view, SDL_Rect rect, SDL_Color color, int thickness) {
+    memset(view, 0, sizeof(*view));
+    view->rect = rect;
+    view->curveColor = (Uint32)color.a << 24 | (Uint32)color.r << 16 | (Uint32)color.g << 8 | color.b;
+    view->thickness = thickness;
+    view->generation = 1;
+    view->basePpuX = view->basePpuY = 1;
+
+    view->scratch = malloc(sizeof(CurvePolyline));
+    for (int i = 0; i < GRAPH_TILE_CACHE; i++) {
+        view->tiles[i].pixels = malloc(GRAPH_TILE_SIZE * GRAPH_TILE_SIZE * sizeof(Uint32));
+        if (!view->tiles[i].pixels) return 0;
+    }
+    view->lock = SDL_CreateMutex();
+    view->wake = SDL_CreateCond();
+    if (!view->scratch || !view->lock || !view->wake) return 0;
+    view->thread = SDL_CreateThread(graphWorkerMain, "graph-tiles", view);
+    return view->thread != NULL;
+}
+
+static inline void graphViewFree(GraphView* view) {
+    if (view->lock) {
+        SDL_LockMutex(view->lock);
+        view->quit = 1;
+        SDL_CondBroadcast(view->wake);
+        SDL_UnlockMutex(view->lock);
+    }
+    if (view->thread) SDL_WaitThread(view->thread, NULL);
+
+    for (int i = 0; i < GRAPH_TILE_CACHE; i++) {
+        if (view->tiles[i].texture) SDL_DestroyTexture(view->tiles[i].texture);
+        free(view->tiles[i].pixels);
+    }
+    free(view->scratch);
+    if (view->wake) SDL_DestroyCond(view->wake);
+    if (view->lock) SDL_DestroyMutex(view->lock);
+    memset(view, 0, sizeof(*view));
+}
+
+// Show [xMin, xMax] x [yMin, yMax] across the panel at level 0
+static inline void graphViewFrame(GraphView* view, double xMin, double xMax, double yMin, double yMax) {
+    view->cx = 0.5 * (xMin + xMax);
+    view->cy = 0.5 * (yMin + yMax);
+    view->basePpuX = view->rect.w / (xMax - xMin);
+    view->basePpuY = view->rect.h / (yMax - yMin);
+    view->level = 0;
+    view->homeX = view->cx;
+    view->homeY = view->cy;
+    view->generation++;
+}
+
+static inline void graphViewSetProblem(GraphView* view, const RootProblem* problem) {
+    if (view->problem.family != problem->family || view->problem.a != problem->a ||
+        view->problem.b != problem->b || view->problem.c != problem->c) {
+        view->problem = *problem;
+        view->generation++;
+    }
+}
+
+static inline int graphViewContains(const GraphView* view, int x, int y) {
+    return x >= view->rect.x && x < view->rect.x + view->rect.w &&
+           y >= view->rect.y && y < view->rect.y + view->rect.h;
+}
+
+// Mouse wheel zooms about the cursor, left-drag pans, right-click resets.
+// Returns 1 if the event was consumed by the graph.
+static inline int graphViewHandleEvent(GraphView* view, const SDL_Event* e) {
+    // Track the pointer from events rather than SDL_GetMouseState so the
+    // coordinates stay in the caller's space (e.g. below a tab strip)
+    if (e->type == SDL_MOUSEMOTION) {
+        view->mouseX = e->motion.x;
+        view->mouseY = e->motion.y;
+    }
+
+    if (e->type == SDL_MOUSEWHEEL) {
+        int mx = view->mouseX, my = view->mouseY;
+        if (!graphViewContains(view, mx, my) || e->wheel.y == 0) return 0;
+
+        int level = view->level + (e->wheel.y > 0 ? 1 : -1);
+        if (level < GRAPH_MIN_LEVEL || level > GRAPH_MAX_LEVEL) return 1;
+
+        // Keep the world point under the cursor fixed
+        double wx = graphToWorldX(view, mx);
+        double wy = graphToWorldY(view, my);
+        view->level = level;
+        view->cx += wx - graphToWorldX(view, mx);
+        view->cy += wy - graphToWorldY(view, my);
+        return 1;
+    }
+    if (e->type == SDL_MOUSEBUTTONDOWN && e->button.button == SDL_BUTTON_LEFT &&
+        graphViewContains(view, e->button.x, e->button.y)) {
+        view->dragging = 1;
+        view->dragX = e->button.x;
+        view->dragY = e->button.y;
+        return 1;
+    }
+    if (e->type == SDL_MOUSEBUTTONDOWN && e->button.button == SDL_BUTTON_RIGHT &&
+        graphViewContains(view, e->button.x, e->button.y)) {
+        view->cx = view->homeX;
+        view->cy = view->homeY;
+        view->level = 0;
+        return 1;
+    }
+    if (e->type == SDL_MOUSEMOTION && view->dragging) {
+        view->cx -= (e->motion.x - view->dragX) / graphPpuX(view);
+        view->cy += (e->motion.y - view->dragY) / graphPpuY(view);
+        view->dragX = e->motion.x;
+        view->dragY = e->motion.y;
+        return 1;
+    }
+    if (e->type == SDL_MOUSEBUTTONUP && e->button.button == SDL_BUTTON_LEFT) {
+        view->dragging = 0;
+    }
+    return 0;
+}
+
+static inline GraphTile* graphFindTile(GraphView* view, int level, int tx, int ty) {
+    for (int i = 0; i < GRAPH_TILE_CACHE; i++) {
+        GraphTile* tile = &view->tiles[i];
+        if (tile->generation == view->generation && tile->level == level &&
+            tile->tx == tx && tile->ty == ty && SDL_AtomicGet(&tile->state) != TILE_FREE) {
+            return tile;
+        }
+    }
+    return NULL;
+}
+
+// Queue a tile for rendering, recycling a stale or least recently used one
+static inline void graphRequestTile(GraphView* view, int level, int tx, int ty) {
+    GraphTile* victim = NULL;
+    for (int i = 0; i < GRAPH_TILE_CACHE; i++) {
+        GraphTile* tile = &view->tiles[i];
+        int state = SDL_AtomicGet(&tile->state);
+        if (state == TILE_QUEUED) continue;     // the worker may be writing it
+        if (state == TILE_FREE || tile->generation != view->generation) {
+            victim = tile;
+            break;
+        }
+        if (tile->lastUsed != view->frame && (!victim || tile->lastUsed < victim->lastUsed)) {
+            victim = tile;
+        }
+    }
+    if (!victim) return;
+
+    victim->level = level;
+    victim->tx = tx;
+    victim->ty = ty;
+    victim->generation = view->generation;
+    victim->lastUsed = view->frame;
+    victim->problem = view->problem;
+    victim->ppuX = ldexp(view->basePpuX, level);
+    victim->ppuY = ldexp(view->basePpuY, level);
+    SDL_AtomicSet(&victim->state, TILE_QUEUED);
+
+    SDL_LockMutex(view->lock);
+    view->queue[view->queued++] = (int)(victim - view->tiles);
+    SDL_CondSignal(view->wake);
+    SDL_UnlockMutex(view->lock);
+}
+
+// Upload a freshly rendered tile; returns its texture once usable
+static inline SDL_Texture* graphTileTexture(SDL_Renderer* renderer, GraphView* view, GraphTile* tile) {
+    int state = SDL_AtomicGet(&tile->state);
+    if (state == TILE_RENDERED) {
+        SDL_MemoryBarrierAcquire();
+        if (!tile->texture) {
+            tile->texture = hudCreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+                                              GRAPH_TILE_SIZE, GRAPH_TILE_SIZE);
+            if (!tile->texture) return NULL;
+            SDL_SetTextureBlendMode(tile->texture, SDL_BLENDMODE_BLEND);
+        }
+        SDL_UpdateTexture(tile->texture, NULL, tile->pixels, GRAPH_TILE_SIZE * sizeof(Uint32));
+        SDL_AtomicSet(&tile->state, TILE_READY);
+        state = TILE_READY;
+    }
+    tile->lastUsed = view->frame;
+    return state == TILE_READY ? tile->texture : NULL;
+}
+
+// Draw the curve tiles covering the panel
+static inline void graphViewRender(SDL_Renderer* renderer, GraphView* view) {
+    view->frame++;
+
+    TRACE_SCOPE("graphViewRender") {
+        SDL_Rect oldClip;
+        int clipped = SDL_RenderIsClipEnabled(renderer);
+        if (clipped) SDL_RenderGetClipRect(renderer, &oldClip);
+        SDL_RenderSetClipRect(renderer, &view->rect);
+
+        // Level-space pixel shown at the panel's top-left corner
+        double originX = view->cx * graphPpuX(view) - view->rect.w / 2.0;
+        double originY = -view->cy * graphPpuY(view) - view->rect.h / 2.0;
+        int tx0 = (int)floor(originX / GRAPH_TILE_SIZE);
+        int ty0 = (int)floor(originY / GRAPH_TILE_SIZE);
+        int tx1 = (int)floor((originX + view->rect.w) / GRAPH_TILE_SIZE);
+        int ty1 = (int)floor((originY + view->rect.h) / GRAPH_TILE_SIZE);
+
+        for (int ty = ty0; ty <= ty1; ty++) {
+            for (int tx = tx0; tx <= tx1; tx++) {
+                SDL_Rect dst = {view->rect.x + (int)floor(tx * GRAPH_TILE_SIZE - originX),
+                                view->rect.y + (int)floor(ty * GRAPH_TILE_SIZE - originY),
+                                GRAPH_TILE_SIZE, GRAPH_TILE_SIZE};
+
+                GraphTile* tile = graphFindTile(view, view->level, tx, ty);
+                if (!tile) {
+                    graphRequestTile(view, view->level, tx, ty);
+                } else {
+                    SDL_Texture* texture = graphTileTexture(renderer, view, tile);
+                    if (texture) {
+                        hudRenderCopy(renderer, texture, NULL, &dst);
+                        continue;
+                    }
+                }
+
+                // Not ready yet: stretch the matching quarter of the parent tile
+                int px = (int)floor(tx / 2.0), py = (int)floor(ty / 2.0);
+                GraphTile* parent = graphFindTile(view, view->level - 1, px, py);
+                SDL_Texture* texture = parent ? graphTileTexture(renderer, view, parent) : NULL;
+                if (texture) {
+                    SDL_Rect src = {(tx - 2 * px) * GRAPH_TILE_SIZE / 2, (ty - 2 * py) * GRAPH_TILE_SIZE / 2,
+                                    GRAPH_TILE_SIZE / 2, GRAPH_TILE_SIZE / 2};
+                    hudRenderCopy(renderer, texture, &src, &dst);
+                }
+            }
+        }
+
+        SDL_RenderSetClipRect(renderer, clipped ? &oldClip : NULL);
+    }
+}
+
+#endif
@@ -3,19 +3,23 @@
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
+#include "frame_hud.h"
+#include "trace_events.h"
+#include "iteration_table.h"
+#include "solve_worker.h"
+#include "app_host.h"
+#include "root_solvers.h"
+#include "graph_view.h"
+#include "raster_canvas.h"
+#include "root_polish.h"
+#include "fixed_point_race.h"
+#include "poly_roots.h"
 
-#define MAX_ITER 100
+#define MAX_ITER 100          // default budget; a stop spec may raise it
 #define TOLERANCE 0.001
 #define WINDOW_WIDTH 1400
 #define WINDOW_HEIGHT 800
 
-// Iteration data structure
-typedef struct {
-    double xn;
-    double xn1;
-    double error;
-} IterationRow;
-
 // UI Element structure
 typedef struct {
     SDL_Rect rect;
@@ -31,80 +35,111 @@ typedef struct {
     int clicked;
 } Button;
 
-// Fixed point iteration methods
-double g(double x, double a, double b, double c, int method) {
-    switch(method) {
-        case 1: return -(a * x * x + c) / b;
-        case 2: 
-            if (fabs(a * x + b) < 1e-10) return NAN;
-            return -c / (a * x + b);
-        case 3: 
-            if (a == 0 || (-b * x - c) / a < 0) return NAN;
-            return sqrt((-b * x - c) / a);
-        case 4: 
-            if (a == 0 || (-b * x - c) / a < 0) return NAN;
-            return -sqrt((-b * x - c) / a);
-        case 5: 
-            if (b == 0) return NAN;
-            return (x * x - c / a) / (-b / a);
-        default: return NAN;
-    }
-}
+// What the tab shows, kept while the user is on other tabs (appHostTabState)
+typedef struct {
+    int saved;
+    char values[5][50];
+    char resultText[500];
+    double finalRoot;
+    int hasValidRoot;
+    double coefA, coefB, coefC;
+    double realRoots[2];
+    int realRootCount;
+    char rootsText[100];
+    RootProblemDD precise;
+    int preciseOk;
+    int polishMode;
+    char polishText[128];
+    int tableScrollOffset;
+    IterationTable table;
+} FixedPointState;
 
-double f(double x, double a, double b, double c) {
-    return a * x * x + b * x + c;
+// Fixed point solve run on a worker thread
+// params: a, b, c, x0; intParams: method; spec: stop rules; rows: x_n, x_(n+1), error
+// data: the auto mode's race, if raced; stats: failure code, won the race
+static void fixedPointJob(SolveJob* job) {
+    RootProblem problem = {PROBLEM_QUADRATIC, job->params[0], job->params[1], job->params[2]};
+    RootSolver solver;
+    solverInit(&solver, SOLVER_FIXED_POINT, &problem, job->params[3], 0, TOLERANCE, MAX_ITER);
+    solver.form = job->intParams[0];
+    stopPolicyParse(&solver.stop, job->spec);
+    
+    SessionTrace trace;
+    sessionTraceBegin(&trace, job->session, &solver);
+    
+    SolverRow row;
+    int status;
+    do {
+        status = solverStep(&solver, &row);
+        sessionTraceAdd(&trace, &row);
+        if (row.count && !solveJobRow(job, row.n, row.v, row.count)) {
+            fixedPointLaneLog(job, &solver, &trace, 0);
+            solveJobFinish(job, SOLVE_CANCELLED, 0);
+            return;
+        }
+    } while (status == SOLVER_RUNNING);
+    fixedPointLaneLog(job, &solver, &trace, status == SOLVER_CONVERGED);
+    
+    if (status == SOLVER_CONVERGED) {
+        sprintf(job->message, "SUCCESS!\nRoot: x = %.4lf\nIterations: %d", solver.root, solver.n);
+    } else {
+        sprintf(job->message, "FAILED: %s\nTry different method or x0", solverFailureName(solver.failure));
+    }
+    solverAppendCost(job->message, sizeof(job->message), &solver.cost);
+    job->stats[0] = solver.failure;
+    solveJobFinish(job, status == SOLVER_CONVERGED ? SOLVE_CONVERGED : SOLVE_FAILED, solver.root);
 }
 
-void renderText(SDL_Renderer* renderer, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
+// The draw list frees the texture once the frame is submitted
+static void renderText(DrawList* draw, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
     SDL_Surface* surface = TTF_RenderText_Blended(font, text, color);
     if (!surface) return;
     
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
     SDL_Rect rect = {x, y, surface->w, surface->h};
-    SDL_RenderCopy(renderer, texture, NULL, &rect);
+    drawListTexture(draw, texture, NULL, &rect, 1);
     
     SDL_FreeSurface(surface);
-    SDL_DestroyTexture(texture);
 }
 
-void renderInputBox(SDL_Renderer* renderer, TTF_Font* font, InputBox* box) {
+static void renderInputBox(DrawList* draw, TTF_Font* font, InputBox* box) {
     // Box background
+    SDL_Color fill;
     if (box->active) {
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+        fill = (SDL_Color){255, 255, 255, 255};
     } else {
-        SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
+        fill = (SDL_Color){200, 200, 200, 255};
     }
-    SDL_RenderFillRect(renderer, &box->rect);
+    drawListFillRect(draw, &box->rect, fill);
     
     // Box border
-    SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255);
-    SDL_RenderDrawRect(renderer, &box->rect);
+    drawListRect(draw, &box->rect, (SDL_Color){100, 100, 100, 255});
     
     // Label
     SDL_Color labelColor = {50, 50, 50, 255};
-    renderText(renderer, font, box->label, box->rect.x - 80, box->rect.y + 5, labelColor);
+    renderText(draw, font, box->label, box->rect.x - 80, box->rect.y + 5, labelColor);
     
     // Value
     SDL_Color textColor = {0, 0, 0, 255};
     if (strlen(box->value) > 0) {
-        renderText(renderer, font, box->value, box->rect.x + 5, box->rect.y + 5, textColor);
+        renderText(draw, font, box->value, box->rect.x + 5, box->rect.y + 5, textColor);
     }
 }
 
-void renderButton(SDL_Renderer* renderer, TTF_Font* font, Button* btn) {
+static void renderButton(DrawList* draw, TTF_Font* font, Button* btn) {
     // Button background
+    SDL_Color fill;
     if (btn->clicked) {
-        SDL_SetRenderDrawColor(renderer, 60, 120, 60, 255);
+        fill = (SDL_Color){60, 120, 60, 255};
     } else if (btn->hovered) {
-        SDL_SetRenderDrawColor(renderer, 80, 160, 80, 255);
+        fill = (SDL_Color){80, 160, 80, 255};
     } else {
-        SDL_SetRenderDrawColor(renderer, 70, 140, 70, 255);
+        fill = (SDL_Color){70, 140, 70, 255};
     }
-    SDL_RenderFillRect(renderer, &btn->rect);
+    drawListFillRect(draw, &btn->rect, fill);
     
     // Button border
-    SDL_SetRenderDrawColor(renderer, 40, 90, 40, 255);
-    SDL_RenderDrawRect(renderer, &btn->rect);
+    drawListRect(draw, &btn->rect, (SDL_Color){40, 90, 40, 255});
     
     // Button text (centered)
     SDL_Color textColor = {255, 255, 255, 255};
@@ -112,86 +147,59 @@ void renderButton(SDL_Renderer* renderer, TTF_Font* font, Button* btn) {
     if (surface) {
         int textX = btn->rect.x + (btn->rect.w - surface->w) / 2;
         int textY = btn->rect.y + (btn->rect.h - surface->h) / 2;
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+        SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
         SDL_Rect textRect = {textX, textY, surface->w, surface->h};
-        SDL_RenderCopy(renderer, texture, NULL, &textRect);
+        drawListTexture(draw, texture, NULL, &textRect, 1);
         SDL_FreeSurface(surface);
-        SDL_DestroyTexture(texture);
     }
 }
 
-void drawGraph(SDL_Renderer* renderer, double a, double b, double c, double root, int hasRoot) {
-    int graphX = 930;
-    int graphY = 150;
-    int graphW = 400;
-    int graphH = 300;
-    int scale = 10;
-    int centerX = graphX + graphW / 2;
-    int centerY = graphY + graphH / 2;
-    
-    // Graph background
-    SDL_SetRenderDrawColor(renderer, 30, 35, 45, 255);
-    SDL_Rect graphRect = {graphX, graphY, graphW, graphH};
-    SDL_RenderFillRect(renderer, &graphRect);
-    
-    // Grid lines
-    SDL_SetRenderDrawColor(renderer, 50, 60, 70, 255);
-    for (int i = graphX; i <= graphX + graphW; i += scale) {
-        SDL_RenderDrawLine(renderer, i, graphY, i, graphY + graphH);
-    }
-    for (int i = graphY; i <= graphY + graphH; i += scale) {
-        SDL_RenderDrawLine(renderer, graphX, i, graphX + graphW, i);
-    }
+// The view pans and zooms; the curve itself comes from its tile cache.
+// The fixed point root is a red disc, every real root polySolve found a ring.
+static void drawGraph(DrawList* draw, GraphView* view, RasterCanvas* marks, double a, double b, double c,
+                      double root, int hasRoot, const double* roots, int rootCount) {
+    SDL_Renderer* renderer = draw->renderer;
+    drawListFillRect(draw, &view->rect, (SDL_Color){30, 35, 45, 255});
+    graphDrawGrid(draw, view, 10, (SDL_Color){50, 60, 70, 255});
+    graphDrawAxes(draw, view, (SDL_Color){200, 200, 210, 255});
+    drawListFlush(draw);
     
-    // Main axes
-    SDL_SetRenderDrawColor(renderer, 200, 200, 210, 255);
-    SDL_RenderDrawLine(renderer, centerX, graphY, centerX, graphY + graphH);
-    SDL_RenderDrawLine(renderer, graphX, centerY, graphX + graphW, centerY);
-    
-    // Draw parabola
-    SDL_SetRenderDrawColor(renderer, 100, 255, 100, 255);
-    for (int px = graphX; px < graphX + graphW; px++) {
-        double x = (px - centerX) / (double)scale;
-        double y = f(x, a, b, c);
-        int py = centerY - (int)(y * scale);
-        
-        if (py >= graphY && py < graphY + graphH) {
-            SDL_RenderDrawPoint(renderer, px, py);
-            SDL_RenderDrawPoint(renderer, px, py + 1);
-        }
-    }
+    RootProblem problem = {PROBLEM_QUADRATIC, a, b, c};
+    graphViewSetProblem(view, &problem);
+    graphViewRender(renderer, view);
     
-    // Draw root marker if exists
-    if (hasRoot) {
-        SDL_SetRenderDrawColor(renderer, 255, 80, 80, 255);
-        int root_x = centerX + (int)(root * scale);
-        for (int i = -8; i <= 8; i++) {
-            for (int j = -8; j <= 8; j++) {
-                if (i*i + j*j <= 64) {
-                    SDL_RenderDrawPoint(renderer, root_x + i, centerY + j);
-                }
-            }
+    // Root markers, redrawn only when the view or the roots move
+    double key[] = {view->cx, view->cy, graphPpuX(view), graphPpuY(view), root, hasRoot,
+                    rootCount > 0 ? roots[0] : 0, rootCount > 1 ? roots[1] : 0, rootCount};
+    if (canvasBegin(marks, key, sizeof(key))) {
+        canvasClear(marks, 0);
+        double y = graphToScreenY(view, 0) - view->rect.y + 0.5;
+        if (hasRoot) {
+            canvasDisc(marks, graphToScreenX(view, root) - view->rect.x + 0.5, y, 8.5, 0xFFFF5050);
+        }
+        for (int i = 0; i < rootCount; i++) {
+            canvasRing(marks, graphToScreenX(view, roots[i]) - view->rect.x + 0.5, y, 10, 12.5, 0xFF50B4FF);
         }
     }
+    canvasRender(renderer, marks, view->rect.x, view->rect.y);
 }
 
-int main(int argc, char* argv[]) {
-    SDL_Init(SDL_INIT_VIDEO);
-    TTF_Init();
-    
-    SDL_Window* window = SDL_CreateWindow("Fixed Point Iteration - GUI",
-        SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
-        WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_SHOWN);
-    
-    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+static void fixedPointStateFree(void* state) {
+    FixedPointState* saved = state;
+    if (saved->saved) tableFree(&saved->table);
+}
+
+int fixedPointRun(AppHost* host) {
+    SDL_Renderer* renderer = host->renderer;
+    DrawList* draw = &host->draw;
     
-    TTF_Font* font = TTF_OpenFont("font.ttf", 18);
-    TTF_Font* fontSmall = TTF_OpenFont("font.ttf", 14);
-    TTF_Font* fontMedium = TTF_OpenFont("font.ttf", 16);
-    TTF_Font* fontTitle = TTF_OpenFont("font.ttf", 24);
+    TTF_Font* font = appHostFont(host, 18);
+    TTF_Font* fontSmall = appHostFont(host, 14);
+    TTF_Font* fontMedium = appHostFont(host, 16);
+    TTF_Font* fontTitle = appHostFont(host, 24);
     
-    if (!font || !fontSmall || !fontMedium || !fontTitle) {
-        printf("Error loading font: %s\n", TTF_GetError());
+    FixedPointState* saved = appHostTabState(host, sizeof(FixedPointState), fixedPointStateFree);
+    if (!font || !fontSmall || !fontMedium || !fontTitle || !saved) {
         return 1;
     }
     
@@ -205,6 +213,16 @@ int main(int argc, char* argv[]) {
         inputs[i].active = 0;
     }
     strcpy(inputs[4].value, "1"); // Default method
+    if (saved->saved) {
+        for (int i = 0; i < 5; i++) {
+            strcpy(inputs[i].value, saved->values[i]);
+        }
+    }
+    
+    // Inputs handed over by another tab, e.g. a cell picked in the sweep
+    for (int i = 0; i < 5; i++) {
+        appHostPreset(host, i, inputs[i].value, sizeof(inputs[i].value));
+    }
     
     // Compute button
     Button computeBtn = {{140, 540, 150, 45}, "COMPUTE", 0, 0};
@@ -212,21 +230,91 @@ int main(int argc, char* argv[]) {
     // Clear button
     Button clearBtn = {{140, 600, 150, 45}, "CLEAR", 0, 0};
     
+    // Iteration table (rows formatted once per solve)
+    const int tableColumns[] = {10, 80, 210, 350};
+    IterationTable table;
+    if (saved->saved) {
+        table = saved->table;
+    } else {
+        tableInit(&table, fontSmall, 460, 25, 3, 4, tableColumns, (SDL_Color){20, 20, 20, 255},
+                  (SDL_Color){245, 245, 250, 255}, (SDL_Color){235, 235, 245, 255});
+    }
+    
     // Result variables
     char resultText[500] = "";
     double finalRoot = 0;
     int hasValidRoot = 0;
     double coefA = 0, coefB = 0, coefC = 0;
-    IterationRow iterations[MAX_ITER];
+    
+    // Every root of ax^2 + bx + c, as the N = 2 case of the Poly tab's solver,
+    // to set the fixed point result against
+    double realRoots[2];
+    int realRootCount = 0;
+    char rootsText[100] = "";
+    
+    // Root polished to ~30 digits in double-double, toggled with F4
+    RootProblemDD precise;
+    int preciseOk = 0;
+    int polishMode = 0;
+    char polishText[128] = "";
     int totalIterations = 0;
     
     int activeInput = -1;
     int quit = 0;
     int tableScrollOffset = 0;
+    
+    // Back on this tab: show what it showed when the user left
+    if (saved->saved) {
+        strcpy(resultText, saved->resultText);
+        finalRoot = saved->finalRoot;
+        hasValidRoot = saved->hasValidRoot;
+        coefA = saved->coefA;
+        coefB = saved->coefB;
+        coefC = saved->coefC;
+        memcpy(realRoots, saved->realRoots, sizeof(realRoots));
+        realRootCount = saved->realRootCount;
+        strcpy(rootsText, saved->rootsText);
+        precise = saved->precise;
+        preciseOk = saved->preciseOk;
+        polishMode = saved->polishMode;
+        strcpy(polishText, saved->polishText);
+        tableScrollOffset = saved->tableScrollOffset;
+        totalIterations = table.rowCount;
+    }
+    
+    // Solves run on the host's worker pool and stream their rows back,
+    // with this tab's stop rules (F6)
+    SolveWorkerPool* pool = &host->pool;
+    appHostUseStopRules(host);
+    SolveJob* activeJob = NULL;
+    
+    // Auto mode: every rearrangement that contracts near x0 runs at once,
+    // the first to converge wins and the rest are cancelled
+    FormEstimate ranking[FP_AUTO_FORMS];
+    AutoLane lanes[FP_AUTO_FORMS];
+    memset(lanes, 0, sizeof(lanes));
+    int laneCount = 0;
+    int racing = 0;
+    
+    // Pannable graph; curve tiles are rasterized on a background thread
+    GraphView graphView;
+    graphViewInit(&graphView, (SDL_Rect){930, 150, 400, 300}, (SDL_Color){100, 255, 100, 255}, 2);
+    graphViewFrame(&graphView, -20, 20, -15, 15);
+    RasterCanvas markCanvas;
+    canvasInit(&markCanvas, renderer, graphView.rect.w, graphView.rect.h);
+    
+    // Frame timing overlay, toggled with F3
+    FrameHud hud;
+    hudInit(&hud);
     SDL_Event e;
     
-    while (!quit) {
-        while (SDL_PollEvent(&e)) {
+    while (!quit && !appHostSwitching(host)) {
+        hudBeginFrame(&hud);
+        
+        while (appHostPollEvent(host, &e)) {
+            if (appHostEvent(host, &e)) continue;
+            if (graphViewHandleEvent(&graphView, &e)) continue;
+            
             if (e.type == SDL_QUIT) {
                 quit = 1;
             }
@@ -250,56 +338,100 @@ int main(int argc, char* argv[]) {
                     my >= computeBtn.rect.y && my <= computeBtn.rect.y + computeBtn.rect.h) {
                     computeBtn.clicked = 1;
                     
-                    // Parse inputs
-                    coefA = atof(inputs[0].value);
-                    coefB = atof(inputs[1].value);
-                    coefC = atof(inputs[2].value);
-                    double x0 = atof(inputs[3].value);
-                    int method = atoi(inputs[4].value);
-                    
-                    if (method < 1 || method > 5) {
-                        sprintf(resultText, "Error: Method must be 1-5");
-                        hasValidRoot = 0;
+                    if (activeJob) {
+                        // Button reads CANCEL while a solve is running
+                        solveJobCancel(activeJob);
+                        solveJobRelease(activeJob);
+                        activeJob = NULL;
+                        strcpy(computeBtn.text, "COMPUTE");
+                        sprintf(resultText, "CANCELLED after %d iterations\nPress COMPUTE to start again", totalIterations);
+                    } else if (racing) {
+                        autoCancel(lanes, laneCount);
+                        racing = 0;
+                        strcpy(computeBtn.text, "COMPUTE");
+                        sprintf(resultText, "CANCELLED the race of %d forms\nPress COMPUTE to start again", laneCount);
                     } else {
-                        // Run Fixed Point Iteration
-                        double x_current = x0;
-                        int iter = 0;
-                        int diverged = 0;
-                        totalIterations = 0;
+                        // Parse inputs
+                        coefA = atof(inputs[0].value);
+                        coefB = atof(inputs[1].value);
+                        coefC = atof(inputs[2].value);
+                        preciseOk = polishProblemParse(&precise, PROBLEM_QUADRATIC, inputs[0].value,
+                                                       inputs[1].value, inputs[2].value);
+                        double x0 = atof(inputs[3].value);
+                        int method = atoi(inputs[4].value);
                         
-                        for (iter = 0; iter < MAX_ITER; iter++) {
-                            double x_next = g(x_current, coefA, coefB, coefC, method);
-                            double error = fabs(x_next - x_current);
-                            
-                            // Store iteration data
-                            iterations[iter].xn = x_current;
-                            iterations[iter].xn1 = x_next;
-                            iterations[iter].error = error;
-                            totalIterations++;
-                            
-                            if (isnan(x_next) || isinf(x_next) || fabs(x_next) > 1e10) {
-                                diverged = 1;
-                                break;
-                            }
-                            
-                            x_current = x_next;
-                            
-                            if (error < TOLERANCE) {
-                                break;
+                        double quadratic[] = {coefA, coefB, coefC};
+                        realRootCount = polyRealRoots(quadratic, 3, realRoots);
+                        if (realRootCount < 0) {
+                            strcpy(rootsText, "Roots: the solve gave up");
+                        } else if (realRootCount == 0) {
+                            strcpy(rootsText, "Roots: no real roots");
+                        } else {
+                            int len = sprintf(rootsText, "Roots:");
+                            for (int i = 0; i < realRootCount; i++) {
+                                len += sprintf(rootsText + len, "%s x = %.6lf", i ? "," : "", realRoots[i]);
                             }
                         }
                         
-                        finalRoot = x_current;
-                        double verification = fabs(f(finalRoot, coefA, coefB, coefC));
+                        totalIterations = 0;
+                        hasValidRoot = 0;
+                        tableScrollOffset = 0;
+                        tableClear(&table);
+                        polishDescribe(polishText, sizeof(polishText), "\n", polishMode, NULL, 0, 0);
                         
-                        if (diverged || verification > 0.1) {
-                            sprintf(resultText, "FAILED: %s\nTry different method or x0",
-                                    diverged ? "Diverged" : "Did not converge");
-                            hasValidRoot = 0;
+                        if (method < 0 || method > 5) {
+                            sprintf(resultText, "Error: Method must be 1-5, or 0 for auto");
+                        } else if (method == 0) {
+                            // Rank the forms by |g'| near x0 and race the contractive ones
+                            RootProblem problem = {PROBLEM_QUADRATIC, coefA, coefB, coefC};
+                            int contractive = fixedPointRankForms(&problem, x0, ranking, NULL);
+                            FixedPointRace* race = contractive ? fixedPointRaceCreate() : NULL;
+                            laneCount = 0;
+                            for (int i = 0; race && i < contractive; i++) {
+                                AutoLane* lane = &lanes[laneCount];
+                                lane->job = solveJobCreate(fixedPointJob);
+                                if (!lane->job) break;
+                                lane->estimate = ranking[i];
+                                lane->rowCount = 0;
+                                lane->status = SOLVE_RUNNING;
+                                lane->won = 0;
+                                lane->job->params[0] = coefA;
+                                lane->job->params[1] = coefB;
+                                lane->job->params[2] = coefC;
+                                lane->job->params[3] = x0;
+                                lane->job->intParams[0] = ranking[i].form;
+                                snprintf(lane->job->spec, sizeof(lane->job->spec), "%s", appHostStopSpec(host));
+                                lane->job->session = &host->session;
+                                fixedPointRaceJoin(race, lane->job);
+                                solvePoolSubmit(pool, lane->job);
+                                laneCount++;
+                            }
+                            fixedPointRaceRelease(race);
+                            racing = laneCount;
+                            if (racing) {
+                                strcpy(computeBtn.text, "CANCEL");
+                                sprintf(resultText, "Auto: racing %d of 5 forms...", racing);
+                            } else if (contractive) {
+                                strcpy(resultText, "Error: could not start the race\nOut of memory");
+                            } else {
+                                sprintf(resultText, "FAILED: no form contracts near x0\nSmallest |g'|: g%d = %.3g\nTry a different x0",
+                                        ranking[0].form, ranking[0].contraction);
+                            }
                         } else {
-                            sprintf(resultText, "SUCCESS!\nRoot: x = %.4lf\nIterations: %d",
-                                    finalRoot, totalIterations);
-                            hasValidRoot = 1;
+                            // Run Fixed Point Iteration on the worker pool
+                            activeJob = solveJobCreate(fixedPointJob);
+                            if (activeJob) {
+                                activeJob->params[0] = coefA;
+                                activeJob->params[1] = coefB;
+                                activeJob->params[2] = coefC;
+                                activeJob->params[3] = x0;
+                                activeJob->intParams[0] = method;
+                                snprintf(activeJob->spec, sizeof(activeJob->spec), "%s", appHostStopSpec(host));
+                                activeJob->session = &host->session;
+                                solvePoolSubmit(pool, activeJob);
+                                strcpy(computeBtn.text, "CANCEL");
+                                strcpy(resultText, "Solving...");
+                            }
                         }
                     }
                 }
@@ -307,14 +439,26 @@ int main(int argc, char* argv[]) {
                 // Check clear button
                 if (mx >= clearBtn.rect.x && mx <= clearBtn.rect.x + clearBtn.rect.w &&
                     my >= clearBtn.rect.y && my <= clearBtn.rect.y + clearBtn.rect.h) {
+                    if (activeJob) {
+                        solveJobCancel(activeJob);
+                        solveJobRelease(activeJob);
+                        activeJob = NULL;
+                    }
+                    autoCancel(lanes, laneCount);
+                    racing = 0;
+                    strcpy(computeBtn.text, "COMPUTE");
                     for (int i = 0; i < 4; i++) {
                         strcpy(inputs[i].value, "");
                     }
                     strcpy(inputs[4].value, "1");
                     strcpy(resultText, "");
                     hasValidRoot = 0;
+                    realRootCount = 0;
+                    rootsText[0] = '\0';
                     totalIterations = 0;
                     tableScrollOffset = 0;
+                    tableClear(&table);
+                    polishDescribe(polishText, sizeof(polishText), "\n", polishMode, NULL, 0, 0);
                     clearBtn.clicked = 1;
                 }
             }
@@ -347,6 +491,16 @@ int main(int argc, char* argv[]) {
                 }
             }
             
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F3) {
+                hudToggle(&hud);
+            }
+            
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F4) {
+                polishMode = !polishMode;
+                polishDescribe(polishText, sizeof(polishText), "\n", polishMode,
+                               preciseOk ? &precise : NULL, hasValidRoot, finalRoot);
+            }
+            
             if (e.type == SDL_KEYDOWN && activeInput >= 0) {
                 if (e.key.keysym.sym == SDLK_BACKSPACE) {
                     int len = strlen(inputs[activeInput].value);
@@ -370,46 +524,116 @@ int main(int argc, char* argv[]) {
             }
         }
         
+        hudPhase(&hud, HUD_SOLVE);
+        
+        // Drain rows streamed back from the solver worker
+        if (activeJob) {
+            SolveMessage msg;
+            int budget = SOLVE_DRAIN_BUDGET;
+            while (activeJob && budget-- > 0 && solveJobPop(activeJob, &msg)) {
+                if (msg.type == SOLVE_MSG_ROW) {
+                    // Rows go straight into the table, which grows as needed
+                    int row = tableAppendRow(&table);
+                    if (row < 0) continue;
+                    totalIterations = table.rowCount;
+                    tableSetCell(&table, row, 0, "%d", msg.n);
+                    tableSetCell(&table, row, 1, "%.4lf", msg.v[0]);
+                    tableSetCell(&table, row, 2, "%.4lf", msg.v[1]);
+                    tableSetCell(&table, row, 3, "%.6lf", msg.v[2]);
+                    sprintf(resultText, "Solving...\nIterations so far: %d", totalIterations);
+                } else if (msg.type == SOLVE_MSG_DONE) {
+                    strcpy(resultText, activeJob->message);
+                    finalRoot = activeJob->root;
+                    hasValidRoot = (activeJob->status == SOLVE_CONVERGED);
+                    polishDescribe(polishText, sizeof(polishText), "\n", polishMode,
+                                   preciseOk ? &precise : NULL, hasValidRoot, finalRoot);
+                    solveJobRelease(activeJob);
+                    activeJob = NULL;
+                    strcpy(computeBtn.text, "COMPUTE");
+                }
+            }
+        }
+        
+        // Drain the raced forms; the lane that claimed the race wins and
+        // the rest are cancelled
+        if (racing) {
+            int winner = autoDrain(lanes, laneCount, &racing);
+            
+            if (winner >= 0) {
+                autoCancel(lanes, laneCount);
+                racing = 0;
+                AutoLane* lane = &lanes[winner];
+                for (int i = 0; i < lane->rowCount; i++) {
+                    const double* v = lane->rows + (size_t)i * 3;
+                    int row = tableAppendRow(&table);
+                    if (row < 0) break;
+                    tableSetCell(&table, row, 0, "%d", i + 1);
+                    tableSetCell(&table, row, 1, "%.4lf", v[0]);
+                    tableSetCell(&table, row, 2, "%.4lf", v[1]);
+                    tableSetCell(&table, row, 3, "%.6lf", v[2]);
+                }
+                totalIterations = table.rowCount;
+                
+                // The winner's own message, with its first line naming the form
+                const char* rest = strchr(lane->message, '\n');
+                snprintf(resultText, sizeof(resultText), "SUCCESS! Auto: g%d, |g'| ~ %.2f%s",
+                         lane->estimate.form, lane->estimate.contraction, rest ? rest : "");
+                finalRoot = lane->root;
+                hasValidRoot = 1;
+                polishDescribe(polishText, sizeof(polishText), "\n", polishMode,
+                               preciseOk ? &precise : NULL, hasValidRoot, finalRoot);
+                strcpy(computeBtn.text, "COMPUTE");
+            } else if (!racing) {
+                int len = sprintf(resultText, "FAILED: none of the %d raced forms converged", laneCount);
+                for (int i = 0; i < laneCount && i < 4; i++) {
+                    len += sprintf(resultText + len, "\ng%d (|g'| ~ %.2f): %s", lanes[i].estimate.form,
+                                   lanes[i].estimate.contraction, solverFailureName(lanes[i].failure));
+                }
+                strcpy(computeBtn.text, "COMPUTE");
+            }
+        }
+        
         // Rendering
+        hudPhase(&hud, HUD_TEXT);
         SDL_SetRenderDrawColor(renderer, 240, 240, 245, 255);
-        SDL_RenderClear(renderer);
+        hudRenderClear(renderer);
         
         // Header Information
         SDL_Color headerColor = {20, 20, 60, 255};
-        renderText(renderer, fontMedium, "MT211 - Numerical Method", 50, 15, headerColor);
-        renderText(renderer, fontSmall, "Semestral Project", 50, 40, headerColor);
+        renderText(draw, fontMedium, "MT211 - Numerical Method", 50, 15, headerColor);
+        renderText(draw, fontSmall, "Semestral Project", 50, 40, headerColor);
         
         SDL_Color submittedColor = {60, 60, 80, 255};
-        renderText(renderer, fontSmall, "Submitted By:", 50, 70, submittedColor);
-        renderText(renderer, fontSmall, "BSCPE 22001", 50, 90, submittedColor);
-        renderText(renderer, fontSmall, "Emmanuel Jr Porsona", 50, 110, submittedColor);
-        renderText(renderer, fontSmall, "Amit Jeed", 50, 130, submittedColor);
+        renderText(draw, fontSmall, "Submitted By:", 50, 70, submittedColor);
+        renderText(draw, fontSmall, "BSCPE 22001", 50, 90, submittedColor);
+        renderText(draw, fontSmall, "Emmanuel Jr Porsona", 50, 110, submittedColor);
+        renderText(draw, fontSmall, "Amit Jeed", 50, 130, submittedColor);
         
         // Title
         SDL_Color titleColor = {40, 40, 100, 255};
-        renderText(renderer, fontTitle, "FIXED POINT ITERATION SOLVER", 550, 10, titleColor);
+        renderText(draw, fontTitle, "FIXED POINT ITERATION SOLVER", 550, 10, titleColor);
         
         // Subtitle
         SDL_Color subtitleColor = {80, 80, 80, 255};
-        renderText(renderer, fontSmall, "Equation: ax^2 + bx + c = 0", 650, 50, subtitleColor);
+        renderText(draw, fontSmall, "Equation: ax^2 + bx + c = 0", 650, 50, subtitleColor);
         
         // Input section
         SDL_Color sectionColor = {60, 60, 60, 255};
-        renderText(renderer, font, "INPUT", 120, 180, sectionColor);
+        renderText(draw, font, "INPUT", 120, 180, sectionColor);
         
         for (int i = 0; i < 5; i++) {
-            renderInputBox(renderer, font, &inputs[i]);
+            renderInputBox(draw, font, &inputs[i]);
         }
         
         // Method info
-        renderText(renderer, fontSmall, "Methods: 1-5", 140, 500, subtitleColor);
+        renderText(draw, fontSmall, "Methods: 1-5, 0 = auto", 140, 500, subtitleColor);
         
         // Buttons
-        renderButton(renderer, font, &computeBtn);
-        renderButton(renderer, font, &clearBtn);
+        renderButton(draw, font, &computeBtn);
+        renderButton(draw, font, &clearBtn);
         
         // Status section
-        renderText(renderer, font, "STATUS", 70, 670, sectionColor);
+        renderText(draw, font, "STATUS", 70, 670, sectionColor);
         
         if (strlen(resultText) > 0) {
             char resultCopy[500];
@@ -418,7 +642,7 @@ int main(int argc, char* argv[]) {
             int y = 700;
             while (line) {
                 SDL_Color resultColor = hasValidRoot ? (SDL_Color){20, 120, 20, 255} : (SDL_Color){180, 20, 20, 255};
-                renderText(renderer, fontSmall, line, 80, y, resultColor);
+                renderText(draw, fontSmall, line, 80, y, resultColor);
                 y += 20;
                 line = strtok(NULL, "\n");
             }
@@ -426,54 +650,25 @@ int main(int argc, char* argv[]) {
         
         // Iteration Table
         if (totalIterations > 0) {
-            renderText(renderer, font, "ITERATION TABLE", 390, 110, sectionColor);
+            renderText(draw, font, "ITERATION TABLE", 390, 110, sectionColor);
             
             // Table header
-            SDL_SetRenderDrawColor(renderer, 60, 80, 100, 255);
             SDL_Rect tableHeader = {390, 145, 460, 30};
-            SDL_RenderFillRect(renderer, &tableHeader);
+            drawListFillRect(draw, &tableHeader, (SDL_Color){60, 80, 100, 255});
             
             SDL_Color headerColor = {255, 255, 255, 255};
-            renderText(renderer, fontSmall, "n", 410, 150, headerColor);
-            renderText(renderer, fontSmall, "x_n", 470, 150, headerColor);
-            renderText(renderer, fontSmall, "x_(n+1)", 600, 150, headerColor);
-            renderText(renderer, fontSmall, "error", 760, 150, headerColor);
+            renderText(draw, fontSmall, "n", 410, 150, headerColor);
+            renderText(draw, fontSmall, "x_n", 470, 150, headerColor);
+            renderText(draw, fontSmall, "x_(n+1)", 600, 150, headerColor);
+            renderText(draw, fontSmall, "error", 760, 150, headerColor);
             
             // Calculate visible rows
             int maxVisibleRows = 13;
             int startRow = tableScrollOffset;
-            int endRow = startRow + maxVisibleRows;
-            if (endRow > totalIterations) endRow = totalIterations;
             
             // Table rows (scrollable)
-            for (int i = startRow; i < endRow; i++) {
-                int displayIndex = i - startRow;
-                int y = 180 + displayIndex * 25;
-                
-                // Alternating row colors
-                if (i % 2 == 0) {
-                    SDL_SetRenderDrawColor(renderer, 245, 245, 250, 255);
-                } else {
-                    SDL_SetRenderDrawColor(renderer, 235, 235, 245, 255);
-                }
-                SDL_Rect row = {390, y, 460, 25};
-                SDL_RenderFillRect(renderer, &row);
-                
-                SDL_Color textColor = {20, 20, 20, 255};
-                char buffer[50];
-                
-                sprintf(buffer, "%d", i + 1);
-                renderText(renderer, fontSmall, buffer, 400, y + 3, textColor);
-                
-                sprintf(buffer, "%.4lf", iterations[i].xn);
-                renderText(renderer, fontSmall, buffer, 470, y + 3, textColor);
-                
-                sprintf(buffer, "%.4lf", iterations[i].xn1);
-                renderText(renderer, fontSmall, buffer, 600, y + 3, textColor);
-                
-                sprintf(buffer, "%.6lf", iterations[i].error);
-                renderText(renderer, fontSmall, buffer, 740, y + 3, textColor);
-            }
+            drawListFlush(draw);
+            tableRender(renderer, &table, 390, 180, startRow, maxVisibleRows);
             
             // Draw scrollbar if needed
             if (totalIterations > maxVisibleRows) {
@@ -482,9 +677,8 @@ int main(int argc, char* argv[]) {
                 int scrollbarHeight = maxVisibleRows * 25;
                 
                 // Scrollbar track
-                SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
                 SDL_Rect scrollbarTrack = {scrollbarX, scrollbarY, 10, scrollbarHeight};
-                SDL_RenderFillRect(renderer, &scrollbarTrack);
+                drawListFillRect(draw, &scrollbarTrack, (SDL_Color){200, 200, 200, 255});
                 
                 // Scrollbar thumb
                 float thumbRatio = (float)maxVisibleRows / totalIterations;
@@ -494,57 +688,121 @@ int main(int argc, char* argv[]) {
                 float scrollRatio = (float)tableScrollOffset / (totalIterations - maxVisibleRows);
                 int thumbY = scrollbarY + (int)((scrollbarHeight - thumbHeight) * scrollRatio);
                 
-                SDL_SetRenderDrawColor(renderer, 100, 100, 120, 255);
                 SDL_Rect scrollbarThumb = {scrollbarX, thumbY, 10, thumbHeight};
-                SDL_RenderFillRect(renderer, &scrollbarThumb);
+                drawListFillRect(draw, &scrollbarThumb, (SDL_Color){100, 100, 120, 255});
             }
         }
         
         // Conclusion section
         if (hasValidRoot) {
             int conclusionY = 550;
-            renderText(renderer, font, "CONCLUSION", 430, conclusionY, sectionColor);
+            renderText(draw, font, "CONCLUSION", 430, conclusionY, sectionColor);
             
-            SDL_SetRenderDrawColor(renderer, 240, 255, 240, 255);
             SDL_Rect conclusionBox = {430, conclusionY + 35, 480, 110};
-            SDL_RenderFillRect(renderer, &conclusionBox);
+            drawListFillRect(draw, &conclusionBox, (SDL_Color){240, 255, 240, 255});
             
-            SDL_SetRenderDrawColor(renderer, 100, 180, 100, 255);
-            SDL_RenderDrawRect(renderer, &conclusionBox);
+            drawListRect(draw, &conclusionBox, (SDL_Color){100, 180, 100, 255});
             
             SDL_Color conclusionColor = {10, 70, 10, 255};
             char buffer[200];
             
             // Bold text effect by rendering multiple times with offset
             sprintf(buffer, "Equation: %.1lfx^2 + (%.1lf)x + (%.1lf) = 0", coefA, coefB, coefC);
-            renderText(renderer, font, buffer, 440, conclusionY + 45, conclusionColor);
-            renderText(renderer, font, buffer, 441, conclusionY + 45, conclusionColor);
+            renderText(draw, font, buffer, 440, conclusionY + 45, conclusionColor);
+            renderText(draw, font, buffer, 441, conclusionY + 45, conclusionColor);
             
             sprintf(buffer, "Approximate Root: x = %.6lf", finalRoot);
-            renderText(renderer, font, buffer, 440, conclusionY + 70, conclusionColor);
-            renderText(renderer, font, buffer, 441, conclusionY + 70, conclusionColor);
+            renderText(draw, font, buffer, 440, conclusionY + 70, conclusionColor);
+            renderText(draw, font, buffer, 441, conclusionY + 70, conclusionColor);
             
             sprintf(buffer, "Total Iterations: %d   |   Tolerance: %.3lf", totalIterations, TOLERANCE);
-            renderText(renderer, font, buffer, 440, conclusionY + 95, conclusionColor);
-            renderText(renderer, font, buffer, 441, conclusionY + 95, conclusionColor);
+            renderText(draw, font, buffer, 440, conclusionY + 95, conclusionColor);
+            renderText(draw, font, buffer, 441, conclusionY + 95, conclusionColor);
+        }
+        
+        // Polished root, under the conclusion
+        if (polishText[0]) {
+            char polishCopy[128];
+            strcpy(polishCopy, polishText);
+            char* line = strtok(polishCopy, "\n");
+            int y = 705;
+            while (line) {
+                renderText(draw, fontSmall, line, 440, y, (SDL_Color){10, 70, 10, 255});
+                y += 20;
+                line = strtok(NULL, "\n");
+            }
         }
         
         // Graph section
-        renderText(renderer, font, "GRAPH", 950, 110, sectionColor);
-        drawGraph(renderer, coefA, coefB, coefC, finalRoot, hasValidRoot);
+        renderText(draw, font, "GRAPH", 950, 110, sectionColor);
+        hudPhase(&hud, HUD_GRAPH);
+        TRACE_SCOPE("drawGraph") {
+            drawGraph(draw, &graphView, &markCanvas, coefA, coefB, coefC, finalRoot, hasValidRoot, realRoots,
+                      realRootCount > 0 ? realRootCount : 0);
+        }
+        hudPhase(&hud, HUD_TEXT);
+        if (rootsText[0]) {
+            renderText(draw, fontSmall, rootsText, 950, 460, subtitleColor);
+        }
+        
+        appHostRenderTabs(host);
+        hudRender(renderer, fontSmall, &hud, WINDOW_WIDTH - 270, 10);
         
-        SDL_RenderPresent(renderer);
-        SDL_Delay(16);
+        hudPhase(&hud, HUD_PRESENT);
+        TRACE_SCOPE("SDL_RenderPresent") {
+            SDL_RenderPresent(renderer);
+        }
+        hudPhase(&hud, HUD_IDLE);
+        appHostEndFrame(host);
+    }
+    
+    // A solve still running is cancelled; everything else is kept for the
+    // next visit
+    if (activeJob) {
+        solveJobCancel(activeJob);
+        solveJobRelease(activeJob);
+        sprintf(resultText, "CANCELLED after %d iterations\nPress COMPUTE to start again", totalIterations);
+    } else if (racing) {
+        sprintf(resultText, "CANCELLED the race of %d forms\nPress COMPUTE to start again", laneCount);
     }
+    autoCancel(lanes, laneCount);
+    for (int i = 0; i < FP_AUTO_FORMS; i++) free(lanes[i].rows);
+    graphViewFree(&graphView);
+    canvasFree(&markCanvas);
     
-    TTF_CloseFont(font);
-    TTF_CloseFont(fontSmall);
-    TTF_CloseFont(fontMedium);
-    TTF_CloseFont(fontTitle);
-    SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
-    TTF_Quit();
-    SDL_Quit();
+    for (int i = 0; i < 5; i++) {
+        strcpy(saved->values[i], inputs[i].value);
+    }
+    strcpy(saved->resultText, resultText);
+    saved->finalRoot = finalRoot;
+    saved->hasValidRoot = hasValidRoot;
+    saved->coefA = coefA;
+    saved->coefB = coefB;
+    saved->coefC = coefC;
+    memcpy(saved->realRoots, realRoots, sizeof(realRoots));
+    saved->realRootCount = realRootCount;
+    strcpy(saved->rootsText, rootsText);
+    saved->precise = precise;
+    saved->preciseOk = preciseOk;
+    saved->polishMode = polishMode;
+    strcpy(saved->polishText, polishText);
+    saved->tableScrollOffset = tableScrollOffset;
+    saved->table = table;
+    saved->saved = 1;
     
     return 0;
 }
+
+#ifndef METHODS_SUITE
+int main(int argc, char* argv[]) {
+    AppHost host;
+    if (appHostInit(&host, "Fixed Point Iteration - GUI", WINDOW_WIDTH, WINDOW_HEIGHT, NULL, 0) != 0) {
+        return 1;
+    }
+    
+    int result = fixedPointRun(&host);
+    
+    appHostFree(&host);
+    return result;
+}
+#endif
@@ -0,0 +1,430 @@
+#include <SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include "stop_criteria.h"
+#include "root_solvers.h"
+#include "poly_roots.h"
+#include "double_double.h"
+#include "fast_exp.h"
+#include "event_log.h"
+#include "session_log.h"
+
+// Checks for the header-only modules the GUIs are built on: stop rules,
+// the root solvers, the polynomial solver, double-double formatting, the
+// plotting exp and the two binary logs. Built and run by build_bench.sh; prints every
+// failed check and exits non-zero if there was one.
+//
+// Usage: header_tests
+
+#define TEST_EVENT_PATH "header_tests.evl"
+#define TEST_SESSION_PATH "header_tests.mtl"
+
+static int failures = 0;
+
+#define CHECK(cond) check((cond) != 0, #cond, __FILE__, __LINE__)
+
+static void check(int ok, const char* what, const char* file, int line) {
+    if (!ok) {
+        printf("%s:%d: failed: %s\n", file, line, what);
+        failures++;
+    }
+}
+
+static void testStopCriteria(void) {
+    StopPolicy p = solverDefaultStop(SOLVER_NEWTON, 1e-6, 100);
+    CHECK(stopPolicyParse(&p, "rel=1e-12 &res=1e-9 stag=5 iter=200 ms=10"));
+    CHECK(p.any == STOP_REL_STEP && p.all == STOP_RESIDUAL);
+    CHECK(p.relStep == 1e-12 && p.residual == 1e-9);
+    CHECK(p.stagnation == 5 && p.maxIter == 200 && p.maxMs == 10);
+
+    // Formatting reads back as the same policy
+    char text[STOP_SPEC_SIZE];
+    stopPolicyFormat(text, sizeof(text), &p);
+    StopPolicy q = solverDefaultStop(SOLVER_SECANT, 1e-3, 50);
+    CHECK(stopPolicyParse(&q, text));
+    CHECK(q.any == p.any && q.all == p.all && q.relStep == p.relStep && q.residual == p.residual);
+    CHECK(q.stagnation == p.stagnation && q.maxIter == p.maxIter && q.maxMs == p.maxMs);
+
+    // A budget alone keeps the method's rules
+    q = solverDefaultStop(SOLVER_SECANT, 1e-3, 50);
+    CHECK(stopPolicyParse(&q, "iter=1000"));
+    CHECK(q.any == solverDefaultStop(SOLVER_SECANT, 1e-3, 50).any && q.maxIter == 1000);
+
+    // Bad specs leave the policy untouched
+    const char* bad[] = {"abs", "abs=x", "abs=-1", "iter=0", "&res=1e-6", "&iter=5", "tol=1e-6", "abs=1e-6x",
+                         "res=1e-10 &res=1e-6", "&abs=1e-6 abs=1e-8 rel=1e-9"};
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        StopPolicy before = p;
+        CHECK(!stopPolicyParse(&p, bad[i]));
+        CHECK(memcmp(&before, &p, sizeof(p)) == 0);
+    }
+}
+
+// Run a solve to the end; returns its status
+static int runSolver(RootSolver* s) {
+    SolverRow row;
+    int status;
+    do {
+        status = solverStep(s, &row);
+    } while (status == SOLVER_RUNNING);
+    return status;
+}
+
+static void testRootSolvers(void) {
+    // e^x - 2x - 1 has roots 0 and 1.2564312086261697
+    RootProblem problem = {PROBLEM_EXPONENTIAL, 2, 1, 0};
+    const double root = 1.2564312086261697;
+    struct { SolverMethod method; double x0, x1; int form; } cases[] = {
+        {SOLVER_SECANT, 1, 2, 0},
+        {SOLVER_NEWTON, 2, 0, 0},
+        {SOLVER_FALSE_POSITION, 1, 2, 0},
+        {SOLVER_FIXED_POINT, 1, 0, 1},      // ln(2x + 1)
+    };
+    for (int i = 0; i < 4; i++) {
+        RootSolver s;
+        solverInit(&s, cases[i].method, &problem, cases[i].x0, cases[i].x1, 1e-10, 200);
+        if (cases[i].form) s.form = cases[i].form;
+        CHECK(runSolver(&s) == SOLVER_CONVERGED);
+        CHECK(fabs(s.root - root) < 1e-8);
+        CHECK(s.n > 0 && s.n < 200);
+    }
+
+    // x^2 - 3x + 2 by fixed point form 1, x = (x^2 + 2) / 3, from 0 to 1
+    RootProblem quadratic = {PROBLEM_QUADRATIC, 1, -3, 2};
+    RootSolver s;
+    solverInit(&s, SOLVER_FIXED_POINT, &quadratic, 0, 0, 1e-10, 500);
+    s.form = 1;
+    CHECK(runSolver(&s) == SOLVER_CONVERGED);
+    CHECK(fabs(s.root - 1) < 1e-8);
+
+    // Failures name their cause
+    solverInit(&s, SOLVER_FALSE_POSITION, &problem, 2, 3, 1e-10, 200);
+    CHECK(runSolver(&s) == SOLVER_FAILED && s.failure == SOLVER_NOT_BRACKETED);
+    solverInit(&s, SOLVER_SECANT, &problem, 1, 1, 1e-10, 200);
+    CHECK(runSolver(&s) == SOLVER_FAILED && s.failure == SOLVER_SAME_GUESSES);
+    solverInit(&s, SOLVER_NEWTON, &problem, 2, 0, 1e-300, 3);
+    CHECK(runSolver(&s) == SOLVER_FAILED && s.failure == SOLVER_MAX_ITER && s.n == 3);
+}
+
+// Whether every root has a conjugate partner (or is real) to within tol
+static int pairedWithin(const PolySolver* s, double tol) {
+    for (int i = 0; i < s->degree; i++) {
+        int found = fabs(s->im[i]) <= tol;
+        for (int j = 0; j < s->degree && !found; j++) {
+            found = j != i && hypot(s->re[j] - s->re[i], s->im[j] + s->im[i]) <= tol;
+        }
+        if (!found) return 0;
+    }
+    return 1;
+}
+
+static void testPolyRoots(void) {
+    // x^N - 1: the N-th roots of unity, well conditioned at any N
+    int degrees[] = {2, 5, 20, 100, POLY_MAX_DEGREE};
+    for (int d = 0; d < 5; d++) {
+        int n = degrees[d];
+        double coefs[POLY_MAX_DEGREE + 1] = {0};
+        coefs[0] = 1;
+        coefs[n] = -1;
+        for (int method = POLY_ABERTH; method <= POLY_DURAND_KERNER; method++) {
+            static PolySolver s;
+            CHECK(polyInit(&s, coefs, n + 1, method, 1e-14) == n);
+            PolyStatus status = polySolve(&s, POLY_MAX_ITER);
+            // Durand-Kerner is not expected to manage every degree
+            if (method == POLY_DURAND_KERNER && status == POLY_RUNNING) continue;
+            CHECK(status == POLY_CONVERGED);
+            for (int i = 0; i < n; i++) {
+                CHECK(fabs(hypot(s.re[i], s.im[i]) - 1) < 1e-12);
+                CHECK(polyBackwardError(&s, i) <= POLY_ROUNDING * n * DBL_EPSILON);
+            }
+            CHECK(pairedWithin(&s, 1e-10));
+        }
+    }
+
+    // Wilkinson (x-1)(x-2)...(x-20): every root at rounding level, but the
+    // corrections never reach 1e-14, so it must not claim plain convergence;
+    // the roots are real, near 1..20, and not split into false pairs
+    double low[21] = {1};
+    for (int k = 1; k <= 20; k++) {
+        for (int j = k; j >= 0; j--) low[j] = (j > 0 ? low[j - 1] : 0) - k * low[j];
+    }
+    double high[21];
+    for (int k = 0; k <= 20; k++) high[k] = low[20 - k];
+    static PolySolver w;
+    polyInit(&w, high, 21, POLY_ABERTH, 1e-14);
+    CHECK(polySolve(&w, POLY_MAX_ITER) == POLY_BACKWARD);
+    int near[21] = {0};
+    for (int i = 0; i < 20; i++) {
+        CHECK(fabs(w.im[i]) < 1e-6);
+        int k = (int)lround(w.re[i]);
+        CHECK(k >= 1 && k <= 20 && fabs(w.re[i] - k) < 0.05);
+        if (k >= 1 && k <= 20) near[k]++;
+        CHECK(polyBackwardError(&w, i) <= POLY_ROUNDING * 20 * DBL_EPSILON);
+    }
+    for (int k = 1; k <= 20; k++) CHECK(near[k] == 1);
+
+    // A quadratic is the N = 2 case
+    double roots[2];
+    double twoRoots[] = {1, -3, 2}, noRoots[] = {1, 0, 1}, line[] = {0, 2, -4};
+    CHECK(polyRealRoots(twoRoots, 3, roots) == 2 && fabs(roots[0] - 1) < 1e-14 && fabs(roots[1] - 2) < 1e-14);
+    CHECK(polyRealRoots(noRoots, 3, roots) == 0);
+    CHECK(polyRealRoots(line, 3, roots) == 1 && roots[0] == 2);
+
+    // Roots hundreds of orders of magnitude apart each start near their own
+    // size and are found, not merged into a false pair
+    double tiny[] = {1e-300, 1, 1}, huge[] = {1, 1e200, 1};
+    CHECK(polyRealRoots(tiny, 3, roots) == 2 && fabs(roots[0] / -1e300 - 1) < 1e-14 && fabs(roots[1] + 1) < 1e-14);
+    CHECK(polyRealRoots(huge, 3, roots) == 2 && fabs(roots[0] / -1e200 - 1) < 1e-14 &&
+          fabs(roots[1] / -1e-200 - 1) < 1e-14);
+
+    // Above POLY_MAX_DEGREE the input is refused, not cut short
+    static double tooMany[POLY_MAX_DEGREE + 2];
+    tooMany[0] = 1;
+    tooMany[POLY_MAX_DEGREE + 1] = -1;
+    static PolySolver refused;
+    CHECK(polyInit(&refused, tooMany, POLY_MAX_DEGREE + 2, POLY_ABERTH, 1e-14) == -1);
+    CHECK(polyRealRoots(tooMany, POLY_MAX_DEGREE + 2, roots) == -1);
+}
+
+static void checkFormat(DoubleDouble a, int digits, const char* expected) {
+    char text[64];
+    ddFormat(a, digits, text, sizeof(text));
+    if (strcmp(text, expected) != 0) printf("  ddFormat gave %s, expected %s\n", text, expected);
+    CHECK(strcmp(text, expected) == 0);
+}
+
+static void testDoubleDouble(void) {
+    checkFormat(ddFromDouble(0), 10, "0");
+    checkFormat(ddFromDouble(1.5), 5, "1.5000");
+    checkFormat(ddFromDouble(-2), 5, "-2.0000");
+    // A negative lo borrows from hi: 3 - 1e-20 is 2.99..., not 3.00...
+    checkFormat(ddMake(3, -1e-20), 32, "2.9999999999999999999900000000000");
+    // Rounding carries into a new leading digit
+    checkFormat(ddMake(9.9999999, 0), 3, "10.0");
+
+    // 0.1 parsed keeps more than a double: ten of them make exactly 1
+    DoubleDouble tenth;
+    CHECK(ddParse("0.1", &tenth));
+    DoubleDouble sum = ddFromDouble(0);
+    for (int i = 0; i < 10; i++) sum = ddAdd(sum, tenth);
+    checkFormat(sum, 30, "1.00000000000000000000000000000");
+    CHECK(fabs(sum.hi - 1) == 0 && fabs(sum.lo) < 1e-30);
+    checkFormat(tenth, 30, "0.100000000000000000000000000000");
+    CHECK(!ddParse("0.1x", &tenth) && !ddParse("", &tenth) && !ddParse("1e", &tenth));
+}
+
+static void testFastExp(void) {
+    // Within 4 ulp of exp() across the range, in place
+    enum { N = 4096 };
+    static double x[N], y[N];
+    for (int i = 0; i < N; i++) {
+        x[i] = y[i] = FAST_EXP_MIN + (FAST_EXP_MAX - FAST_EXP_MIN) * i / (N - 1);
+    }
+    fastExpArray(y, y, N);
+    int64_t worst = 0;
+    for (int i = 0; i < N; i++) {
+        double e = exp(x[i]);
+        int64_t a, b;
+        memcpy(&a, &e, sizeof(a));
+        memcpy(&b, &y[i], sizeof(b));
+        if (llabs(a - b) > worst) worst = llabs(a - b);
+    }
+    CHECK(worst <= 4);
+
+    double edge[] = {0, 1, 800, NAN};
+    fastExpArray(edge, edge, 4);
+    CHECK(edge[0] == 1 && fabs(edge[1] - M_E) < 1e-15);
+    CHECK(isinf(edge[2]) && edge[2] > 0);
+    CHECK(isnan(edge[3]));
+}
+
+static void testEventLog(void) {
+    SDL_Event events[4];
+    memset(events, 0, sizeof(events));
+    events[0].type = SDL_KEYDOWN;
+    events[0].key.keysym.sym = SDLK_RETURN;
+    events[0].key.keysym.mod = KMOD_CTRL;
+    events[1].type = SDL_TEXTINPUT;
+    strcpy(events[1].text.text, "1e-6");
+    events[2].type = SDL_MOUSEBUTTONDOWN;
+    events[2].button.button = SDL_BUTTON_LEFT;
+    events[2].button.x = 140;
+    events[2].button.y = 545;
+    events[3].type = SDL_MOUSEWHEEL;
+    events[3].wheel.y = -3;
+    unsigned frames[] = {0, 0, 2, 7};
+
+    EventLog log;
+    CHECK(eventLogRecordOpen(&log, TEST_EVENT_PATH) == 0);
+    for (unsigned frame = 0, i = 0; frame < 8; frame++) {
+        for (; i < 4 && frames[i] == frame; i++) eventLogWrite(&log, &events[i]);
+        eventLogEndFrame(&log);
+    }
+    eventLogClose(&log, NULL);
+
+    // The same events come back on the same frames, then one SDL_QUIT
+    CHECK(eventLogReplayOpen(&log, TEST_EVENT_PATH) == 0);
+    int replayed = 0, quits = 0;
+    for (unsigned frame = 0; frame < 12; frame++) {
+        SDL_Event e;
+        while (eventLogNext(&log, &e)) {
+            if (e.type == SDL_QUIT) {
+                quits++;
+                continue;
+            }
+            CHECK(replayed < 4 && frames[replayed] == frame && e.type == events[replayed].type);
+            if (replayed == 0) CHECK(e.key.keysym.sym == SDLK_RETURN && (e.key.keysym.mod & KMOD_CTRL));
+            if (replayed == 1) CHECK(strcmp(e.text.text, "1e-6") == 0);
+            if (replayed == 2) CHECK(e.button.x == 140 && e.button.y == 545 && e.button.button == SDL_BUTTON_LEFT);
+            if (replayed == 3) CHECK(e.wheel.y == -3);
+            replayed++;
+        }
+        eventLogEndFrame(&log);
+    }
+    CHECK(replayed == 4 && quits == 1);
+    eventLogClose(&log, NULL);
+    remove(TEST_EVENT_PATH);
+
+    // Not an event log
+    FILE* f = fopen(TEST_EVENT_PATH, "wb");
+    if (f) {
+        fputs("hello", f);
+        fclose(f);
+    }
+    CHECK(eventLogReplayOpen(&log, TEST_EVENT_PATH) != 0);
+    remove(TEST_EVENT_PATH);
+}
+
+// Solve e^x - 2x - 1 with a method and log it
+static void logSolve(SessionLog* log, SolverMethod method, double x0, double x1) {
+    RootProblem problem = {PROBLEM_EXPONENTIAL, 2, 1, 0};
+    RootSolver s;
+    solverInit(&s, method, &problem, x0, x1, 1e-10, 200);
+    SessionTrace trace;
+    sessionTraceBegin(&trace, log, &s);
+    SolverRow row;
+    int status;
+    do {
+        status = solverStep(&s, &row);
+        sessionTraceAdd(&trace, &row);
+    } while (status == SOLVER_RUNNING);
+    sessionLogSolve(log, &s, &trace);
+}
+
+// Open the test log; returns the solve count, or -1 if it does not open
+static int sessionCount(int* recovered) {
+    SessionView view;
+    if (sessionViewOpen(&view, TEST_SESSION_PATH) != 0) return -1;
+    int count = view.count;
+    *recovered = view.recovered;
+    for (int i = 0; i < view.count; i++) {
+        SessionSolve s;
+        CHECK(sessionViewSolve(&view, i, &s));
+    }
+    sessionViewClose(&view);
+    return count;
+}
+
+static void testSessionLog(void) {
+    remove(TEST_SESSION_PATH);
+    SessionLog log;
+    CHECK(sessionLogOpen(&log, TEST_SESSION_PATH) == 0);
+    logSolve(&log, SOLVER_NEWTON, 2, 0);
+    logSolve(&log, SOLVER_SECANT, 1, 2);
+    sessionLogClose(&log);
+
+    // Closed: read from the index, every field as logged
+    SessionView view;
+    CHECK(sessionViewOpen(&view, TEST_SESSION_PATH) == 0);
+    CHECK(view.count == 2 && !view.recovered);
+    SessionSolve s;
+    if (view.count == 2 && sessionViewSolve(&view, 0, &s)) {
+        CHECK(s.method == SOLVER_NEWTON && s.status == SOLVER_CONVERGED);
+        CHECK(s.problem.family == PROBLEM_EXPONENTIAL && s.problem.a == 2 && s.problem.b == 1);
+        CHECK(s.x0 == 2 && fabs(s.root - 1.2564312086261697) < 1e-8);
+        CHECK(s.rows > 0 && s.columns == 5);
+        double last[SESSION_MAX_COLUMNS];
+        sessionSolveRow(&s, s.rows - 1, last);
+        CHECK(last[3] == s.root);       // x_(n+1) of the last row
+    } else {
+        CHECK(0);
+    }
+    sessionViewClose(&view);
+
+    // Open: appended solves are walked until the index is written at close
+    CHECK(sessionLogOpen(&log, TEST_SESSION_PATH) == 0);
+    logSolve(&log, SOLVER_FALSE_POSITION, 1, 2);
+    sessionLogFlush(&log);
+    int recovered = 0;
+    CHECK(sessionCount(&recovered) == 3 && recovered);
+    sessionLogClose(&log);
+    CHECK(sessionCount(&recovered) == 3 && !recovered);
+
+    // Cut short mid-record, as if the program died: the whole records are
+    // recovered, and the next session appends after them
+    CHECK(sessionLogOpen(&log, TEST_SESSION_PATH) == 0);
+    logSolve(&log, SOLVER_NEWTON, 3, 0);
+    sessionLogFlush(&log);
+    Uint64 size = log.end - 20;
+    CHECK(sessionTruncate(log.out, size) == 0);
+    fclose(log.out);
+    log.out = NULL;
+    sessionLogClose(&log);
+    CHECK(sessionCount(&recovered) == 3 && recovered);
+    CHECK(sessionLogOpen(&log, TEST_SESSION_PATH) == 0);
+    logSolve(&log, SOLVER_SECANT, 1, 2);
+    sessionLogClose(&log);
+    CHECK(sessionCount(&recovered) == 4 && !recovered);
+    remove(TEST_SESSION_PATH);
+
+    // Never overwrites a file that is not a session log
+    FILE* f = fopen(TEST_SESSION_PATH, "wb");
+    if (f) {
+        fputs("hello", f);
+        fclose(f);
+    }
+    CHECK(sessionLogOpen(&log, TEST_SESSION_PATH) != 0);
+    remove(TEST_SESSION_PATH);
+
+    // Rotation keeps the last SESSION_LOG_KEEP logs, newest in <path>.1
+    char rotated[64];
+    for (int i = 0; i <= SESSION_LOG_KEEP; i++) {
+        f = fopen(TEST_SESSION_PATH, "wb");
+        if (f) {
+            fputc('A' + i, f);
+            fclose(f);
+        }
+        CHECK(sessionLogRotate(TEST_SESSION_PATH) == 0);
+    }
+    for (int i = 1; i <= SESSION_LOG_KEEP + 1; i++) {
+        snprintf(rotated, sizeof(rotated), "%s.%d", TEST_SESSION_PATH, i);
+        f = fopen(rotated, "rb");
+        if (i <= SESSION_LOG_KEEP) {
+            CHECK(f && fgetc(f) == 'A' + SESSION_LOG_KEEP + 1 - i);
+        } else {
+            CHECK(!f);
+        }
+        if (f) fclose(f);
+        remove(rotated);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+    testStopCriteria();
+    testRootSolvers();
+    testPolyRoots();
+    testDoubleDouble();
+    testFastExp();
+    testEventLog();
+    testSessionLog();
+    if (failures) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
@@ -0,0 +1,473 @@
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "frame_hud.h"
+#include "trace_events.h"
+#include "app_host.h"
+#include "iteration_table.h"
+#include "session_log.h"
+
+#define WINDOW_WIDTH 1400
+#define WINDOW_HEIGHT 800
+#define LIST_ROWS 26                // solves shown at once in the list
+#define LIST_ROW_HEIGHT 22
+#define TRACE_ROWS 18               // trace rows shown at once
+#define TRACE_ROW_HEIGHT 25
+
+// Solve history: every solve logged by this and earlier sessions, read
+// back from the session log (session_log.h). The log is mapped, not
+// loaded: the list comes from its index, and only the trace rows on screen
+// are decoded and put into the table, so a solve of millions of iterations
+// opens and scrolls like a short one. The log is reopened whenever the tab
+// is entered, and with RELOAD or F5.
+
+static const char* methodNames[] = {"Secant", "Newton-Raphson", "False Position", "Fixed Point"};
+
+// Trace columns of each method, after n (see SolverRow)
+static const char* columnTitles[][SESSION_MAX_COLUMNS] = {
+    {"x(n-1)", "x(n)", "f(x(n-1))", "f(x(n))", "x(n+1)", "Error"},
+    {"x_n", "f(x_n)", "f'(x_n)", "x_(n+1)", "Error"},
+    {"x0", "x1", "x2", "f(x2)", "Error"},
+    {"x_n", "x_(n+1)", "Error"},
+};
+
+// Standalone: the log named on the command line
+static const char* historyFile = NULL;
+
+typedef struct {
+    SDL_Rect rect;
+    char text[50];
+    int hovered;
+    int clicked;
+} Button;
+
+// Where the user was, kept while they are on other tabs (appHostTabState);
+// the log itself is reread on every visit
+typedef struct {
+    int saved;
+    int selected;
+    int count;              // solves in the log then
+    int listScroll;
+    int traceFirst;
+} HistoryState;
+
+static const char* historyMethodName(int method) {
+    return method >= 0 && method < 4 ? methodNames[method] : "Unknown";
+}
+
+// Render text with UTF-8 support
+// (the draw list frees the texture once the frame is submitted)
+static void renderText(DrawList* draw, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, color);
+    if (!surface) return;
+    
+    SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+    SDL_Rect rect = {x, y, surface->w, surface->h};
+    drawListTexture(draw, texture, NULL, &rect, 1);
+    
+    SDL_FreeSurface(surface);
+}
+
+// Render button with hover and click effects
+static void renderButton(DrawList* draw, TTF_Font* font, Button* btn) {
+    SDL_Color fill;
+    if (btn->clicked) {
+        fill = (SDL_Color){20, 50, 100, 255};
+    } else if (btn->hovered) {
+        fill = (SDL_Color){60, 100, 170, 255};
+    } else {
+        fill = (SDL_Color){40, 80, 140, 255};
+    }
+    drawListFillRect(draw, &btn->rect, fill);
+    
+    drawListRect(draw, &btn->rect, (SDL_Color){20, 40, 80, 255});
+    
+    SDL_Surface* surface = TTF_RenderText_Blended(font, btn->text, (SDL_Color){255, 255, 255, 255});
+    if (surface) {
+        int textX = btn->rect.x + (btn->rect.w - surface->w) / 2;
+        int textY = btn->rect.y + (btn->rect.h - surface->h) / 2;
+        SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+        SDL_Rect rect = {textX, textY, surface->w, surface->h};
+        drawListTexture(draw, texture, NULL, &rect, 1);
+        SDL_FreeSurface(surface);
+    }
+}
+
+static int insideRect(const SDL_Rect* r, int x, int y) {
+    return x >= r->x && x <= r->x + r->w && y >= r->y && y <= r->y + r->h;
+}
+
+static void formatTime(char* buffer, size_t size, Uint64 seconds, const char* format) {
+    time_t when = (time_t)seconds;
+    struct tm* local = localtime(&when);
+    if (!local || !strftime(buffer, size, format, local)) snprintf(buffer, size, "?");
+}
+
+// (Re)map the log and describe it in status; returns 1 if it opened.
+// Solves this process logged are flushed first so that they show up.
+static int historyOpen(SessionView* view, SessionLog* log, const char* path, char* status, size_t size) {
+    sessionViewClose(view);
+    sessionLogFlush(log);
+    if (!path[0]) {
+        snprintf(status, size, "Solves are not being logged (set METHODS_SESSION=history.mtl to log them)");
+        return 0;
+    }
+    if (sessionViewOpen(view, path) != 0) {
+        snprintf(status, size, "No session log in %s yet", path);
+        return 0;
+    }
+    snprintf(status, size, "%d solves in %s, %.1f MB%s", view->count, path, view->file.size / 1048576.0,
+             view->recovered ? " (no index yet: still open, or cut short)" : "");
+    return 1;
+}
+
+// Put rows [first, first + TRACE_ROWS) of a trace into the table, which
+// holds nothing else; the stripes follow the trace row, not the table row
+static void historyFillTable(IterationTable* table, const SessionSolve* s, int first,
+                             SDL_Color evenBg, SDL_Color oddBg) {
+    tableClear(table);
+    table->rowBg[0] = first % 2 ? oddBg : evenBg;
+    table->rowBg[1] = first % 2 ? evenBg : oddBg;
+    for (int r = first; r < s->rows && r < first + TRACE_ROWS; r++) {
+        double v[SESSION_MAX_COLUMNS];
+        sessionSolveRow(s, r, v);
+        int row = tableAppendRow(table);
+        tableSetCell(table, row, 0, "%d", r + 1);
+        for (int c = 0; c < s->columns; c++) {
+            tableSetCell(table, row, c + 1, "%.8g", v[c]);
+        }
+    }
+}
+
+int historyRun(AppHost* host) {
+    SDL_Renderer* renderer = host->renderer;
+    DrawList* draw = &host->draw;
+    
+    // Load fonts
+    TTF_Font* font = appHostFont(host, 18);
+    TTF_Font* fontSmall = appHostFont(host, 14);
+    TTF_Font* fontMedium = appHostFont(host, 16);
+    TTF_Font* fontTitle = appHostFont(host, 24);
+    
+    HistoryState* saved = appHostTabState(host, sizeof(HistoryState), NULL);
+    if (!font || !fontSmall || !fontMedium || !fontTitle || !saved) {
+        return 1;
+    }
+    
+    const char* path = historyFile ? historyFile : appHostSessionPath();
+    SessionView view;
+    memset(&view, 0, sizeof(view));
+    char statusText[400];
+    historyOpen(&view, &host->session, path, statusText, sizeof(statusText));
+    
+    Button reloadBtn = {{30, 735, 120, 36}, "RELOAD", 0, 0};
+    
+    // The list shows the newest solve first; selected is a solve index
+    int selected = view.count - 1;
+    int listScroll = 0;
+    int shownSolve = -2;        // solve decoded into solve, -2 for none yet
+    SessionSolve solve;
+    int solveOk = 0;
+    
+    // Trace table: only the visible window of rows is ever in it
+    const SDL_Color evenBg = {250, 251, 253, 255}, oddBg = {232, 238, 247, 255};
+    const int tableColumns[] = {10, 90, 200, 310, 420, 530, 640};
+    const int tableX = 590, tableY = 300;
+    IterationTable table;
+    tableInit(&table, fontSmall, 750, TRACE_ROW_HEIGHT, 4, 7, tableColumns, (SDL_Color){20, 40, 80, 255},
+              evenBg, oddBg);
+    int traceFirst = 0;
+    int tableSolve = -1, tableFirst = -1;   // what the table holds
+    SDL_Rect track = {tableX + table.width + 8, tableY, 14, TRACE_ROWS * TRACE_ROW_HEIGHT};
+    int dragging = 0;
+    
+    int mouseX = 0, mouseY = 0;
+    int quit = 0;
+    
+    // Back on this tab: as on RELOAD, the selection stays on its solve
+    // unless it was the newest
+    if (saved->saved && saved->selected != saved->count - 1 && saved->selected < view.count) {
+        selected = saved->selected;
+        solveOk = sessionViewSolve(&view, selected, &solve);
+        shownSolve = selected;
+        traceFirst = saved->traceFirst;
+    }
+    if (saved->saved) listScroll = saved->listScroll;
+    
+    // Frame timing overlay, toggled with F3
+    FrameHud hud;
+    hudInit(&hud);
+    SDL_Event e;
+    
+    while (!quit && !appHostSwitching(host)) {
+        hudBeginFrame(&hud);
+        int reload = 0;
+        
+        while (appHostPollEvent(host, &e)) {
+            if (appHostEvent(host, &e)) continue;
+            if (e.type == SDL_QUIT) quit = 1;
+            
+            if (e.type == SDL_MOUSEBUTTONDOWN && e.button.button == SDL_BUTTON_LEFT) {
+                int mx = e.button.x;
+                int my = e.button.y;
+                
+                int line = (my - 140) / LIST_ROW_HEIGHT;
+                if (mx >= 30 && mx < 560 && my >= 140 && line < LIST_ROWS && listScroll + line < view.count) {
+                    selected = view.count - 1 - (listScroll + line);
+                }
+                if (insideRect(&reloadBtn.rect, mx, my)) {
+                    reloadBtn.clicked = 1;
+                    reload = 1;
+                }
+                if (insideRect(&track, mx, my)) dragging = 1;
+            }
+            
+            if (e.type == SDL_MOUSEBUTTONUP) {
+                reloadBtn.clicked = 0;
+                dragging = 0;
+            }
+            
+            if (e.type == SDL_MOUSEMOTION) {
+                mouseX = e.motion.x;
+                mouseY = e.motion.y;
+                reloadBtn.hovered = insideRect(&reloadBtn.rect, mouseX, mouseY);
+            }
+            if ((e.type == SDL_MOUSEBUTTONDOWN || e.type == SDL_MOUSEMOTION) && dragging && solveOk) {
+                // The bar maps straight onto the whole trace
+                int y = e.type == SDL_MOUSEMOTION ? e.motion.y : e.button.y;
+                double t = (double)(y - track.y) / track.h;
+                traceFirst = (int)(t * (solve.rows - TRACE_ROWS + 1));
+            }
+            
+            if (e.type == SDL_MOUSEWHEEL) {
+                if (mouseX < 560) {
+                    listScroll -= e.wheel.y * 3;
+                } else {
+                    traceFirst -= e.wheel.y * 3;
+                }
+            }
+            
+            if (e.type == SDL_KEYDOWN) {
+                switch (e.key.keysym.sym) {
+                    case SDLK_F3:       hudToggle(&hud); break;
+                    case SDLK_F5:       reload = 1; break;
+                    case SDLK_UP:       if (selected < view.count - 1) selected++; break;
+                    case SDLK_DOWN:     if (selected > 0) selected--; break;
+                    case SDLK_PAGEUP:   traceFirst -= TRACE_ROWS; break;
+                    case SDLK_PAGEDOWN: traceFirst += TRACE_ROWS; break;
+                    case SDLK_HOME:     traceFirst = 0; break;
+                    case SDLK_END:      traceFirst = solveOk ? solve.rows : 0; break;
+                    default: break;
+                }
+                
+                // Keep the picked solve in the list's window
+                int line = view.count - 1 - selected;
+                if (line < listScroll) listScroll = line;
+                if (line >= listScroll + LIST_ROWS) listScroll = line - LIST_ROWS + 1;
+            }
+        }
+        
+        hudPhase(&hud, HUD_SOLVE);
+        
+        if (reload) {
+            // New solves show up at the top; the selection stays on its solve
+            int newest = selected == view.count - 1;
+            historyOpen(&view, &host->session, path, statusText, sizeof(statusText));
+            if (newest || selected >= view.count) selected = view.count - 1;
+            shownSolve = -2;
+        }
+        
+        if (selected != shownSolve) {
+            solveOk = sessionViewSolve(&view, selected, &solve);
+            shownSolve = selected;
+            traceFirst = 0;
+            tableSolve = -1;
+        }
+        
+        if (listScroll > view.count - LIST_ROWS) listScroll = view.count - LIST_ROWS;
+        if (listScroll < 0) listScroll = 0;
+        int traceRows = solveOk ? solve.rows : 0;
+        if (traceFirst > traceRows - TRACE_ROWS) traceFirst = traceRows - TRACE_ROWS;
+        if (traceFirst < 0) traceFirst = 0;
+        
+        if (solveOk && (tableSolve != selected || tableFirst != traceFirst)) {
+            historyFillTable(&table, &solve, traceFirst, evenBg, oddBg);
+            tableSolve = selected;
+            tableFirst = traceFirst;
+        }
+        
+        // ==================== RENDER ====================
+        hudPhase(&hud, HUD_TEXT);
+        SDL_SetRenderDrawColor(renderer, 240, 244, 250, 255);
+        hudRenderClear(renderer);
+        
+        SDL_Rect banner = {0, 0, WINDOW_WIDTH, 70};
+        drawListFillRect(draw, &banner, (SDL_Color){30, 60, 110, 255});
+        renderText(draw, fontTitle, "SOLVE HISTORY", 30, 10, (SDL_Color){255, 255, 255, 255});
+        renderText(draw, fontMedium, "Every finished solve, read back from the session log",
+                   30, 42, (SDL_Color){200, 220, 255, 255});
+        
+        SDL_Color sectionColor = {30, 60, 110, 255};
+        SDL_Color textColor = {60, 60, 80, 255};
+        SDL_Color hintColor = {90, 100, 120, 255};
+        
+        // Solve list, newest first
+        renderText(draw, font, "SOLVES", 30, 85, sectionColor);
+        renderText(draw, fontSmall, statusText, 30, 112, hintColor);
+        for (int line = 0; line < LIST_ROWS && listScroll + line < view.count; line++) {
+            int i = view.count - 1 - (listScroll + line);
+            const SessionEntry* entry = &view.entries[i];
+            int y = 140 + line * LIST_ROW_HEIGHT;
+            if (i == selected) {
+                SDL_Rect highlight = {26, y - 1, 534, LIST_ROW_HEIGHT};
+                drawListFillRect(draw, &highlight, (SDL_Color){205, 220, 242, 255});
+            }
+            
+            char text[64];
+            SDL_Color color = entry->status == SOLVER_CONVERGED ? textColor : (SDL_Color){170, 50, 50, 255};
+            snprintf(text, sizeof(text), "%d", i + 1);
+            renderText(draw, fontSmall, text, 30, y, hintColor);
+            formatTime(text, sizeof(text), entry->time, "%H:%M:%S");
+            renderText(draw, fontSmall, text, 80, y, hintColor);
+            renderText(draw, fontSmall, historyMethodName(entry->method), 155, y, color);
+            snprintf(text, sizeof(text), "%d it", entry->rows);
+            renderText(draw, fontSmall, text, 290, y, color);
+            if (entry->status == SOLVER_CONVERGED) {
+                snprintf(text, sizeof(text), "x = %.10g", entry->root);
+            } else {
+                snprintf(text, sizeof(text), "failed");
+            }
+            renderText(draw, fontSmall, text, 390, y, color);
+        }
+        
+        renderButton(draw, font, &reloadBtn);
+        renderText(draw, fontSmall, "Up/Down pick a solve, F5 reloads", 170, 745, hintColor);
+        
+        // The picked solve: inputs, settings, outcome, cost, then its trace
+        if (solveOk) {
+            char line[200];
+            snprintf(line, sizeof(line), "SOLVE %d: %s", selected + 1, historyMethodName(solve.method));
+            renderText(draw, font, line, tableX, 85, sectionColor);
+            
+            char when[64];
+            formatTime(when, sizeof(when), solve.time, "%Y-%m-%d %H:%M:%S");
+            snprintf(line, sizeof(line), "Finished %s", when);
+            renderText(draw, fontSmall, line, tableX, 115, hintColor);
+            
+            const RootProblem* p = &solve.problem;
+            if (p->family == PROBLEM_QUADRATIC) {
+                snprintf(line, sizeof(line), "Problem: %gx^2 + %gx + %g = 0", p->a, p->b, p->c);
+            } else {
+                snprintf(line, sizeof(line), "Problem: e^x - %gx - %g = 0", p->a, p->b);
+            }
+            renderText(draw, fontSmall, line, tableX, 140, textColor);
+            
+            if (solve.method == SOLVER_SECANT || solve.method == SOLVER_FALSE_POSITION) {
+                snprintf(line, sizeof(line), "Start: x0 = %.10g, x1 = %.10g", solve.x0, solve.x1);
+            } else if (solve.method == SOLVER_FIXED_POINT) {
+                snprintf(line, sizeof(line), "Start: x0 = %.10g, form %d", solve.x0, solve.form);
+            } else {
+                snprintf(line, sizeof(line), "Start: x0 = %.10g", solve.x0);
+            }
+            renderText(draw, fontSmall, line, tableX, 160, textColor);
+            
+            char spec[128];
+            stopPolicyFormat(spec, sizeof(spec), &solve.stop);
+            snprintf(line, sizeof(line), "Stop: %s", spec);
+            renderText(draw, fontSmall, line, tableX, 180, textColor);
+            
+            if (solve.status == SOLVER_CONVERGED) {
+                snprintf(line, sizeof(line), "Converged: x = %.17g after %d iterations", solve.root, solve.rows);
+            } else {
+                snprintf(line, sizeof(line), "Failed: %s after %d iterations", solverFailureName(solve.failure),
+                         solve.rows);
+            }
+            renderText(draw, fontSmall, line, tableX, 200,
+                       solve.status == SOLVER_CONVERGED ? sectionColor : (SDL_Color){170, 50, 50, 255});
+            
+            solverFormatCost(line, sizeof(line), &solve.cost, ", ");
+            renderText(draw, fontSmall, line, tableX, 220, textColor);
+            if (solve.flags & SESSION_FLAG_TRUNCATED) {
+                renderText(draw, fontSmall, "Trace incomplete: memory ran out while it was recorded",
+                           tableX, 240, (SDL_Color){170, 50, 50, 255});
+            }
+            
+            // Column titles over the trace
+            int method = solve.method >= 0 && solve.method < 4 ? solve.method : 0;
+            renderText(draw, fontSmall, "n", tableX + tableColumns[0], 275, sectionColor);
+            for (int c = 0; c < solve.columns; c++) {
+                const char* title = columnTitles[method][c] ? columnTitles[method][c] : "";
+                renderText(draw, fontSmall, title, tableX + tableColumns[c + 1], 275, sectionColor);
+            }
+            
+            SDL_Rect frame = {tableX - 1, tableY - 1, table.width + 2, TRACE_ROWS * TRACE_ROW_HEIGHT + 2};
+            drawListRect(draw, &frame, (SDL_Color){50, 90, 150, 255});
+            
+            if (traceRows > 0) {
+                snprintf(line, sizeof(line), "Rows %d-%d of %d   Wheel, PgUp/PgDn, Home/End or drag the bar",
+                         traceFirst + 1, table.rowCount + traceFirst, traceRows);
+            } else {
+                snprintf(line, sizeof(line), "No iterations were taken");
+            }
+            renderText(draw, fontSmall, line, tableX, tableY + TRACE_ROWS * TRACE_ROW_HEIGHT + 8, hintColor);
+            
+            // Scroll bar over the whole trace; the thumb keeps a grabbable size
+            drawListFillRect(draw, &track, (SDL_Color){220, 226, 236, 255});
+            if (traceRows > TRACE_ROWS) {
+                int thumbH = track.h * TRACE_ROWS / traceRows;
+                if (thumbH < 20) thumbH = 20;
+                int thumbY = track.y + (int)((double)traceFirst / (traceRows - TRACE_ROWS) * (track.h - thumbH));
+                SDL_Rect thumb = {track.x, thumbY, track.w, thumbH};
+                drawListFillRect(draw, &thumb, (SDL_Color){90, 120, 170, 255});
+            }
+            
+            drawListFlush(draw);
+            tableRender(renderer, &table, tableX, tableY, 0, TRACE_ROWS);
+        } else if (view.count > 0) {
+            renderText(draw, font, "This solve's record is damaged", tableX, 85, (SDL_Color){170, 50, 50, 255});
+        } else {
+            renderText(draw, font, "Nothing logged yet", tableX, 85, sectionColor);
+            renderText(draw, fontSmall, "Solves from the other tabs are listed here once they finish.",
+                       tableX, 115, hintColor);
+        }
+        
+        appHostRenderTabs(host);
+        hudRender(renderer, fontSmall, &hud, WINDOW_WIDTH - 270, 10);
+        
+        hudPhase(&hud, HUD_PRESENT);
+        TRACE_SCOPE("SDL_RenderPresent") {
+            SDL_RenderPresent(renderer);
+        }
+        hudPhase(&hud, HUD_IDLE);
+        appHostEndFrame(host);
+    }
+    
+    saved->selected = selected;
+    saved->count = view.count;
+    saved->listScroll = listScroll;
+    saved->traceFirst = traceFirst;
+    saved->saved = 1;
+    tableFree(&table);
+    sessionViewClose(&view);
+    return 0;
+}
+
+#ifndef METHODS_SUITE
+// Usage: history_mode.exe [session log]
+int main(int argc, char* argv[]) {
+    if (argc > 1) historyFile = argv[1];
+    
+    AppHost host;
+    if (appHostInit(&host, "Solve History", WINDOW_WIDTH, WINDOW_HEIGHT, NULL, 0) != 0) {
+        return 1;
+    }
+    
+    int result = historyRun(&host);
+    
+    appHostFree(&host);
+    return result;
+}
+#endif
@@ -0,0 +1,183 @@
+#ifndef ITERATION_TABLE_H
+#define ITERATION_TABLE_H
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace_events.h"
+#include "frame_hud.h"
+
+#define TABLE_MAX_COLUMNS 8
+#define TABLE_CELL_LEN 24
+#define TABLE_TEXTURE_CACHE 256
+
+// Virtualized iteration table.
+// Cells are formatted once when a solve finishes, each row is rendered once
+// into its own texture on first use, and only the visible window is blitted.
+typedef struct {
+    TTF_Font* font;
+    int width;
+    int rowHeight;
+    int textY;
+    int columnCount;
+    int columnX[TABLE_MAX_COLUMNS];
+    SDL_Color textColor;
+    SDL_Color rowBg[2];
+
+    int rowCount;
+    int rowCapacity;
+    char* cells;                 // rowCount * columnCount * TABLE_CELL_LEN
+    SDL_Texture** rowTextures;   // NULL until the row is first shown
+
+    int cacheRows[TABLE_TEXTURE_CACHE];  // ring of rows that own a texture
+    int cacheNext;
+    int cacheUsed;
+} IterationTable;
+
+// Set up column layout and colors; the table starts empty
+static inline void tableInit(IterationTable* table, TTF_Font* font, int width, int rowHeight, int textY,
+                             int columnCount, const int* columnX,
+                             SDL_Color textColor, SDL_Color evenBg, SDL_Color oddBg) {
+    memset(table, 0, sizeof(*table));
+    table->font = font;
+    table->width = width;
+    table->rowHeight = rowHeight;
+    table->textY = textY;
+    table->columnCount = columnCount > TABLE_MAX_COLUMNS ? TABLE_MAX_COLUMNS : columnCount;
+    for (int i = 0; i < table->columnCount; i++) {
+        table->columnX[i] = columnX[i];
+    }
+    table->textColor = textColor;
+    table->rowBg[0] = evenBg;
+    table->rowBg[1] = oddBg;
+}
+
+// Drop all rows and cached textures, keeping the allocated storage
+static inline void tableClear(IterationTable* table) {
+    for (int i = 0; i < table->cacheUsed; i++) {
+        int row = table->cacheRows[i];
+        if (table->rowTextures[row]) {
+            SDL_DestroyTexture(table->rowTextures[row]);
+            table->rowTextures[row] = NULL;
+        }
+    }
+    table->cacheNext = 0;
+    table->cacheUsed = 0;
+    table->rowCount = 0;
+}
+
+static inline void tableFree(IterationTable* table) {
+    tableClear(table);
+    free(table->cells);
+    free(table->rowTextures);
+    table->cells = NULL;
+    table->rowTextures = NULL;
+    table->rowCapacity = 0;
+}
+
+// Append an empty row and return its index (-1 if out of memory)
+static inline int tableAppendRow(IterationTable* table) {
+    if (table->rowCount == table->rowCapacity) {
+        int capacity = table->rowCapacity ? table->rowCapacity * 2 : 128;
+        char* cells = realloc(table->cells, (size_t)capacity * TABLE_MAX_COLUMNS * TABLE_CELL_LEN);
+        if (!cells) return -1;
+        table->cells = cells;
+
+        SDL_Texture** textures = realloc(table->rowTextures, (size_t)capacity * sizeof(SDL_Texture*));
+        if (!textures) return -1;
+        memset(textures + table->rowCapacity, 0, (size_t)(capacity - table->rowCapacity) * sizeof(SDL_Texture*));
+        table->rowTextures = textures;
+        table->rowCapacity = capacity;
+    }
+
+    int row = table->rowCount++;
+    memset(table->cells + (size_t)row * TABLE_MAX_COLUMNS * TABLE_CELL_LEN, 0,
+           TABLE_MAX_COLUMNS * TABLE_CELL_LEN);
+    table->rowTextures[row] = NULL;
+    return row;
+}
+
+static inline char* tableCell(IterationTable* table, int row, int column) {
+    return table->cells + ((size_t)row * TABLE_MAX_COLUMNS + column) * TABLE_CELL_LEN;
+}
+
+// printf-style cell formatting
+static inline void tableSetCell(IterationTable* table, int row, int column, const char* fmt, ...) {
+    if (row < 0 || row >= table->rowCount || column < 0 || column >= table->columnCount) return;
+
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(tableCell(table, row, column), TABLE_CELL_LEN, fmt, args);
+    va_end(args);
+}
+
+// Compose background and all cells of one row into a single texture
+static inline SDL_Texture* tableBuildRowTexture(SDL_Renderer* renderer, IterationTable* table, int row) {
+    SDL_Surface* rowSurface = SDL_CreateRGBSurfaceWithFormat(0, table->width, table->rowHeight, 32,
+                                                             SDL_PIXELFORMAT_ARGB8888);
+    if (!rowSurface) return NULL;
+
+    SDL_Color bg = table->rowBg[row % 2];
+    SDL_FillRect(rowSurface, NULL, SDL_MapRGBA(rowSurface->format, bg.r, bg.g, bg.b, bg.a));
+
+    for (int c = 0; c < table->columnCount; c++) {
+        const char* text = tableCell(table, row, c);
+        if (text[0] == '\0') continue;
+
+        SDL_Surface* cell = TTF_RenderUTF8_Blended(table->font, text, table->textColor);
+        if (!cell) continue;
+        SDL_Rect dst = {table->columnX[c], table->textY, cell->w, cell->h};
+        SDL_BlitSurface(cell, NULL, rowSurface, &dst);
+        SDL_FreeSurface(cell);
+    }
+
+    SDL_Texture* texture = hudCreateTextureFromSurface(renderer, rowSurface);
+    SDL_FreeSurface(rowSurface);
+    return texture;
+}
+
+// Fetch a row texture, building it on first use and evicting the oldest
+// cached row once the ring is full
+static inline SDL_Texture* tableRowTexture(SDL_Renderer* renderer, IterationTable* table, int row) {
+    if (table->rowTextures[row]) return table->rowTextures[row];
+
+    SDL_Texture* texture = tableBuildRowTexture(renderer, table, row);
+    if (!texture) return NULL;
+
+    if (table->cacheUsed == TABLE_TEXTURE_CACHE) {
+        int evicted = table->cacheRows[table->cacheNext];
+        if (table->rowTextures[evicted]) {
+            SDL_DestroyTexture(table->rowTextures[evicted]);
+            table->rowTextures[evicted] = NULL;
+        }
+    } else {
+        table->cacheUsed++;
+    }
+    table->cacheRows[table->cacheNext] = row;
+    table->cacheNext = (table->cacheNext + 1) % TABLE_TEXTURE_CACHE;
+
+    table->rowTextures[row] = texture;
+    return texture;
+}
+
+// Blit rows [firstRow, firstRow + visibleRows) starting at (x, y)
+static inline void tableRender(SDL_Renderer* renderer, IterationTable* table, int x, int y,
+                               int firstRow, int visibleRows) {
+    if (firstRow < 0) firstRow = 0;
+    int endRow = firstRow + visibleRows;
+    if (endRow > table->rowCount) endRow = table->rowCount;
+
+    TRACE_SCOPE("tableRender") {
+        for (int row = firstRow; row < endRow; row++) {
+            SDL_Texture* texture = tableRowTexture(renderer, table, row);
+            if (!texture) continue;
+            SDL_Rect dst = {x, y + (row - firstRow) * table->rowHeight, table->width, table->rowHeight};
+            hudRenderCopy(renderer, texture, NULL, &dst);
+        }
+    }
+}
+
+#endif
@@ -1,6 +1,7 @@
 #include <SDL.h>
 #include <stdio.h>
 #include <math.h>
+#include "poly_roots.h"
 
 #define MAX_ITER 50
 #define TOLERANCE 0.01
@@ -37,6 +38,37 @@ double f(double x, double a, double b, double c) {
     return a * x * x + b * x + c;
 }
 
+// Every real root of ax^2 + bx + c from polySolve, the N = 2 case of the
+// polynomial solver, to check the fixed point result against
+void printRealRoots(const double* roots, int count) {
+    if (count < 0) {
+        printf("the polynomial solver gave up\n");
+    } else if (count == 0) {
+        printf("none (the roots are complex)\n");
+    } else {
+        for (int i = 0; i < count; i++) {
+            printf("%sx = %.6lf", i ? ", " : "", roots[i]);
+        }
+        printf("\n");
+    }
+}
+
+// A ring of the given radii as one polyline: a circle at each radius,
+// stepping out one pixel between them
+void drawRing(SDL_Renderer* renderer, int cx, int cy, int inner, int outer) {
+    SDL_Point points[4 * 49];
+    int count = 0;
+    for (int r = inner; r <= outer && count + 49 <= 4 * 49; r++) {
+        for (int k = 0; k <= 48; k++) {
+            double t = k * (2 * M_PI / 48);
+            points[count].x = cx + (int)lround(r * cos(t));
+            points[count].y = cy + (int)lround(r * sin(t));
+            count++;
+        }
+    }
+    SDL_RenderDrawLines(renderer, points, count);
+}
+
 int main(int argc, char* argv[]) {
     double a, b, c, x0;
     int method;
@@ -148,6 +180,10 @@ int main(int argc, char* argv[]) {
         
         finalRoot = x_current;
         
+        double coefficients[] = {a, b, c};
+        double realRoots[2];
+        int realRootCount = polyRealRoots(coefficients, 3, realRoots);
+        
         // Check if we actually found a root
         double verification = fabs(f(finalRoot, a, b, c));
         int validRoot = (verification < 0.1);  
@@ -169,6 +205,10 @@ int main(int argc, char* argv[]) {
                 printf("(Should be close to 0 for a valid root)\n\n");
             }
             
+            printf("Real roots to aim x0 at: ");
+            printRealRoots(realRoots, realRootCount);
+            printf("\n");
+            
             printf("What would you like to do?\n");
             printf("  1. Try a different arrangement method\n");
             printf("  2. Try a different initial guess (x0)\n");
@@ -223,6 +263,8 @@ int main(int argc, char* argv[]) {
         printf("Results:\n");
         printf("  Approximate Root: x = %.2lf\n", finalRoot);
         printf("  Verification: f(%.2lf) = %.4lf ✓\n", finalRoot, f(finalRoot, a, b, c));
+        printf("  All Real Roots: ");
+        printRealRoots(realRoots, realRootCount);
         printf("  Total Iterations: %d\n", totalIter);
         printf("  Tolerance: %.2lf\n", TOLERANCE);
         printf("  Method: Arrangement #%d\n\n", method);
@@ -308,6 +350,12 @@ int main(int argc, char* argv[]) {
             }
         }
         
+        // Ring around every real root the polynomial solver found
+        SDL_SetRenderDrawColor(renderer, 80, 180, 255, 255);
+        for (int k = 0; k < realRootCount; k++) {
+            drawRing(renderer, centerX + (int)(realRoots[k] * scale), centerY, 11, 13);
+        }
+        
         SDL_RenderPresent(renderer);
         
         SDL_Event e;
@@ -0,0 +1,79 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <stddef.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Read-only memory mapping of a whole file.
+// Pages are loaded by the OS on first touch and shared with every other
+// process mapping the same file, so nothing is copied onto the heap. A file
+// still open for writing elsewhere (a session log being appended) can be
+// mapped; the mapping covers the size it had when opened.
+
+typedef struct {
+    const unsigned char* data;
+    size_t size;
+} MappedFile;
+
+// Map path; returns 0 on success. An empty file cannot be mapped and fails.
+static inline int mappedFileOpen(MappedFile* file, const char* path) {
+    memset(file, 0, sizeof(*file));
+
+#ifdef _WIN32
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) return -1;
+
+    LARGE_INTEGER size;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(handle, &size) && size.QuadPart > 0) {
+        mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    }
+    CloseHandle(handle);
+    if (!mapping) return -1;
+
+    // The view keeps the mapping alive after its handle is closed
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data) return -1;
+    file->size = (size_t)size.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (data == MAP_FAILED) return -1;
+    file->size = (size_t)st.st_size;
+#endif
+
+    file->data = data;
+    return 0;
+}
+
+static inline void mappedFileClose(MappedFile* file) {
+    if (!file->data) return;
+#ifdef _WIN32
+    UnmapViewOfFile(file->data);
+#else
+    munmap((void*)file->data, file->size);
+#endif
+    file->data = NULL;
+    file->size = 0;
+}
+
+#endif
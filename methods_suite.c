@@ -0,0 +1,31 @@
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#define EMBEDDED_ASSETS_IMPLEMENTATION
+#define TRACE_EVENTS_IMPLEMENTATION
+#include "methods_tabs.h"
+
+// All method GUIs in one window, one tab each.
+// Every method file is compiled with -DMETHODS_SUITE, which drops its own
+// main() and leaves its run function to be called from here. SDL, the
+// window, the fonts and the solve worker pool are created once and shared,
+// and this file carries the embedded font for all of them.
+//
+// Usage: methods_suite.exe [tab number]
+
+int main(int argc, char* argv[]) {
+    int first = argc > 1 ? atoi(argv[1]) - 1 : 0;
+    if (first < 0 || first >= METHOD_TAB_COUNT) first = 0;
+    
+    AppHost host;
+    const AppTab* tab = &methodTabs[first];
+    if (appHostInit(&host, tab->title, tab->width, tab->height, methodTabs, METHOD_TAB_COUNT) != 0) {
+        return 1;
+    }
+    
+    appHostRun(&host, first);
+    
+    appHostFree(&host);
+    return 0;
+}
@@ -0,0 +1,35 @@
+#ifndef METHODS_TABS_H
+#define METHODS_TABS_H
+
+#include "app_host.h"
+
+// The method GUIs of the suite, in tab order. Each is defined in its own
+// file compiled with -DMETHODS_SUITE.
+
+int secantRun(AppHost* host);
+int newtonRun(AppHost* host);
+int falsePositionRun(AppHost* host);
+int fixedPointRun(AppHost* host);
+int fixedPointExpRun(AppHost* host);
+int eliminationRun(AppHost* host);
+int raceRun(AppHost* host);
+int sweepRun(AppHost* host);
+int polyRun(AppHost* host);
+int historyRun(AppHost* host);
+
+static const AppTab methodTabs[] = {
+    {"Secant", "Secant Method - Exponential Equations", 1500, 950, secantRun},
+    {"Newton-Raphson", "Newton-Raphson Method - Exponential", 1400, 800, newtonRun},
+    {"False Position", "False Position Method - Exponential", 1400, 800, falsePositionRun},
+    {"Fixed Point", "Fixed Point Iteration - GUI", 1400, 800, fixedPointRun},
+    {"Fixed Point e^x", "Fixed Point Iteration - Exponential", 1400, 800, fixedPointExpRun},
+    {"Elimination", "Gaussian Elimination - 2 Variables", 1600, 900, eliminationRun},
+    {"Race", "Method Race - Exponential", 1400, 800, raceRun},
+    {"Sweep", "Parameter Sweep", 1400, 800, sweepRun},
+    {"Polynomial", "Polynomial Roots", 1400, 800, polyRun},
+    {"History", "Solve History", 1400, 800, historyRun},
+};
+
+#define METHOD_TAB_COUNT (int)(sizeof(methodTabs) / sizeof(methodTabs[0]))
+
+#endif
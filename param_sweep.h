@@ -0,0 +1,226 @@
+#ifndef PARAM_SWEEP_H
+#define PARAM_SWEEP_H
+
+#include <SDL.h>
+#include <stdlib.h>
+#include <string.h>
+#include "root_solvers.h"
+#include "solve_worker.h"
+
+#define SWEEP_CHUNK 256             // cells taken from a queue at a time
+#define SWEEP_MAX_SIDE 1024         // cells per grid side at most
+
+// Outcome of one cell; the failures follow the SOLVER_* failure codes
+enum { SWEEP_PENDING, SWEEP_CONVERGED, SWEEP_FAILED_BASE };
+
+typedef struct {
+    float root;
+    int iterations;                 // full width: an iter= budget may exceed 65535
+    unsigned char outcome;          // SWEEP_PENDING, SWEEP_CONVERGED or SWEEP_FAILED_BASE + failure
+    unsigned char pad[3];
+} SweepCell;
+
+// Chunk range [lo, hi) still to do by one worker
+typedef struct {
+    SDL_SpinLock lock;
+    int lo, hi;
+    char pad[52];                   // keep each queue on its own cache line
+} SweepQueue;
+
+// A grid of problems over the (a, b) plane, solved cell by cell with one
+// method from the same starting point.
+// Each worker job starts on an even share of the chunks and takes them from
+// the front of its own queue; when that runs dry it steals the back half of
+// the fullest other queue. Cells that fail run to stop.maxIter and cost far more
+// than cells that converge, so the shares would otherwise end very unevenly.
+// The grid is shared by the UI and the worker jobs and freed by whoever
+// releases it last. It is cancelled through its own flag rather than the
+// jobs', so every job runs and drops its reference; a job the pool drops
+// unrun (solvePoolStop) does the same through its drop hook. Workers write cells in
+// place; the UI may read a cell while it is being written and then just
+// shows it a frame late.
+typedef struct {
+    RootProblem problem;            // family and c; a and b vary per cell
+    SolverMethod method;
+    int form;
+    double x0, x1;
+    StopPolicy stop;
+    double aMin, aMax, bMin, bMax;
+    int cols, rows;                 // row 0 is bMin
+
+    SweepCell* cells;
+    int chunkCount;
+    SweepQueue queues[SOLVE_MAX_WORKERS];
+    int workerCount;
+
+    SDL_atomic_t refs;
+    SDL_atomic_t done;              // cells finished
+    SDL_atomic_t steals;
+    SDL_atomic_t active;            // worker jobs still running
+    SDL_atomic_t cancel;
+} SweepGrid;
+
+// Create a grid holding one reference for the caller; NULL if out of memory
+static inline SweepGrid* sweepGridCreate(int cols, int rows) {
+    if (cols < 1) cols = 1;
+    if (rows < 1) rows = 1;
+    if (cols > SWEEP_MAX_SIDE) cols = SWEEP_MAX_SIDE;
+    if (rows > SWEEP_MAX_SIDE) rows = SWEEP_MAX_SIDE;
+
+    SweepGrid* grid = calloc(1, sizeof(SweepGrid));
+    if (!grid) return NULL;
+    grid->cells = calloc((size_t)cols * rows, sizeof(SweepCell));
+    if (!grid->cells) {
+        free(grid);
+        return NULL;
+    }
+    grid->cols = cols;
+    grid->rows = rows;
+    grid->chunkCount = (cols * rows + SWEEP_CHUNK - 1) / SWEEP_CHUNK;
+    SDL_AtomicSet(&grid->refs, 1);
+    return grid;
+}
+
+static inline void sweepGridRelease(SweepGrid* grid) {
+    if (grid && SDL_AtomicAdd(&grid->refs, -1) == 1) {
+        free(grid->cells);
+        free(grid);
+    }
+}
+
+static inline void sweepGridCancel(SweepGrid* grid) {
+    SDL_AtomicSet(&grid->cancel, 1);
+}
+
+static inline int sweepGridRunning(SweepGrid* grid) {
+    return SDL_AtomicGet(&grid->active) > 0;
+}
+
+// Coefficients at the center of a cell
+static inline double sweepCellA(const SweepGrid* grid, int col) {
+    return grid->aMin + (col + 0.5) * (grid->aMax - grid->aMin) / grid->cols;
+}
+
+static inline double sweepCellB(const SweepGrid* grid, int row) {
+    return grid->bMin + (row + 0.5) * (grid->bMax - grid->bMin) / grid->rows;
+}
+
+// Run one cell's solve to completion with the shared f/f'/g kernels
+static inline void sweepSolveCell(const SweepGrid* grid, int index) {
+    RootProblem problem = grid->problem;
+    problem.a = sweepCellA(grid, index % grid->cols);
+    problem.b = sweepCellB(grid, index / grid->cols);
+
+    RootSolver solver;
+    solverInit(&solver, grid->method, &problem, grid->x0, grid->x1, 0, 0);
+    solver.form = grid->form;
+    solver.stop = grid->stop;
+
+    SolverRow row;
+    int status = solver.status;
+    while (status == SOLVER_RUNNING) {
+        status = solverStep(&solver, &row);
+    }
+
+    SweepCell* cell = &grid->cells[index];
+    cell->root = (float)solver.root;
+    cell->iterations = solver.n;
+    cell->outcome = status == SOLVER_CONVERGED ? SWEEP_CONVERGED : SWEEP_FAILED_BASE + solver.failure;
+}
+
+// Take the next chunk of worker self, stealing when its queue is empty.
+// Returns -1 once every queue is empty.
+static inline int sweepNextChunk(SweepGrid* grid, int self) {
+    SweepQueue* own = &grid->queues[self];
+    for (;;) {
+        SDL_AtomicLock(&own->lock);
+        int chunk = own->lo < own->hi ? own->lo++ : -1;
+        SDL_AtomicUnlock(&own->lock);
+        if (chunk >= 0) return chunk;
+
+        // Victim: the queue with the most left, read without its lock
+        int victim = -1, most = 0;
+        for (int i = 0; i < grid->workerCount; i++) {
+            int left = grid->queues[i].hi - grid->queues[i].lo;
+            if (i != self && left > most) {
+                most = left;
+                victim = i;
+            }
+        }
+        if (victim < 0) return -1;
+
+        SweepQueue* other = &grid->queues[victim];
+        int lo = 0, hi = 0;
+        SDL_AtomicLock(&other->lock);
+        if (other->lo < other->hi) {
+            hi = other->hi;
+            lo = other->lo + (other->hi - other->lo) / 2;
+            other->hi = lo;
+        }
+        SDL_AtomicUnlock(&other->lock);
+        if (lo == hi) continue;     // emptied meanwhile; look again
+
+        SDL_AtomicAdd(&grid->steals, 1);
+        SDL_AtomicLock(&own->lock);
+        own->lo = lo;
+        own->hi = hi;
+        SDL_AtomicUnlock(&own->lock);
+    }
+}
+
+// Worker job: data is the grid, intParams[0] the worker's queue
+static inline void sweepWorkerJob(SolveJob* job) {
+    SweepGrid* grid = job->data;
+    int self = job->intParams[0];
+    int cellCount = grid->cols * grid->rows;
+
+    int chunk;
+    while (!SDL_AtomicGet(&grid->cancel) && (chunk = sweepNextChunk(grid, self)) >= 0) {
+        int begin = chunk * SWEEP_CHUNK;
+        int end = begin + SWEEP_CHUNK < cellCount ? begin + SWEEP_CHUNK : cellCount;
+        for (int i = begin; i < end; i++) {
+            sweepSolveCell(grid, i);
+        }
+        SDL_AtomicAdd(&grid->done, end - begin);
+    }
+
+    SDL_AtomicAdd(&grid->active, -1);
+    solveJobFinish(job, SOLVE_CONVERGED, 0);
+    sweepGridRelease(grid);
+}
+
+// Drop hook: a worker job that never ran still leaves the grid
+static inline void sweepWorkerDrop(SolveJob* job) {
+    SweepGrid* grid = job->data;
+    SDL_AtomicAdd(&grid->active, -1);
+    sweepGridRelease(grid);
+}
+
+// Split the chunks over one worker job per pool thread and queue them.
+// Returns the number of workers started.
+static inline int sweepGridStart(SweepGrid* grid, SolveWorkerPool* pool) {
+    int workers = pool->threadCount > 0 ? pool->threadCount : 1;
+    if (workers > grid->chunkCount) workers = grid->chunkCount;
+    grid->workerCount = workers;
+    for (int i = 0; i < workers; i++) {
+        grid->queues[i].lo = grid->chunkCount * i / workers;
+        grid->queues[i].hi = grid->chunkCount * (i + 1) / workers;
+    }
+
+    int started = 0;
+    for (int i = 0; i < workers; i++) {
+        SolveJob* job = solveJobCreate(sweepWorkerJob);
+        if (!job) continue;
+        job->data = grid;
+        job->drop = sweepWorkerDrop;
+        job->intParams[0] = i;
+        SDL_AtomicAdd(&grid->refs, 1);
+        SDL_AtomicAdd(&grid->active, 1);
+        solvePoolSubmit(pool, job);
+        solveJobRelease(job);
+        started++;
+    }
+    return started;
+}
+
+#endif
@@ -0,0 +1,584 @@
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include "frame_hud.h"
+#include "trace_events.h"
+#include "app_host.h"
+#include "graph_view.h"
+#include "raster_canvas.h"
+#include "poly_roots.h"
+
+#define TOLERANCE 1e-14
+#define WINDOW_WIDTH 1400
+#define WINDOW_HEIGHT 800
+#define LIST_ROWS 30                // roots shown at once in the list
+
+// Polynomial roots: every complex root of a degree-N polynomial at once by
+// Aberth (or Durand-Kerner) iteration, shown on the complex plane. The
+// quadratic programs solve their a, b, c with the same polySolve as the
+// N = 2 case; this is the front end for any N up to POLY_MAX_DEGREE.
+
+enum { PRESET_UNITY, PRESET_RANDOM, PRESET_CHEBYSHEV, PRESET_WILKINSON, PRESET_EXP, PRESET_CUSTOM, PRESET_COUNT };
+
+static const char* presetNames[] = {
+    "x^N - 1", "Random coefficients", "Chebyshev T_N", "Wilkinson (x-1)...(x-N)", "Truncated e^x", "Custom"
+};
+static const char* methodNames[] = {"Aberth-Ehrlich", "Durand-Kerner"};
+
+// UI component structures
+typedef struct {
+    SDL_Rect rect;
+    char label[50];
+    char value[200];
+    int active;
+} InputBox;
+
+typedef struct {
+    SDL_Rect rect;
+    char text[50];
+    int hovered;
+    int clicked;
+} Button;
+
+// What the tab shows, kept while the user is on other tabs (appHostTabState)
+typedef struct {
+    int saved;
+    char values[2][50];
+    int preset;
+    PolyMethod method;
+    PolySolver solver;
+    int started;
+    double backward[POLY_MAX_DEGREE];
+    int listScroll;
+    char statusText[300];
+} PolyState;
+
+// Coefficients of a preset, highest power first; returns their count.
+// A custom list drops leading zeros and stores at most POLY_MAX_DEGREE + 1
+// values but counts them all, so a longer one can be refused.
+static int presetCoefficients(int preset, int degree, const char* custom, double* out) {
+    double low[POLY_MAX_DEGREE + 1] = {0};
+    double prev[POLY_MAX_DEGREE + 1] = {0};
+    int n = degree;
+    
+    if (preset == PRESET_CUSTOM) {
+        int count = 0;
+        const char* s = custom;
+        while (*s) {
+            char* end;
+            double v = strtod(s, &end);
+            if (end == s) {
+                s++;
+                continue;
+            }
+            if (count > 0 || v != 0) {
+                if (count <= POLY_MAX_DEGREE) out[count] = v;
+                count++;
+            }
+            s = end;
+        }
+        return count;
+    }
+    
+    switch (preset) {
+        case PRESET_UNITY:
+            low[0] = -1;
+            low[n] = 1;
+            break;
+        case PRESET_RANDOM: {
+            // Fixed seed per degree, so the same N gives the same polynomial
+            Uint32 seed = 12345u + (Uint32)n;
+            for (int k = 0; k <= n; k++) {
+                seed = seed * 1664525u + 1013904223u;
+                low[k] = (seed >> 8) / (double)(1 << 24) * 2 - 1;
+            }
+            break;
+        }
+        case PRESET_CHEBYSHEV:
+            // T(k+1) = 2x T(k) - T(k-1), from T0 = 1 and T1 = x
+            prev[0] = 1;
+            low[1] = 1;
+            if (n == 0) low[0] = 1;
+            for (int k = 1; k < n; k++) {
+                double next[POLY_MAX_DEGREE + 1];
+                for (int j = 0; j <= k + 1; j++) {
+                    next[j] = (j > 0 ? 2 * low[j - 1] : 0) - prev[j];
+                }
+                memcpy(prev, low, sizeof(low));
+                memcpy(low, next, (k + 2) * sizeof(double));
+            }
+            break;
+        case PRESET_WILKINSON:
+            low[0] = 1;
+            for (int k = 1; k <= n; k++) {
+                for (int j = k; j >= 0; j--) {
+                    low[j] = (j > 0 ? low[j - 1] : 0) - k * low[j];
+                }
+            }
+            break;
+        default: {
+            double term = 1;
+            for (int k = 0; k <= n; k++) {
+                low[k] = term;
+                term /= k + 1;
+            }
+            break;
+        }
+    }
+    for (int k = 0; k <= n; k++) {
+        out[k] = low[n - k];
+    }
+    return n + 1;
+}
+
+// Frame the plane around the current estimates, same scale on both axes
+static void frameRoots(GraphView* view, const PolySolver* s) {
+    double xMin = INFINITY, xMax = -INFINITY, yMin = INFINITY, yMax = -INFINITY;
+    for (int i = 0; i < s->degree; i++) {
+        if (!isfinite(s->re[i]) || !isfinite(s->im[i])) continue;
+        xMin = fmin(xMin, s->re[i]);
+        xMax = fmax(xMax, s->re[i]);
+        yMin = fmin(yMin, s->im[i]);
+        yMax = fmax(yMax, s->im[i]);
+    }
+    if (xMin > xMax) {
+        graphViewFrame(view, -2, 2, -2, 2);
+        return;
+    }
+    double cx = 0.5 * (xMin + xMax), cy = 0.5 * (yMin + yMax);
+    double half = 0.6 * fmax(fmax(xMax - xMin, yMax - yMin), 1e-6);
+    graphViewFrame(view, cx - half, cx + half, cy - half, cy + half);
+}
+
+// Unit circle for orientation and a dot per root, done ones green, drawn
+// into the canvas over the plane
+static void drawRoots(RasterCanvas* canvas, const GraphView* view, const PolySolver* solver, int count,
+                      int hovered) {
+    double ox = 0.5 - view->rect.x, oy = 0.5 - view->rect.y;
+    double lastX = graphToScreenX(view, 1) + ox, lastY = graphToScreenY(view, 0) + oy;
+    for (int i = 1; i <= 128; i++) {
+        double angle = 2 * M_PI * i / 128;
+        double x = graphToScreenX(view, cos(angle)) + ox, y = graphToScreenY(view, sin(angle)) + oy;
+        canvasLine(canvas, lastX, lastY, x, y, 1, 0xFF5A6482);
+        lastX = x;
+        lastY = y;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        int done = solver->done[i] || solver->status == POLY_BACKWARD;
+        canvasDisc(canvas, graphToScreenX(view, solver->re[i]) + ox, graphToScreenY(view, solver->im[i]) + oy,
+                   i == hovered ? 6.5 : 4.5, done ? 0xFF64FF64 : 0xFFFF5050);
+    }
+}
+
+// Render text with UTF-8 support
+// (the draw list frees the texture once the frame is submitted)
+static void renderText(DrawList* draw, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, color);
+    if (!surface) return;
+    
+    SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+    SDL_Rect rect = {x, y, surface->w, surface->h};
+    drawListTexture(draw, texture, NULL, &rect, 1);
+    
+    SDL_FreeSurface(surface);
+}
+
+// Render input box with label and value; a long value shows its tail
+static void renderInputBox(DrawList* draw, TTF_Font* font, InputBox* box) {
+    SDL_Color fill;
+    if (box->active) {
+        fill = (SDL_Color){220, 232, 250, 255};
+    } else {
+        fill = (SDL_Color){240, 245, 252, 255};
+    }
+    drawListFillRect(draw, &box->rect, fill);
+    
+    drawListRect(draw, &box->rect, (SDL_Color){50, 90, 150, 255});
+    
+    renderText(draw, font, box->label, box->rect.x - 80, box->rect.y + 5, (SDL_Color){30, 60, 110, 255});
+    int len = strlen(box->value);
+    if (len > 0) {
+        const char* shown = len > 24 ? box->value + len - 24 : box->value;
+        renderText(draw, font, shown, box->rect.x + 5, box->rect.y + 5, (SDL_Color){20, 40, 80, 255});
+    }
+}
+
+// Render button with hover and click effects
+static void renderButton(DrawList* draw, TTF_Font* font, Button* btn) {
+    SDL_Color fill;
+    if (btn->clicked) {
+        fill = (SDL_Color){20, 50, 100, 255};
+    } else if (btn->hovered) {
+        fill = (SDL_Color){60, 100, 170, 255};
+    } else {
+        fill = (SDL_Color){40, 80, 140, 255};
+    }
+    drawListFillRect(draw, &btn->rect, fill);
+    
+    drawListRect(draw, &btn->rect, (SDL_Color){20, 40, 80, 255});
+    
+    SDL_Surface* surface = TTF_RenderText_Blended(font, btn->text, (SDL_Color){255, 255, 255, 255});
+    if (surface) {
+        int textX = btn->rect.x + (btn->rect.w - surface->w) / 2;
+        int textY = btn->rect.y + (btn->rect.h - surface->h) / 2;
+        SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+        SDL_Rect rect = {textX, textY, surface->w, surface->h};
+        drawListTexture(draw, texture, NULL, &rect, 1);
+        SDL_FreeSurface(surface);
+    }
+}
+
+static int insideRect(const SDL_Rect* r, int x, int y) {
+    return x >= r->x && x <= r->x + r->w && y >= r->y && y <= r->y + r->h;
+}
+
+int polyRun(AppHost* host) {
+    SDL_Renderer* renderer = host->renderer;
+    DrawList* draw = &host->draw;
+    
+    // Load fonts
+    TTF_Font* font = appHostFont(host, 18);
+    TTF_Font* fontSmall = appHostFont(host, 14);
+    TTF_Font* fontMedium = appHostFont(host, 16);
+    TTF_Font* fontTitle = appHostFont(host, 24);
+    
+    PolyState* saved = appHostTabState(host, sizeof(PolyState), NULL);
+    if (!font || !fontSmall || !fontMedium || !fontTitle || !saved) {
+        return 1;
+    }
+    
+    // Degree of the presets, and the coefficients of Custom
+    InputBox inputs[2] = {
+        {{110, 90, 150, 32}, "Degree:", "50", 0},
+        {{110, 132, 250, 32}, "Coefs:", "1 0 -2 0 1", 0},
+    };
+    
+    int preset = PRESET_UNITY;
+    PolyMethod method = POLY_ABERTH;
+    Button presetBtn = {{30, 180, 330, 32}, "", 0, 0};
+    Button methodBtn = {{30, 218, 330, 32}, "", 0, 0};
+    Button solveBtn = {{30, 264, 120, 40}, "SOLVE", 0, 0};
+    Button stepBtn = {{170, 264, 120, 40}, "STEP", 0, 0};
+    Button* buttons[] = {&presetBtn, &methodBtn, &solveBtn, &stepBtn};
+    
+    GraphView plane;
+    graphViewInit(&plane, (SDL_Rect){390, 85, 680, 680}, (SDL_Color){100, 255, 100, 255}, 2);
+    graphViewFrame(&plane, -2, 2, -2, 2);
+    RasterCanvas rootCanvas;
+    canvasInit(&rootCanvas, renderer, plane.rect.w, plane.rect.h);
+    
+    PolySolver solver;
+    memset(&solver, 0, sizeof(solver));
+    int started = 0;            // solver holds a problem, possibly mid-solve
+    double backward[POLY_MAX_DEGREE];
+    int listScroll = 0;
+    int hovered = -1;
+    int rootsVersion = 0;       // bumped whenever the roots may have moved
+    
+    char statusText[300] = "Pick a polynomial and press SOLVE,\nor STEP (N) to watch the roots move.";
+    int activeInput = -1;
+    int quit = 0;
+    
+    // Back on this tab: the roots as the user left them, mid-solve or not
+    if (saved->saved) {
+        strcpy(inputs[0].value, saved->values[0]);
+        strcpy(inputs[1].value, saved->values[1]);
+        preset = saved->preset;
+        method = saved->method;
+        solver = saved->solver;
+        started = saved->started;
+        memcpy(backward, saved->backward, sizeof(backward));
+        listScroll = saved->listScroll;
+        strcpy(statusText, saved->statusText);
+        if (started) frameRoots(&plane, &solver);
+    }
+    
+    // Frame timing overlay, toggled with F3
+    FrameHud hud;
+    hudInit(&hud);
+    SDL_Event e;
+    
+    while (!quit && !appHostSwitching(host)) {
+        hudBeginFrame(&hud);
+        int solve = 0, step = 0;
+        
+        while (appHostPollEvent(host, &e)) {
+            if (appHostEvent(host, &e)) continue;
+            if (e.type == SDL_QUIT) quit = 1;
+            if (graphViewHandleEvent(&plane, &e)) continue;
+            
+            if (e.type == SDL_MOUSEBUTTONDOWN) {
+                int mx = e.button.x;
+                int my = e.button.y;
+                
+                activeInput = -1;
+                for (int i = 0; i < 2; i++) {
+                    if (insideRect(&inputs[i].rect, mx, my)) activeInput = i;
+                    inputs[i].active = (i == activeInput);
+                }
+                
+                if (insideRect(&presetBtn.rect, mx, my)) {
+                    presetBtn.clicked = 1;
+                    preset = (preset + 1) % PRESET_COUNT;
+                    started = 0;
+                }
+                if (insideRect(&methodBtn.rect, mx, my)) {
+                    methodBtn.clicked = 1;
+                    method = method == POLY_ABERTH ? POLY_DURAND_KERNER : POLY_ABERTH;
+                    started = 0;
+                }
+                if (insideRect(&solveBtn.rect, mx, my)) {
+                    solveBtn.clicked = 1;
+                    solve = 1;
+                }
+                if (insideRect(&stepBtn.rect, mx, my)) {
+                    stepBtn.clicked = 1;
+                    step = 1;
+                }
+            }
+            
+            if (e.type == SDL_MOUSEBUTTONUP) {
+                for (int i = 0; i < 4; i++) buttons[i]->clicked = 0;
+            }
+            
+            if (e.type == SDL_MOUSEMOTION) {
+                int mx = e.motion.x;
+                int my = e.motion.y;
+                for (int i = 0; i < 4; i++) buttons[i]->hovered = insideRect(&buttons[i]->rect, mx, my);
+            }
+            
+            if (e.type == SDL_MOUSEWHEEL) {
+                listScroll -= e.wheel.y * 3;
+            }
+            
+            if (e.type == SDL_TEXTINPUT && activeInput >= 0) {
+                char c = e.text.text[0];
+                int allowed = (c >= '0' && c <= '9') ||
+                              (activeInput == 1 && (c == '.' || c == '-' || c == 'e' || c == ' ' || c == ','));
+                int len = strlen(inputs[activeInput].value);
+                if (allowed && len < (activeInput == 1 ? 190 : 3)) {
+                    inputs[activeInput].value[len] = c;
+                    inputs[activeInput].value[len + 1] = '\0';
+                    started = 0;
+                }
+            }
+            
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F3) {
+                hudToggle(&hud);
+            }
+            
+            if (e.type == SDL_KEYDOWN && activeInput < 0 && e.key.keysym.sym == SDLK_n) {
+                step = 1;
+            }
+            
+            if (e.type == SDL_KEYDOWN && activeInput >= 0 && e.key.keysym.sym == SDLK_BACKSPACE) {
+                int len = strlen(inputs[activeInput].value);
+                if (len > 0) inputs[activeInput].value[len - 1] = '\0';
+                started = 0;
+            }
+        }
+        
+        sprintf(presetBtn.text, "Polynomial: %s", presetNames[preset]);
+        sprintf(methodBtn.text, "Method: %s", methodNames[method]);
+        
+        hudPhase(&hud, HUD_SOLVE);
+        
+        // SOLVE always starts over; STEP continues a solve in progress
+        if (solve || (step && (!started || solver.status != POLY_RUNNING))) {
+            double coefs[POLY_MAX_DEGREE + 1];
+            int degree = atoi(inputs[0].value);
+            if (degree < 1) degree = 1;
+            // A preset above the limit is not built at all; a custom list
+            // that long is refused by polyInit
+            int count = preset == PRESET_CUSTOM || degree <= POLY_MAX_DEGREE
+                      ? presetCoefficients(preset, degree, inputs[1].value, coefs) : degree + 1;
+            int finite = 1, solverDegree = -1;
+            if (preset == PRESET_CUSTOM || degree <= POLY_MAX_DEGREE) {
+                for (int k = 0; k < count && k <= POLY_MAX_DEGREE; k++) finite &= isfinite(coefs[k]) != 0;
+                if (finite) solverDegree = polyInit(&solver, coefs, count, method, TOLERANCE);
+            }
+            started = solverDegree > 0;
+            listScroll = 0;
+            if (started) {
+                frameRoots(&plane, &solver);
+            } else if (!finite) {
+                strcpy(statusText, "The coefficients overflow a double\nat this degree.");
+            } else if (solverDegree < 0) {
+                sprintf(statusText, "Degree %d is above the limit of %d;\nnothing was solved.",
+                        count - 1, POLY_MAX_DEGREE);
+            } else {
+                strcpy(statusText, "Nothing to solve: the polynomial\nhas no roots (degree 0).");
+            }
+        }
+        if (solve || step) rootsVersion++;
+        if (started && (solve || step)) {
+            TRACE_SCOPE("polySolve") {
+                if (solve) {
+                    polySolve(&solver, POLY_MAX_ITER);
+                    frameRoots(&plane, &solver);
+                } else {
+                    polyStep(&solver);
+                }
+            }
+            
+            double worst = 0;
+            for (int i = 0; i < solver.degree; i++) {
+                backward[i] = polyBackwardError(&solver, i);
+                if (!(backward[i] <= worst)) worst = backward[i];
+            }
+            int n = solver.degree;
+            char outcome[64];
+            if (solver.status == POLY_CONVERGED) {
+                strcpy(outcome, "converged");
+            } else if (solver.status == POLY_BACKWARD) {
+                strcpy(outcome, "within backward error");
+            } else {
+                sprintf(outcome, "%d of %d roots done%s", solver.converged, n,
+                        solver.iterations >= POLY_MAX_ITER ? " (gave up)" : "");
+            }
+            sprintf(statusText, "Degree %d, %s\n%d iterations, %s\n"
+                    "%.1f us (%.1f ns per root per iteration)\nWorst backward error: %.2e",
+                    n, methodNames[solver.method], solver.iterations, outcome,
+                    solver.ns / 1000.0, (double)solver.ns / ((double)n * solver.iterations), worst);
+        }
+        
+        int rows = started ? solver.degree : 0;
+        if (listScroll > rows - LIST_ROWS) listScroll = rows - LIST_ROWS;
+        if (listScroll < 0) listScroll = 0;
+        
+        // Root under the mouse, if any is within a few pixels
+        hovered = -1;
+        if (started && graphViewContains(&plane, plane.mouseX, plane.mouseY)) {
+            double best = 64;
+            for (int i = 0; i < solver.degree; i++) {
+                double dx = graphToScreenX(&plane, solver.re[i]) - plane.mouseX;
+                double dy = graphToScreenY(&plane, solver.im[i]) - plane.mouseY;
+                if (dx * dx + dy * dy < best) {
+                    best = dx * dx + dy * dy;
+                    hovered = i;
+                }
+            }
+        }
+        
+        // ==================== RENDER ====================
+        hudPhase(&hud, HUD_TEXT);
+        SDL_SetRenderDrawColor(renderer, 240, 244, 250, 255);
+        hudRenderClear(renderer);
+        
+        SDL_Rect banner = {0, 0, WINDOW_WIDTH, 70};
+        drawListFillRect(draw, &banner, (SDL_Color){30, 60, 110, 255});
+        renderText(draw, fontTitle, "POLYNOMIAL ROOTS", 30, 10, (SDL_Color){255, 255, 255, 255});
+        renderText(draw, fontMedium, "All N complex roots at once, no deflation",
+                   30, 42, (SDL_Color){200, 220, 255, 255});
+        
+        SDL_Color sectionColor = {30, 60, 110, 255};
+        SDL_Color hintColor = {90, 100, 120, 255};
+        
+        for (int i = 0; i < 2; i++) {
+            renderInputBox(draw, font, &inputs[i]);
+        }
+        for (int i = 0; i < 4; i++) {
+            renderButton(draw, i < 2 ? fontSmall : font, buttons[i]);
+        }
+        
+        char statusCopy[300];
+        strcpy(statusCopy, statusText);
+        char* line = strtok(statusCopy, "\n");
+        int sy = 325;
+        while (line) {
+            renderText(draw, fontSmall, line, 30, sy, (SDL_Color){60, 60, 80, 255});
+            sy += 20;
+            line = strtok(NULL, "\n");
+        }
+        
+        renderText(draw, fontSmall, "Coefs: highest power first, for Custom", 30, 430, hintColor);
+        renderText(draw, fontSmall, "Green: done, red: still moving", 30, 450, hintColor);
+        renderText(draw, fontSmall, "Wheel zooms, drag pans, right-click resets", 30, 470, hintColor);
+        
+        if (hovered >= 0) {
+            char info[96];
+            renderText(draw, font, "ROOT", 30, 520, sectionColor);
+            sprintf(info, "z%d = %.15g", hovered + 1, solver.re[hovered]);
+            renderText(draw, fontSmall, info, 30, 550, hintColor);
+            sprintf(info, "      %+.15g i", solver.im[hovered]);
+            renderText(draw, fontSmall, info, 30, 570, hintColor);
+            sprintf(info, "Backward error: %.2e", backward[hovered]);
+            renderText(draw, fontSmall, info, 30, 590, hintColor);
+        }
+        
+        // The complex plane: re across, im up
+        hudPhase(&hud, HUD_GRAPH);
+        drawListFillRect(draw, &plane.rect, (SDL_Color){30, 35, 45, 255});
+        drawListFlush(draw);
+        SDL_RenderSetClipRect(renderer, &plane.rect);
+        
+        graphDrawGrid(draw, &plane, 20, (SDL_Color){50, 60, 70, 255});
+        graphDrawAxes(draw, &plane, (SDL_Color){200, 200, 210, 255});
+        drawListFlush(draw);
+        SDL_RenderSetClipRect(renderer, NULL);
+        
+        double key[] = {plane.cx, plane.cy, graphPpuX(&plane), graphPpuY(&plane), rootsVersion, rows, hovered};
+        if (canvasBegin(&rootCanvas, key, sizeof(key))) {
+            canvasClear(&rootCanvas, 0);
+            drawRoots(&rootCanvas, &plane, &solver, rows, hovered);
+        }
+        canvasRender(renderer, &rootCanvas, plane.rect.x, plane.rect.y);
+        drawListRect(draw, &plane.rect, (SDL_Color){50, 90, 150, 255});
+        hudPhase(&hud, HUD_TEXT);
+        
+        // Root list, scrolled with the wheel
+        int lx = plane.rect.x + plane.rect.w + 30;
+        renderText(draw, font, "ROOTS", lx, 90, sectionColor);
+        for (int i = listScroll; i < rows && i < listScroll + LIST_ROWS; i++) {
+            char entry[96];
+            sprintf(entry, "%3d  %10.6f %+10.6fi  %.0e", i + 1, solver.re[i], solver.im[i], backward[i]);
+            int done = solver.done[i] || solver.status == POLY_BACKWARD;
+            SDL_Color color = done ? hintColor : (SDL_Color){190, 50, 50, 255};
+            if (i == hovered) color = sectionColor;
+            renderText(draw, fontSmall, entry, lx, 120 + (i - listScroll) * 21, color);
+        }
+        
+        appHostRenderTabs(host);
+        hudRender(renderer, fontSmall, &hud, WINDOW_WIDTH - 270, 10);
+        
+        hudPhase(&hud, HUD_PRESENT);
+        TRACE_SCOPE("SDL_RenderPresent") {
+            SDL_RenderPresent(renderer);
+        }
+        hudPhase(&hud, HUD_IDLE);
+        appHostEndFrame(host);
+    }
+    
+    graphViewFree(&plane);
+    canvasFree(&rootCanvas);
+    
+    strcpy(saved->values[0], inputs[0].value);
+    strcpy(saved->values[1], inputs[1].value);
+    saved->preset = preset;
+    saved->method = method;
+    saved->solver = solver;
+    saved->started = started;
+    memcpy(saved->backward, backward, sizeof(backward));
+    saved->listScroll = listScroll;
+    strcpy(saved->statusText, statusText);
+    saved->saved = 1;
+    return 0;
+}
+
+#ifndef METHODS_SUITE
+int main(int argc, char* argv[]) {
+    AppHost host;
+    if (appHostInit(&host, "Polynomial Roots", WINDOW_WIDTH, WINDOW_HEIGHT, NULL, 0) != 0) {
+        return 1;
+    }
+    
+    int result = polyRun(&host);
+    
+    appHostFree(&host);
+    return result;
+}
+#endif
@@ -0,0 +1,395 @@
+#ifndef POLY_ROOTS_H
+#define POLY_ROOTS_H
+
+#include <SDL.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+// All complex roots of a real polynomial of degree N at once.
+// Every root estimate is corrected in each iteration from all the others
+// (Aberth-Ehrlich, or Durand-Kerner for comparison), so there is no
+// deflation and no error carried from one root into the next.
+// The estimates are kept as separate re/im arrays and every loop runs
+// across all roots in lockstep with no branches, so the compiler can
+// vectorize them: evaluation is one Horner pass over the coefficients for
+// all roots at once, and the pairwise sums run over the roots the same way.
+
+#define POLY_MAX_DEGREE 256
+#define POLY_MAX_ITER 500
+#define POLY_ROUNDING 2             // backward error, in units of N eps, that rounding alone explains
+#define POLY_SETTLE 3               // iterations in a row at rounding level before settling for it
+#define POLY_PAIRING 1e-5           // relative distance within which two roots count as conjugates
+#define POLY_RESIDUAL 1e-8          // backward error past which a returned real root is not a root
+#define POLY_NARROW 1e140           // root sizes within 1/x..x keep |z_i - z_j|^2 a finite double
+
+typedef enum { POLY_ABERTH, POLY_DURAND_KERNER } PolyMethod;
+
+// Converged: every correction is within tolerance and the roots pair into
+// conjugates. Backward: the corrections never got that small, but every
+// root has stayed at the rounding error of evaluating p and the roots pair
+// up; on ill-conditioned input (Wilkinson) that is as good as it gets.
+typedef enum { POLY_RUNNING, POLY_CONVERGED, POLY_BACKWARD } PolyStatus;
+
+typedef struct {
+    int degree;
+    double coef[POLY_MAX_DEGREE + 1];   // coef[k] multiplies x^k; coef[degree] != 0
+    PolyMethod method;
+    double tolerance;                   // relative correction at which a root is done
+    double radius;                      // of the innermost starting circle: the size of the smallest roots
+    int wide;                           // root sizes span past POLY_NARROW: scale the pairwise sums
+
+    double re[POLY_MAX_DEGREE], im[POLY_MAX_DEGREE];
+    int done[POLY_MAX_DEGREE];          // last correction was within tolerance
+    int iterations;
+    int converged;                      // roots done in the last iteration
+    int settled;                        // roots whose p(z) is down at rounding error
+    int settledFor;                     // iterations in a row with all settled and paired
+    PolyStatus status;
+    Uint64 ns;
+
+    // Per-iteration scratch, one lane per root
+    double yr[POLY_MAX_DEGREE], yi[POLY_MAX_DEGREE];    // z, or 1/z outside the unit circle
+    int flip[POLY_MAX_DEGREE];                          // lane evaluates q(1/z)
+    double pr[POLY_MAX_DEGREE], pi[POLY_MAX_DEGREE];    // p(z) or q(y), then the Newton ratio p/p'
+    double dr[POLY_MAX_DEGREE], di[POLY_MAX_DEGREE];    // p'(z) or q'(y)
+    double sr[POLY_MAX_DEGREE], si[POLY_MAX_DEGREE];    // pairwise sum or product
+    double backward[POLY_MAX_DEGREE];                   // |p(z)| / sum |a_k| |z|^k
+} PolySolver;
+
+// Set up a solve; coefficients with the highest power first, as typed.
+// Leading zeros are dropped. Returns the degree (0: nothing to solve), or
+// -1 if it is above POLY_MAX_DEGREE: dropping coefficients would solve a
+// different polynomial.
+static inline int polyInit(PolySolver* s, const double* highFirst, int count, PolyMethod method, double tolerance) {
+    memset(s, 0, sizeof(*s));
+    while (count > 0 && highFirst[0] == 0) {
+        highFirst++;
+        count--;
+    }
+    if (count > POLY_MAX_DEGREE + 1) return -1;
+    s->degree = count > 0 ? count - 1 : 0;
+    for (int k = 0; k <= s->degree; k++) {
+        s->coef[k] = highFirst[s->degree - k];
+    }
+    s->method = method;
+    s->tolerance = tolerance;
+
+    // Start on circles whose radii come from the Newton polygon: the upper
+    // convex hull of (k, log|a_k|). An edge from a_j to a_k says k - j
+    // roots have size about |a_j / a_k|^(1/(k - j)), so roots that differ
+    // by hundreds of orders of magnitude each start near their own size.
+    // The circles are turned off the real axis so that real roots and
+    // conjugate pairs can separate.
+    int n = s->degree;
+    if (n == 0) return 0;
+    int hull[POLY_MAX_DEGREE + 1], h = 0;
+    double logs[POLY_MAX_DEGREE + 1];
+    for (int k = 0; k <= n; k++) {
+        if (s->coef[k] == 0) continue;
+        logs[k] = log(fabs(s->coef[k]));
+        while (h >= 2 && (logs[hull[h - 1]] - logs[hull[h - 2]]) * (k - hull[h - 2]) <=
+                         (logs[k] - logs[hull[h - 2]]) * (hull[h - 1] - hull[h - 2])) {
+            h--;
+        }
+        hull[h++] = k;
+    }
+    // Roots at 0 (a_0 = 0) start on the innermost circle
+    int i = 0;
+    s->radius = INFINITY;
+    for (int e = 0; e + 1 < h; e++) {
+        int count = hull[e + 1] - hull[e];
+        double radius = exp((logs[hull[e]] - logs[hull[e + 1]]) / count);
+        if (!(radius > 0) || isinf(radius)) radius = radius > 0 ? DBL_MAX : DBL_MIN;
+        if (radius < s->radius) s->radius = radius;
+        s->wide |= radius < 1 / POLY_NARROW || radius > POLY_NARROW;
+        if (e == 0) count += hull[0];
+        for (int j = 0; j < count; j++, i++) {
+            double angle = 2 * M_PI * j / count + 0.4 + e;
+            s->re[i] = radius * cos(angle);
+            s->im[i] = radius * sin(angle);
+        }
+    }
+    if (h < 2) s->radius = 1;      // only a_N is nonzero: every root is 0
+    return n;
+}
+
+// The power of two 2^-e for x = m 2^e, straight from the exponent bits:
+// multiplying by it is exact and brings x into [1, 2)
+static inline double polyUnitScale(double x) {
+    Uint64 bits;
+    memcpy(&bits, &x, sizeof(bits));
+    bits = 0x7FE0000000000000ULL - (bits & 0x7FF0000000000000ULL);
+    memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+// a / b for complex a and b, with b scaled to unit size first so that
+// neither |b|^2 nor the products overflow or underflow on their way to a
+// representable quotient; no branch, so it vectorizes in the root loops
+static inline void polyDivide(double ar, double ai, double br, double bi, double* qr, double* qi) {
+    double k = 1 / fmax(fabs(br), fabs(bi));
+    br *= k;
+    bi *= k;
+    double b2 = br * br + bi * bi;
+    *qr = (ar * br + ai * bi) / b2 * k;
+    *qi = (ai * br - ar * bi) / b2 * k;
+}
+
+// p(z) for every root by lockstep Horner, and p'(z) with derivative set.
+// Outside the unit circle p(z) grows as |z|^N, so those lanes evaluate the
+// reversed polynomial q(y) = y^N p(1/y) at y = 1/z instead; a lane picks
+// its coefficient order and point by select, not by branch. The lane's
+// point and choice are left in yr, yi and flip for the caller.
+static inline void polyEvaluate(PolySolver* s, int derivative) {
+    int n = s->degree;
+    double m[POLY_MAX_DEGREE], scale[POLY_MAX_DEGREE];
+    for (int i = 0; i < n; i++) {
+        // 1/z as (conj(z) / |z|) / |z|, which neither overflows nor
+        // underflows where |z|^2 would
+        double mz = hypot(s->re[i], s->im[i]);
+        s->flip[i] = mz > 1;
+        double inv = s->flip[i] ? 1 / mz : 1;
+        s->yr[i] = s->flip[i] ? s->re[i] * inv * inv : s->re[i];
+        s->yi[i] = s->flip[i] ? -s->im[i] * inv * inv : s->im[i];
+        m[i] = s->flip[i] ? inv : mz;
+        s->pr[i] = s->flip[i] ? s->coef[0] : s->coef[n];
+        s->pi[i] = 0;
+        scale[i] = fabs(s->pr[i]);
+        s->dr[i] = 0;
+        s->di[i] = 0;
+    }
+    for (int k = 1; k <= n; k++) {
+        double high = s->coef[n - k], low = s->coef[k];
+        if (derivative) {
+            for (int i = 0; i < n; i++) {
+                // d = d y + p, before p = p y + c
+                double r = s->dr[i] * s->yr[i] - s->di[i] * s->yi[i] + s->pr[i];
+                s->di[i] = s->dr[i] * s->yi[i] + s->di[i] * s->yr[i] + s->pi[i];
+                s->dr[i] = r;
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            double c = s->flip[i] ? low : high;
+            double r = s->pr[i] * s->yr[i] - s->pi[i] * s->yi[i] + c;
+            s->pi[i] = s->pr[i] * s->yi[i] + s->pi[i] * s->yr[i];
+            s->pr[i] = r;
+            scale[i] = scale[i] * m[i] + fabs(c);
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        // The same for q at y as for p at z: both sides scale by |z|^N
+        double p = hypot(s->pr[i], s->pi[i]);
+        s->backward[i] = scale[i] > 0 ? p / scale[i] : 0;
+    }
+}
+
+// Newton ratio p/p' for every root; in the reflected lanes
+// p/p' = z / (N - y q'(y) / q(y))
+static inline void polyNewtonRatio(PolySolver* s) {
+    int n = s->degree;
+    polyEvaluate(s, 1);
+    for (int i = 0; i < n; i++) {
+        // t = d / p: the ratio itself (inverted) inside, y q'/q outside
+        double tr, ti;
+        polyDivide(s->dr[i], s->di[i], s->pr[i], s->pi[i], &tr, &ti);
+        double ur = s->flip[i] ? n - (s->yr[i] * tr - s->yi[i] * ti) : tr;
+        double ui = s->flip[i] ? -(s->yr[i] * ti + s->yi[i] * tr) : ti;
+        // ratio = (flip ? z : 1) / u
+        double nr = s->flip[i] ? s->re[i] : 1, ni = s->flip[i] ? s->im[i] : 0;
+        polyDivide(nr, ni, ur, ui, &s->pr[i], &s->pi[i]);
+    }
+}
+
+// Whether the estimates pair into conjugates, as the roots of a real
+// polynomial must: each is real to within POLY_PAIRING, or has a partner
+// within POLY_PAIRING of its conjugate, relative to its size but never
+// less than the radius so that roots at 0 are judged on the same scale. A root frozen off the real axis
+// while its partner is still elsewhere fails this even if p(z) is small.
+static inline int polyPaired(const PolySolver* s) {
+    int n = s->degree;
+    int used[POLY_MAX_DEGREE] = {0};
+    for (int i = 0; i < n; i++) {
+        double reach = POLY_PAIRING * fmax(hypot(s->re[i], s->im[i]), s->radius);
+        if (used[i] || fabs(s->im[i]) <= reach) continue;
+        int best = -1;
+        double bestDistance = reach;
+        for (int j = i + 1; j < n; j++) {
+            double d = hypot(s->re[j] - s->re[i], s->im[j] + s->im[i]);
+            if (!used[j] && d <= bestDistance) {
+                best = j;
+                bestDistance = d;
+            }
+        }
+        if (best < 0) return 0;
+        used[best] = 1;
+    }
+    return 1;
+}
+
+// One iteration over all roots. Returns 0 once the solve is finished.
+static inline int polyStep(PolySolver* s) {
+    Uint64 start = SDL_GetPerformanceCounter();
+    int n = s->degree;
+    double wr[POLY_MAX_DEGREE], wi[POLY_MAX_DEGREE];
+
+    if (s->method == POLY_ABERTH) {
+        // w = N / (1 - N S), N = p/p', S = sum over j != i of 1 / (z_i - z_j)
+        polyNewtonRatio(s);
+        for (int i = 0; i < n; i++) {
+            s->sr[i] = 0;
+            s->si[i] = 0;
+        }
+        for (int j = 0; j < n; j++) {
+            double zr = s->re[j], zi = s->im[j];
+            if (!s->wide) {
+                for (int i = 0; i < n; i++) {
+                    // i == j adds 0 / 1 rather than 0 / 0, without a branch
+                    double ar = s->re[i] - zr, ai = s->im[i] - zi;
+                    double inv = 1 / (ar * ar + ai * ai + (i == j));
+                    s->sr[i] += ar * inv;
+                    s->si[i] -= ai * inv;
+                }
+            } else {
+                for (int i = 0; i < n; i++) {
+                    // The same with z_i - z_j first brought to [1, 2) by an
+                    // exact power of two, so that its square cannot overflow
+                    // or underflow; about a fifth slower, so only when needed
+                    double ar = s->re[i] - zr, ai = s->im[i] - zi;
+                    double k = polyUnitScale(fabs(ar) > fabs(ai) ? fabs(ar) : fabs(ai));
+                    ar *= k;
+                    ai *= k;
+                    double inv = k / (ar * ar + ai * ai + (i == j));
+                    s->sr[i] += ar * inv;
+                    s->si[i] -= ai * inv;
+                }
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            double br = 1 - (s->pr[i] * s->sr[i] - s->pi[i] * s->si[i]);
+            double bi = -(s->pr[i] * s->si[i] + s->pi[i] * s->sr[i]);
+            polyDivide(s->pr[i], s->pi[i], br, bi, &wr[i], &wi[i]);
+        }
+    } else {
+        // w = p(z_i) / (a_n prod over j != i of (z_i - z_j)); in the
+        // reflected lanes the z_i^(N-1) cancels, leaving
+        // w = z_i q(y_i) / (a_n prod over j != i of (1 - z_j y_i)).
+        // Either factor is a_i - z_j b_i, with (a, b) = (z, 1) or (1, y).
+        double ar[POLY_MAX_DEGREE], ai[POLY_MAX_DEGREE], br[POLY_MAX_DEGREE], bi[POLY_MAX_DEGREE];
+        polyEvaluate(s, 0);
+        for (int i = 0; i < n; i++) {
+            ar[i] = s->flip[i] ? 1 : s->re[i];
+            ai[i] = s->flip[i] ? 0 : s->im[i];
+            br[i] = s->flip[i] ? s->yr[i] : 1;
+            bi[i] = s->flip[i] ? s->yi[i] : 0;
+            s->sr[i] = s->coef[n];
+            s->si[i] = 0;
+        }
+        for (int j = 0; j < n; j++) {
+            double zr = s->re[j], zi = s->im[j];
+            for (int i = 0; i < n; i++) {
+                // The factor is 1 for i == j, blended in rather than branched on
+                double same = i == j;
+                double fr = (ar[i] - (zr * br[i] - zi * bi[i])) * (1 - same) + same;
+                double fi = (ai[i] - (zr * bi[i] + zi * br[i])) * (1 - same);
+                double r = s->sr[i] * fr - s->si[i] * fi;
+                s->si[i] = s->sr[i] * fi + s->si[i] * fr;
+                s->sr[i] = r;
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            // Numerator p, or z q in the reflected lanes
+            double nr = s->flip[i] ? s->pr[i] * s->re[i] - s->pi[i] * s->im[i] : s->pr[i];
+            double ni = s->flip[i] ? s->pr[i] * s->im[i] + s->pi[i] * s->re[i] : s->pi[i];
+            polyDivide(nr, ni, s->sr[i], s->si[i], &wr[i], &wi[i]);
+        }
+    }
+
+    // Jacobi update: every correction above used the old estimates. No
+    // root is frozen: a correction that is small while the other estimates
+    // are still wrong can grow again, so done is recomputed every time and
+    // only counts when it holds for all roots at once. A zero p(z) is an
+    // exact root even though Aberth's correction is not finite.
+    int moving = 0, settled = 0;
+    for (int i = 0; i < n; i++) {
+        int exact = s->backward[i] == 0;
+        int finite = isfinite(wr[i]) && isfinite(wi[i]);
+        int active = !exact && finite;
+        s->re[i] -= active ? wr[i] : 0;
+        s->im[i] -= active ? wi[i] : 0;
+        double w = hypot(wr[i], wi[i]);
+        double z = hypot(s->re[i], s->im[i]);
+        s->done[i] = exact || (finite && (w <= s->tolerance * z || w < DBL_MIN));
+        moving += !s->done[i];
+        settled += s->backward[i] <= POLY_ROUNDING * n * DBL_EPSILON;
+    }
+    s->iterations++;
+    s->converged = n - moving;
+    s->settled = settled;
+
+    // Past rounding level the corrections are noise and may never drop
+    // below tolerance; stop once that has held for POLY_SETTLE iterations
+    int paired = (moving == 0 || settled == n) && polyPaired(s);
+    s->settledFor = settled == n && paired ? s->settledFor + 1 : 0;
+    s->status = moving == 0 && paired ? POLY_CONVERGED
+              : s->settledFor >= POLY_SETTLE ? POLY_BACKWARD : POLY_RUNNING;
+    s->ns += (SDL_GetPerformanceCounter() - start) * 1000000000ULL / SDL_GetPerformanceFrequency();
+    return s->status == POLY_RUNNING;
+}
+
+// Iterate until the solve finishes or maxIter; POLY_RUNNING if it did not.
+static inline PolyStatus polySolve(PolySolver* s, int maxIter) {
+    while (s->iterations < maxIter && polyStep(s)) {
+    }
+    return s->status;
+}
+
+// Backward error of root i at its final estimate: the relative change in
+// the coefficients, |p(z)| / sum |a_k| |z|^k, that would make it exact.
+// Outside the unit circle it is taken from q(1/z), which does not overflow.
+static inline double polyBackwardError(const PolySolver* s, int i) {
+    int n = s->degree;
+    double zr = s->re[i], zi = s->im[i];
+    double m = hypot(zr, zi);
+    int flip = m > 1;
+    if (flip) {
+        zr = zr / m / m;
+        zi = -zi / m / m;
+        m = 1 / m;
+    }
+    double pr = 0, pi = 0, scale = 0;
+    for (int k = 0; k <= n; k++) {
+        double c = s->coef[flip ? k : n - k];
+        double r = pr * zr - pi * zi + c;
+        pi = pr * zi + pi * zr;
+        pr = r;
+        scale = scale * m + fabs(c);
+    }
+    return scale > 0 ? hypot(pr, pi) / scale : 0;
+}
+
+// The real roots of a polynomial given highest power first, ascending, by
+// polySolve at full tolerance: the quadratic programs' a, b, c are the
+// N = 2 case. A root counts as real by the same test polyPaired uses.
+// Returns how many were written to out (at most the degree), or -1 if the
+// degree is above POLY_MAX_DEGREE, the solve gave up, or a real root it
+// would return is not a root after all. The last is loose on purpose: a
+// double root still wanders at 1e-14 or so, while a root that p(x)
+// under- or overflowing let through is off by a backward error near 1.
+static inline int polyRealRoots(const double* highFirst, int count, double* out) {
+    PolySolver s;
+    int degree = polyInit(&s, highFirst, count, POLY_ABERTH, 1e-14);
+    if (degree <= 0) return degree;
+    if (polySolve(&s, POLY_MAX_ITER) == POLY_RUNNING) return -1;
+    int real = 0;
+    for (int i = 0; i < s.degree; i++) {
+        if (fabs(s.im[i]) > POLY_PAIRING * fmax(hypot(s.re[i], s.im[i]), s.radius)) continue;
+        if (polyBackwardError(&s, i) > POLY_RESIDUAL) return -1;
+        int k = real++;
+        for (; k > 0 && out[k - 1] > s.re[i]; k--) out[k] = out[k - 1];
+        out[k] = s.re[i];
+    }
+    return real;
+}
+
+#endif
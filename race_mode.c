@@ -0,0 +1,662 @@
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include "frame_hud.h"
+#include "trace_events.h"
+#include "iteration_table.h"
+#include "solve_worker.h"
+#include "app_host.h"
+#include "root_solvers.h"
+
+#define MAX_ITER 100
+#define TOLERANCE 0.0001
+#define WINDOW_WIDTH 1400
+#define WINDOW_HEIGHT 800
+#define RACE_ENTRANTS 8
+
+// Method race: every root finder for e^x - ax - b = 0 runs at the same
+// time on the worker pool, from the same starting data and tolerance, and
+// the results are compared side by side.
+
+typedef struct {
+    const char* name;
+    SolverMethod method;
+    int form;               // fixed point rearrangement
+    SDL_Color color;
+} RaceEntrant;
+
+static const RaceEntrant entrants[RACE_ENTRANTS] = {
+    {"Secant", SOLVER_SECANT, 1, {220, 50, 50, 255}},
+    {"Newton-Raphson", SOLVER_NEWTON, 1, {130, 40, 200, 255}},
+    {"False Position", SOLVER_FALSE_POSITION, 1, {230, 140, 0, 255}},
+    {"FP g1 = ln(ax + b)", SOLVER_FIXED_POINT, 1, {0, 140, 70, 255}},
+    {"FP g2 = (e^x - b) / a", SOLVER_FIXED_POINT, 2, {0, 120, 200, 255}},
+    {"FP g3 = ln((e^x - b) / a)", SOLVER_FIXED_POINT, 3, {200, 0, 140, 255}},
+    {"FP g4 = e^x/a - b/a", SOLVER_FIXED_POINT, 4, {110, 110, 40, 255}},
+    {"FP g5 = x - 0.1 f(x)", SOLVER_FIXED_POINT, 5, {40, 170, 170, 255}},
+};
+
+// One entrant's progress as streamed back from its job
+typedef struct {
+    SolveJob* job;
+    int status;             // SOLVE_* once submitted, -1 before the first race
+    double errors[MAX_ITER];   // the first MAX_ITER errors, for the plot
+    int errorCount;
+    int iterations;            // every row streamed, even past the plotted ones
+    double root;
+    int fEvals, dfEvals, gEvals;
+    double timeUs;
+    char outcome[40];
+} RaceLane;
+
+// What the tab shows, kept while the user is on other tabs (appHostTabState)
+typedef struct {
+    int saved;
+    char values[4][50];
+    RaceLane lanes[RACE_ENTRANTS];      // no job: a race still running is cancelled
+    char statusText[300];
+    int winner;
+} RaceState;
+
+// UI component structures
+typedef struct {
+    SDL_Rect rect;
+    char label[50];
+    char value[50];
+    int active;
+} InputBox;
+
+typedef struct {
+    SDL_Rect rect;
+    char text[50];
+    int hovered;
+    int clicked;
+} Button;
+
+// One entrant run on a worker thread
+// params: a, b, x0, x1; intParams: method, form; spec: stop rules; rows: error, current x
+// stats: f evals, f' evals, g evals, solver time (ns)
+static void raceJob(SolveJob* job) {
+    RootProblem problem = {PROBLEM_EXPONENTIAL, job->params[0], job->params[1], 0};
+    RootSolver solver;
+    solverInit(&solver, (SolverMethod)job->intParams[0], &problem, job->params[2], job->params[3],
+               TOLERANCE, MAX_ITER);
+    solver.form = job->intParams[1];
+    stopPolicyParse(&solver.stop, job->spec);
+    
+    SessionTrace trace;
+    sessionTraceBegin(&trace, job->session, &solver);
+    
+    SolverRow row;
+    int status = solver.status;
+    while (status == SOLVER_RUNNING) {
+        status = solverStep(&solver, &row);
+        sessionTraceAdd(&trace, &row);
+        if (row.count) {
+            double values[2] = {row.v[row.count - 1], solverCurrentX(&solver)};
+            if (!solveJobRow(job, row.n, values, 2)) {
+                sessionTraceFree(&trace);
+                solveJobFinish(job, SOLVE_CANCELLED, 0);
+                return;
+            }
+        }
+    }
+    sessionLogSolve(job->session, &solver, &trace);
+    
+    job->stats[0] = solver.cost.fEvals;
+    job->stats[1] = solver.cost.dfEvals;
+    job->stats[2] = solver.cost.gEvals;
+    job->stats[3] = (double)solver.cost.ns;
+    if (status == SOLVER_CONVERGED) {
+        sprintf(job->message, "Converged");
+    } else {
+        sprintf(job->message, "%s", solverFailureName(solver.failure));
+    }
+    solveJobFinish(job, status == SOLVER_CONVERGED ? SOLVE_CONVERGED : SOLVE_FAILED, solver.root);
+}
+
+// Converged lane with the fewest function evaluations, ties broken by time
+static int raceWinner(const RaceLane* lanes) {
+    int winner = -1;
+    for (int i = 0; i < RACE_ENTRANTS; i++) {
+        if (lanes[i].status != SOLVE_CONVERGED) continue;
+        if (winner < 0) {
+            winner = i;
+            continue;
+        }
+        int evals = lanes[i].fEvals + lanes[i].dfEvals + lanes[i].gEvals;
+        int best = lanes[winner].fEvals + lanes[winner].dfEvals + lanes[winner].gEvals;
+        if (evals < best || (evals == best && lanes[i].timeUs < lanes[winner].timeUs)) {
+            winner = i;
+        }
+    }
+    return winner;
+}
+
+// Rebuild the results table from the lanes
+static void raceFillTable(IterationTable* table, const RaceLane* lanes) {
+    tableClear(table);
+    for (int i = 0; i < RACE_ENTRANTS; i++) {
+        const RaceLane* lane = &lanes[i];
+        int row = tableAppendRow(table);
+        tableSetCell(table, row, 0, "%s", entrants[i].name);
+        if (lane->status < 0) continue;
+        
+        tableSetCell(table, row, 1, "%s", lane->outcome);
+        tableSetCell(table, row, 2, "%d", lane->iterations);
+        if (lane->status == SOLVE_RUNNING || lane->status == SOLVE_CANCELLED) continue;
+        
+        tableSetCell(table, row, 3, "%d", lane->fEvals);
+        tableSetCell(table, row, 4, "%d", lane->dfEvals);
+        tableSetCell(table, row, 5, "%d", lane->gEvals);
+        tableSetCell(table, row, 6, "%.1f", lane->timeUs);
+        if (lane->status == SOLVE_CONVERGED) {
+            tableSetCell(table, row, 7, "%.6f", lane->root);
+        }
+    }
+}
+
+// Render text with UTF-8 support
+// (the draw list frees the texture once the frame is submitted)
+static void renderText(DrawList* draw, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, color);
+    if (!surface) return;
+    
+    SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+    SDL_Rect rect = {x, y, surface->w, surface->h};
+    drawListTexture(draw, texture, NULL, &rect, 1);
+    
+    SDL_FreeSurface(surface);
+}
+
+// Render input box with label and value
+static void renderInputBox(DrawList* draw, TTF_Font* font, InputBox* box) {
+    SDL_Color fill;
+    if (box->active) {
+        fill = (SDL_Color){220, 232, 250, 255};
+    } else {
+        fill = (SDL_Color){240, 245, 252, 255};
+    }
+    drawListFillRect(draw, &box->rect, fill);
+    
+    drawListRect(draw, &box->rect, (SDL_Color){50, 90, 150, 255});
+    
+    renderText(draw, font, box->label, box->rect.x - 80, box->rect.y + 5, (SDL_Color){30, 60, 110, 255});
+    if (strlen(box->value) > 0) {
+        renderText(draw, font, box->value, box->rect.x + 5, box->rect.y + 5, (SDL_Color){20, 40, 80, 255});
+    }
+}
+
+// Render button with hover and click effects
+static void renderButton(DrawList* draw, TTF_Font* font, Button* btn) {
+    SDL_Color fill;
+    if (btn->clicked) {
+        fill = (SDL_Color){20, 50, 100, 255};
+    } else if (btn->hovered) {
+        fill = (SDL_Color){60, 100, 170, 255};
+    } else {
+        fill = (SDL_Color){40, 80, 140, 255};
+    }
+    drawListFillRect(draw, &btn->rect, fill);
+    
+    drawListRect(draw, &btn->rect, (SDL_Color){20, 40, 80, 255});
+    
+    SDL_Surface* surface = TTF_RenderText_Blended(font, btn->text, (SDL_Color){255, 255, 255, 255});
+    if (surface) {
+        int textX = btn->rect.x + (btn->rect.w - surface->w) / 2;
+        int textY = btn->rect.y + (btn->rect.h - surface->h) / 2;
+        SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+        SDL_Rect textRect = {textX, textY, surface->w, surface->h};
+        drawListTexture(draw, texture, NULL, &textRect, 1);
+        SDL_FreeSurface(surface);
+    }
+}
+
+// log10(error) against iteration for every lane
+static void drawConvergence(DrawList* draw, TTF_Font* fontSmall, const RaceLane* lanes, int winner,
+                            SDL_Rect area) {
+    drawListFillRect(draw, &area, (SDL_Color){255, 255, 255, 255});
+    
+    // Axis ranges from the data: whole decades, at least 5 iterations wide
+    int maxN = 5;
+    double logMin = -5, logMax = 1;
+    for (int i = 0; i < RACE_ENTRANTS; i++) {
+        if (lanes[i].errorCount > maxN) maxN = lanes[i].errorCount;
+        for (int k = 0; k < lanes[i].errorCount; k++) {
+            double e = lanes[i].errors[k];
+            if (!isfinite(e)) continue;
+            double l = log10(e > 1e-16 ? e : 1e-16);
+            if (l < logMin) logMin = l;
+            if (l > logMax) logMax = l;
+        }
+    }
+    logMin = floor(logMin);
+    logMax = ceil(logMax);
+    if (logMax > 10) logMax = 10;
+    
+    int left = area.x + 50, right = area.x + area.w - 15;
+    int top = area.y + 15, bottom = area.y + area.h - 30;
+    
+    // Decade grid and labels
+    int decadeStep = (int)ceil((logMax - logMin) / 8);
+    if (decadeStep < 1) decadeStep = 1;
+    for (int d = (int)logMin; d <= (int)logMax; d += decadeStep) {
+        int y = bottom - (int)((d - logMin) / (logMax - logMin) * (bottom - top));
+        drawListLine(draw, left, y, right, y, (SDL_Color){225, 230, 240, 255});
+        char label[16];
+        sprintf(label, "1e%d", d);
+        renderText(draw, fontSmall, label, area.x + 6, y - 8, (SDL_Color){90, 100, 120, 255});
+    }
+    int iterStep = maxN > 20 ? 10 : (maxN > 10 ? 2 : 1);
+    for (int n = 0; n <= maxN; n += iterStep) {
+        int x = left + (int)((double)n / maxN * (right - left));
+        char label[16];
+        sprintf(label, "%d", n);
+        renderText(draw, fontSmall, label, x - 4, bottom + 6, (SDL_Color){90, 100, 120, 255});
+    }
+    
+    SDL_Color axisColor = {60, 70, 90, 255};
+    drawListLine(draw, left, top, left, bottom, axisColor);
+    drawListLine(draw, left, bottom, right, bottom, axisColor);
+    
+    // Curves; the winner is drawn last and thicker
+    SDL_Rect plot = {left, top, right - left + 1, bottom - top + 1};
+    drawListFlush(draw);
+    SDL_RenderSetClipRect(draw->renderer, &plot);
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < RACE_ENTRANTS; i++) {
+            if ((i == winner) != (pass == 1)) continue;
+            const RaceLane* lane = &lanes[i];
+            
+            SDL_Point points[MAX_ITER];
+            int count = 0;
+            for (int k = 0; k < lane->errorCount; k++) {
+                double e = lane->errors[k];
+                if (!isfinite(e)) break;
+                double l = log10(e > 1e-16 ? e : 1e-16);
+                if (l > logMax) l = logMax;
+                points[count].x = left + (int)((double)(k + 1) / maxN * (right - left));
+                points[count].y = bottom - (int)((l - logMin) / (logMax - logMin) * (bottom - top));
+                count++;
+            }
+            if (count == 0) continue;
+            
+            SDL_Color c = entrants[i].color;
+            c.a = 255;
+            int thickness = i == winner ? 3 : 1;
+            for (int k = 0; k < count; k++) {
+                for (int t = 0; k > 0 && t < thickness; t++) {
+                    drawListLine(draw, points[k - 1].x, points[k - 1].y + t, points[k].x, points[k].y + t, c);
+                }
+                SDL_Rect dot = {points[k].x - 2, points[k].y - 2, 5, 4 + thickness};
+                drawListFillRect(draw, &dot, c);
+            }
+        }
+    }
+    drawListFlush(draw);
+    SDL_RenderSetClipRect(draw->renderer, NULL);
+    
+    drawListRect(draw, &area, (SDL_Color){50, 90, 150, 255});
+}
+
+int raceRun(AppHost* host) {
+    SDL_Renderer* renderer = host->renderer;
+    DrawList* draw = &host->draw;
+    
+    // Load fonts
+    TTF_Font* font = appHostFont(host, 18);
+    TTF_Font* fontSmall = appHostFont(host, 14);
+    TTF_Font* fontMedium = appHostFont(host, 16);
+    TTF_Font* fontTitle = appHostFont(host, 24);
+    
+    RaceState* saved = appHostTabState(host, sizeof(RaceState), NULL);
+    if (!font || !fontSmall || !fontMedium || !fontTitle || !saved) {
+        return 1;
+    }
+    
+    // Initialize input boxes (a, b, x0, x1)
+    InputBox inputs[4];
+    const char* labels[] = {"a:", "b:", "x0:", "x1:"};
+    for (int i = 0; i < 4; i++) {
+        inputs[i].rect = (SDL_Rect){110, 130 + i * 55, 150, 35};
+        strcpy(inputs[i].label, labels[i]);
+        strcpy(inputs[i].value, saved->saved ? saved->values[i] : "");
+        inputs[i].active = 0;
+    }
+    
+    // Inputs handed over by another tab, e.g. a cell picked in the sweep
+    for (int i = 0; i < 4; i++) {
+        appHostPreset(host, i, inputs[i].value, sizeof(inputs[i].value));
+    }
+    
+    Button raceBtn = {{30, 360, 120, 40}, "RACE", 0, 0};
+    Button clearBtn = {{170, 360, 120, 40}, "CLEAR", 0, 0};
+    
+    // Results table, one row per entrant, rebuilt whenever a lane finishes
+    const int tableColumns[] = {8, 230, 350, 410, 470, 530, 600, 700};
+    IterationTable table;
+    tableInit(&table, fontSmall, 960, 30, 6, 8, tableColumns, (SDL_Color){20, 30, 50, 255},
+              (SDL_Color){248, 250, 255, 255}, (SDL_Color){236, 241, 250, 255});
+    
+    RaceLane lanes[RACE_ENTRANTS];
+    memset(lanes, 0, sizeof(lanes));
+    for (int i = 0; i < RACE_ENTRANTS; i++) lanes[i].status = -1;
+    
+    char statusText[300] = "Enter a, b and the starting guesses, then press RACE.";
+    int running = 0;
+    int winner = -1;
+    
+    // Back on this tab: show the last race as the user left it
+    if (saved->saved) {
+        memcpy(lanes, saved->lanes, sizeof(lanes));
+        strcpy(statusText, saved->statusText);
+        winner = saved->winner;
+    }
+    raceFillTable(&table, lanes);
+    int activeInput = -1;
+    int quit = 0;
+    
+    // Entrants run on the host's worker pool and stream their errors back,
+    // all with this tab's stop rules (F6)
+    SolveWorkerPool* pool = &host->pool;
+    appHostUseStopRules(host);
+    
+    // Frame timing overlay, toggled with F3
+    FrameHud hud;
+    hudInit(&hud);
+    SDL_Event e;
+    
+    while (!quit && !appHostSwitching(host)) {
+        hudBeginFrame(&hud);
+        
+        while (appHostPollEvent(host, &e)) {
+            if (appHostEvent(host, &e)) continue;
+            if (e.type == SDL_QUIT) quit = 1;
+            
+            if (e.type == SDL_MOUSEBUTTONDOWN) {
+                int mx = e.button.x;
+                int my = e.button.y;
+                
+                activeInput = -1;
+                for (int i = 0; i < 4; i++) {
+                    if (mx >= inputs[i].rect.x && mx <= inputs[i].rect.x + inputs[i].rect.w &&
+                        my >= inputs[i].rect.y && my <= inputs[i].rect.y + inputs[i].rect.h) {
+                        activeInput = i;
+                    }
+                    inputs[i].active = (i == activeInput);
+                }
+                
+                int onRace = mx >= raceBtn.rect.x && mx <= raceBtn.rect.x + raceBtn.rect.w &&
+                             my >= raceBtn.rect.y && my <= raceBtn.rect.y + raceBtn.rect.h;
+                int onClear = mx >= clearBtn.rect.x && mx <= clearBtn.rect.x + clearBtn.rect.w &&
+                              my >= clearBtn.rect.y && my <= clearBtn.rect.y + clearBtn.rect.h;
+                
+                // Starting a race, cancelling one (RACE reads CANCEL) and
+                // clearing all drop the lanes still running
+                if (onRace || onClear) {
+                    for (int i = 0; i < RACE_ENTRANTS; i++) {
+                        if (lanes[i].job) {
+                            solveJobCancel(lanes[i].job);
+                            solveJobRelease(lanes[i].job);
+                            lanes[i].job = NULL;
+                            lanes[i].status = SOLVE_CANCELLED;
+                            strcpy(lanes[i].outcome, "Cancelled");
+                        }
+                    }
+                    winner = -1;
+                    strcpy(raceBtn.text, "RACE");
+                }
+                
+                if (onRace) {
+                    raceBtn.clicked = 1;
+                    if (running) {
+                        running = 0;
+                        strcpy(statusText, "Race cancelled.");
+                    } else {
+                        double a = atof(inputs[0].value);
+                        double b = atof(inputs[1].value);
+                        double x0 = atof(inputs[2].value);
+                        double x1 = atof(inputs[3].value);
+                        
+                        for (int i = 0; i < RACE_ENTRANTS; i++) {
+                            RaceLane* lane = &lanes[i];
+                            memset(lane, 0, sizeof(*lane));
+                            lane->status = SOLVE_RUNNING;
+                            strcpy(lane->outcome, "Running");
+                            
+                            lane->job = solveJobCreate(raceJob);
+                            if (!lane->job) {
+                                lane->status = SOLVE_FAILED;
+                                strcpy(lane->outcome, "No memory");
+                                continue;
+                            }
+                            lane->job->params[0] = a;
+                            lane->job->params[1] = b;
+                            lane->job->params[2] = x0;
+                            lane->job->params[3] = x1;
+                            lane->job->intParams[0] = entrants[i].method;
+                            lane->job->intParams[1] = entrants[i].form;
+                            snprintf(lane->job->spec, sizeof(lane->job->spec), "%s", appHostStopSpec(host));
+                            lane->job->session = &host->session;
+                            solvePoolSubmit(pool, lane->job);
+                        }
+                        running = 1;
+                        strcpy(raceBtn.text, "CANCEL");
+                        strcpy(statusText, "Racing...");
+                    }
+                    raceFillTable(&table, lanes);
+                }
+                
+                if (onClear) {
+                    clearBtn.clicked = 1;
+                    running = 0;
+                    for (int i = 0; i < 4; i++) strcpy(inputs[i].value, "");
+                    memset(lanes, 0, sizeof(lanes));
+                    for (int i = 0; i < RACE_ENTRANTS; i++) lanes[i].status = -1;
+                    raceFillTable(&table, lanes);
+                    strcpy(statusText, "Enter a, b and the starting guesses, then press RACE.");
+                }
+            }
+            
+            if (e.type == SDL_MOUSEBUTTONUP) {
+                raceBtn.clicked = 0;
+                clearBtn.clicked = 0;
+            }
+            
+            if (e.type == SDL_MOUSEMOTION) {
+                int mx = e.motion.x;
+                int my = e.motion.y;
+                raceBtn.hovered = (mx >= raceBtn.rect.x && mx <= raceBtn.rect.x + raceBtn.rect.w &&
+                                   my >= raceBtn.rect.y && my <= raceBtn.rect.y + raceBtn.rect.h);
+                clearBtn.hovered = (mx >= clearBtn.rect.x && mx <= clearBtn.rect.x + clearBtn.rect.w &&
+                                    my >= clearBtn.rect.y && my <= clearBtn.rect.y + clearBtn.rect.h);
+            }
+            
+            if (e.type == SDL_TEXTINPUT && activeInput >= 0) {
+                char c = e.text.text[0];
+                if ((c >= '0' && c <= '9') || c == '.' || c == '-') {
+                    int len = strlen(inputs[activeInput].value);
+                    if (len < 19) {
+                        inputs[activeInput].value[len] = c;
+                        inputs[activeInput].value[len + 1] = '\0';
+                    }
+                }
+            }
+            
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F3) {
+                hudToggle(&hud);
+            }
+            
+            if (e.type == SDL_KEYDOWN && activeInput >= 0 && e.key.keysym.sym == SDLK_BACKSPACE) {
+                int len = strlen(inputs[activeInput].value);
+                if (len > 0) inputs[activeInput].value[len - 1] = '\0';
+            }
+        }
+        
+        hudPhase(&hud, HUD_SOLVE);
+        
+        // Drain every lane; the table only changes when one finishes
+        if (running) {
+            int changed = 0;
+            int stillRunning = 0;
+            for (int i = 0; i < RACE_ENTRANTS; i++) {
+                RaceLane* lane = &lanes[i];
+                SolveMessage msg;
+                int budget = SOLVE_DRAIN_BUDGET;
+                while (lane->job && budget-- > 0 && solveJobPop(lane->job, &msg)) {
+                    if (msg.type == SOLVE_MSG_ROW) {
+                        if (lane->errorCount < MAX_ITER) lane->errors[lane->errorCount++] = msg.v[0];
+                        lane->iterations++;
+                    } else if (msg.type == SOLVE_MSG_DONE) {
+                        SolveJob* job = lane->job;
+                        lane->status = job->status;
+                        lane->root = job->root;
+                        lane->fEvals = (int)job->stats[0];
+                        lane->dfEvals = (int)job->stats[1];
+                        lane->gEvals = (int)job->stats[2];
+                        lane->timeUs = job->stats[3] / 1000.0;
+                        snprintf(lane->outcome, sizeof(lane->outcome), "%.39s", job->message);
+                        solveJobRelease(job);
+                        lane->job = NULL;
+                        changed = 1;
+                    }
+                }
+                if (lane->job) stillRunning = 1;
+            }
+            
+            if (changed) raceFillTable(&table, lanes);
+            if (!stillRunning) {
+                running = 0;
+                strcpy(raceBtn.text, "RACE");
+                winner = raceWinner(lanes);
+                if (winner >= 0) {
+                    const RaceLane* w = &lanes[winner];
+                    sprintf(statusText, "WINNER: %s\n%d evaluations, %d iterations, %.1f us\nRoot: x = %.6f",
+                            entrants[winner].name, w->fEvals + w->dfEvals + w->gEvals, w->iterations,
+                            w->timeUs, w->root);
+                } else {
+                    strcpy(statusText, "No method converged.\nTry other starting guesses.");
+                }
+            }
+        }
+        
+        // ==================== RENDER ====================
+        hudPhase(&hud, HUD_TEXT);
+        SDL_SetRenderDrawColor(renderer, 240, 244, 250, 255);
+        hudRenderClear(renderer);
+        
+        SDL_Rect banner = {0, 0, WINDOW_WIDTH, 70};
+        drawListFillRect(draw, &banner, (SDL_Color){30, 60, 110, 255});
+        renderText(draw, fontTitle, "METHOD RACE", 30, 10, (SDL_Color){255, 255, 255, 255});
+        renderText(draw, fontMedium, "Every root finder on e^x - ax - b = 0, same start, same tolerance (0.0001)",
+                   30, 42, (SDL_Color){200, 220, 255, 255});
+        
+        SDL_Color sectionColor = {30, 60, 110, 255};
+        SDL_Color hintColor = {90, 100, 120, 255};
+        
+        renderText(draw, font, "INPUT", 30, 95, sectionColor);
+        for (int i = 0; i < 4; i++) {
+            renderInputBox(draw, font, &inputs[i]);
+        }
+        renderButton(draw, font, &raceBtn);
+        renderButton(draw, font, &clearBtn);
+        renderText(draw, fontSmall, "x1 is the second guess of secant and false", 30, 415, hintColor);
+        renderText(draw, fontSmall, "position; the others start from x0.", 30, 435, hintColor);
+        renderText(draw, fontSmall, "Winner: fewest evaluations, then time.", 30, 455, hintColor);
+        
+        renderText(draw, font, "RESULT", 30, 500, sectionColor);
+        char statusCopy[300];
+        strcpy(statusCopy, statusText);
+        char* line = strtok(statusCopy, "\n");
+        int sy = 530;
+        while (line) {
+            SDL_Color color = winner >= 0 ? (SDL_Color){0, 110, 40, 255} : (SDL_Color){60, 60, 80, 255};
+            renderText(draw, fontSmall, line, 30, sy, color);
+            sy += 20;
+            line = strtok(NULL, "\n");
+        }
+        
+        // Results table with a color key per entrant
+        int tableX = 410, tableY = 90;
+        SDL_Rect header = {tableX, tableY, 960, 30};
+        drawListFillRect(draw, &header, (SDL_Color){40, 80, 140, 255});
+        const char* headings[] = {"Method", "Status", "Iter", "f", "f'", "g", "Time (us)", "Root"};
+        for (int c = 0; c < 8; c++) {
+            renderText(draw, fontSmall, headings[c], tableX + tableColumns[c], tableY + 6, (SDL_Color){255, 255, 255, 255});
+        }
+        drawListFlush(draw);
+        tableRender(renderer, &table, tableX, tableY + 30, 0, RACE_ENTRANTS);
+        
+        for (int i = 0; i < RACE_ENTRANTS; i++) {
+            SDL_Color c = entrants[i].color;
+            SDL_Rect key = {tableX - 22, tableY + 30 + i * 30 + 8, 14, 14};
+            drawListFillRect(draw, &key, (SDL_Color){c.r, c.g, c.b, 255});
+        }
+        if (winner >= 0) {
+            for (int t = 0; t < 3; t++) {
+                SDL_Rect outline = {tableX - t, tableY + 30 + winner * 30 - t, 960 + 2 * t, 30 + 2 * t};
+                drawListRect(draw, &outline, (SDL_Color){230, 170, 0, 255});
+            }
+            renderText(draw, fontSmall, "WINNER", tableX + 880, tableY + 30 + winner * 30 + 6,
+                       (SDL_Color){200, 130, 0, 255});
+        }
+        
+        hudPhase(&hud, HUD_GRAPH);
+        renderText(draw, font, "CONVERGENCE  (error per iteration, log scale)", tableX, 365, sectionColor);
+        TRACE_SCOPE("drawConvergence") {
+            drawConvergence(draw, fontSmall, lanes, winner, (SDL_Rect){tableX - 30, 395, 990, 385});
+        }
+        hudPhase(&hud, HUD_TEXT);
+        
+        appHostRenderTabs(host);
+        hudRender(renderer, fontSmall, &hud, WINDOW_WIDTH - 270, 10);
+        
+        hudPhase(&hud, HUD_PRESENT);
+        TRACE_SCOPE("SDL_RenderPresent") {
+            SDL_RenderPresent(renderer);
+        }
+        hudPhase(&hud, HUD_IDLE);
+        appHostEndFrame(host);
+    }
+    
+    // A race still running is cancelled; the lanes and inputs are kept for
+    // the next visit
+    for (int i = 0; i < RACE_ENTRANTS; i++) {
+        if (lanes[i].job) {
+            solveJobCancel(lanes[i].job);
+            solveJobRelease(lanes[i].job);
+            lanes[i].job = NULL;
+            lanes[i].status = SOLVE_CANCELLED;
+            strcpy(lanes[i].outcome, "Cancelled");
+        }
+    }
+    if (running) strcpy(statusText, "Race cancelled.");
+    tableFree(&table);
+    
+    for (int i = 0; i < 4; i++) {
+        strcpy(saved->values[i], inputs[i].value);
+    }
+    memcpy(saved->lanes, lanes, sizeof(lanes));
+    strcpy(saved->statusText, statusText);
+    saved->winner = winner;
+    saved->saved = 1;
+    
+    return 0;
+}
+
+#ifndef METHODS_SUITE
+int main(int argc, char* argv[]) {
+    AppHost host;
+    if (appHostInit(&host, "Method Race - Exponential", WINDOW_WIDTH, WINDOW_HEIGHT, NULL, 0) != 0) {
+        return 1;
+    }
+    
+    int result = raceRun(&host);
+    
+    appHostFree(&host);
+    return result;
+}
+#endif
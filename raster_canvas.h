@@ -0,0 +1,296 @@
+#ifndef RASTER_CANVAS_H
+#define RASTER_CANVAS_H
+
+#include <SDL.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "frame_hud.h"
+
+#define CANVAS_MAX_KEY 512
+
+// Graph content rasterized on the CPU and shown as one texture copy.
+// Shapes are drawn into an ARGB buffer with antialiasing from exact
+// coverage: each row of a shape is one interval, the pixels well inside it
+// are filled as a plain span and only the one or two pixels at each end
+// are blended. The caller redraws only when its key (the values the picture
+// depends on) changes, and only the rows that changed are uploaded to the
+// streaming texture. Pixels hold straight alpha to match
+// SDL_BLENDMODE_BLEND, which every renderer supports.
+
+typedef struct {
+    int w, h;
+    Uint32* pixels;
+    SDL_Texture* texture;
+    unsigned char key[CANVAS_MAX_KEY];
+    size_t keySize;
+    int valid;                  // pixels match key
+    Uint32 background;          // color of everything outside used
+    SDL_Rect used;              // drawn since the last clear
+    SDL_Rect damage;            // changed since the last upload
+} RasterCanvas;
+
+static inline int canvasInit(RasterCanvas* c, SDL_Renderer* renderer, int w, int h) {
+    memset(c, 0, sizeof(*c));
+    c->w = w;
+    c->h = h;
+    c->pixels = calloc((size_t)w * h, sizeof(Uint32));
+    c->texture = hudCreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, w, h);
+    c->damage = (SDL_Rect){0, 0, w, h};
+    return c->pixels && c->texture;
+}
+
+static inline void canvasFree(RasterCanvas* c) {
+    if (c->texture) SDL_DestroyTexture(c->texture);
+    free(c->pixels);
+    c->texture = NULL;
+    c->pixels = NULL;
+}
+
+// 1 if the picture for this key has to be drawn; the key is then kept.
+// Keys are compared bytewise, so build them from arrays of doubles or
+// zeroed structs. Never 1 on a canvas whose init failed.
+static inline int canvasBegin(RasterCanvas* c, const void* key, size_t size) {
+    if (!c->pixels) return 0;
+    if (size > CANVAS_MAX_KEY) return 1;
+    if (c->valid && c->keySize == size && memcmp(c->key, key, size) == 0) return 0;
+    memcpy(c->key, key, size);
+    c->keySize = size;
+    c->valid = 1;
+    return 1;
+}
+
+// Force a redraw on the next canvasBegin
+static inline void canvasInvalidate(RasterCanvas* c) {
+    c->valid = 0;
+}
+
+static inline void canvasTouch(RasterCanvas* c, int x0, int y0, int x1, int y1) {
+    SDL_Rect r = {x0, y0, x1 - x0, y1 - y0};
+    SDL_Rect all = {0, 0, c->w, c->h};
+    if (!SDL_IntersectRect(&r, &all, &r)) return;
+    SDL_UnionRect(&c->used, &r, &c->used);
+    SDL_UnionRect(&c->damage, &r, &c->damage);
+}
+
+static inline void canvasFill(Uint32* p, int n, Uint32 color) {
+    for (int i = 0; i < n; i++) p[i] = color;
+}
+
+// color over dst at the given coverage, straight alpha
+static inline Uint32 canvasBlend(Uint32 dst, Uint32 color, float coverage) {
+    float sa = (color >> 24) * coverage * (1.0f / 255);
+    float da = (dst >> 24) * (1.0f / 255);
+    float keep = da * (1 - sa);
+    float oa = sa + keep;
+    float inv = oa > 0 ? 1 / oa : 0;
+    Uint32 out = (Uint32)(oa * 255 + 0.5f) << 24;
+    for (int shift = 0; shift < 24; shift += 8) {
+        float s = (color >> shift) & 0xFF, d = (dst >> shift) & 0xFF;
+        out |= (Uint32)((s * sa + d * keep) * inv + 0.5f) << shift;
+    }
+    return out;
+}
+
+// Full-coverage run of row y from x0 to x1 (exclusive), clipped
+static inline void canvasSpan(RasterCanvas* c, int y, int x0, int x1, Uint32 color) {
+    if (y < 0 || y >= c->h) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 > c->w) x1 = c->w;
+    if (x0 >= x1) return;
+    Uint32* p = c->pixels + (size_t)y * c->w;
+    if (color >> 24 == 0xFF) {
+        canvasFill(p + x0, x1 - x0, color);
+    } else {
+        for (int x = x0; x < x1; x++) p[x] = canvasBlend(p[x], color, 1);
+    }
+}
+
+static inline void canvasPlot(RasterCanvas* c, int x, int y, Uint32 color, float coverage) {
+    if (x < 0 || x >= c->w || y < 0 || y >= c->h || !(coverage > 0)) return;
+    Uint32* p = c->pixels + (size_t)y * c->w + x;
+    *p = canvasBlend(*p, color, coverage > 1 ? 1 : coverage);
+}
+
+// Fill the canvas with color. Only what was drawn since the last clear is
+// touched when the color has not changed.
+static inline void canvasClear(RasterCanvas* c, Uint32 color) {
+    SDL_Rect r = color == c->background ? c->used : (SDL_Rect){0, 0, c->w, c->h};
+    for (int y = r.y; y < r.y + r.h; y++) {
+        canvasFill(c->pixels + (size_t)y * c->w + r.x, r.w, color);
+    }
+    SDL_UnionRect(&c->damage, &r, &c->damage);
+    c->background = color;
+    c->used = (SDL_Rect){0, 0, 0, 0};
+}
+
+static inline void canvasFillRect(RasterCanvas* c, int x, int y, int w, int h, Uint32 color) {
+    canvasTouch(c, x, y, x + w, y + h);
+    for (int row = y; row < y + h; row++) canvasSpan(c, row, x, x + w, color);
+}
+
+// Extend [lo, hi] by where the row at height py is within r of (cx, cy)
+static inline void canvasRowDisc(double cx, double cy, double r, double py, double* lo, double* hi) {
+    double dy = py - cy;
+    if (r <= 0 || fabs(dy) > r) return;
+    double half = sqrt(r * r - dy * dy);
+    if (cx - half < *lo) *lo = cx - half;
+    if (cx + half > *hi) *hi = cx + half;
+}
+
+// Extend [lo, hi] by where the row at height py is within r of the body
+// of the segment from (ax, ay) along unit (ux, uy) for length len
+static inline void canvasRowBody(double ax, double ay, double ux, double uy, double len, double r,
+                                 double py, double* lo, double* hi) {
+    double dy = py - ay;
+    double a = -INFINITY, b = INFINITY;
+
+    // Within r across the segment: |dx * uy - dy * ux| <= r
+    if (uy != 0) {
+        double p = (dy * ux - r) / uy, q = (dy * ux + r) / uy;
+        a = fmax(a, fmin(p, q));
+        b = fmin(b, fmax(p, q));
+    } else if (fabs(dy) > r) {
+        return;
+    }
+    // Between the ends: 0 <= dx * ux + dy * uy <= len
+    if (ux != 0) {
+        double p = -dy * uy / ux, q = (len - dy * uy) / ux;
+        a = fmax(a, fmin(p, q));
+        b = fmin(b, fmax(p, q));
+    } else if (dy * uy < 0 || dy * uy > len) {
+        return;
+    }
+    if (a > b) return;
+    if (ax + a < *lo) *lo = ax + a;
+    if (ax + b > *hi) *hi = ax + b;
+}
+
+// The x extent of the row at height py within r of the segment; 0 if none
+static inline int canvasCapsuleRow(double ax, double ay, double bx, double by, double r, double py,
+                                   double* lo, double* hi) {
+    *lo = INFINITY;
+    *hi = -INFINITY;
+    double len = hypot(bx - ax, by - ay);
+    canvasRowDisc(ax, ay, r, py, lo, hi);
+    canvasRowDisc(bx, by, r, py, lo, hi);
+    if (len > 0) canvasRowBody(ax, ay, (bx - ax) / len, (by - ay) / len, len, r, py, lo, hi);
+    return *lo <= *hi;
+}
+
+static inline double canvasSegmentDistance(double ax, double ay, double bx, double by, double px, double py) {
+    double dx = bx - ax, dy = by - ay;
+    double len2 = dx * dx + dy * dy;
+    double t = len2 > 0 ? ((px - ax) * dx + (py - ay) * dy) / len2 : 0;
+    t = t < 0 ? 0 : t > 1 ? 1 : t;
+    return hypot(px - ax - t * dx, py - ay - t * dy);
+}
+
+// Antialiased stroke of the given width with round ends. Coordinates are
+// in pixels, (0, 0) being the top-left corner of the first pixel.
+static inline void canvasLine(RasterCanvas* c, double ax, double ay, double bx, double by,
+                              double width, Uint32 color) {
+    double r = 0.5 * width;
+    double reach = r + 0.5;             // coverage falls to 0 half a pixel out
+    if (!isfinite(ax) || !isfinite(ay) || !isfinite(bx) || !isfinite(by)) return;
+
+    // Clip to the canvas grown by reach first, so far off-canvas ends are
+    // cheap; nothing past the cut is close enough to cover a pixel
+    double t0 = 0, t1 = 1;
+    double dx = bx - ax, dy = by - ay;
+    double p[4] = {-dx, dx, -dy, dy};
+    double q[4] = {ax + reach, c->w + reach - ax, ay + reach, c->h + reach - ay};
+    for (int i = 0; i < 4; i++) {
+        if (p[i] == 0) {
+            if (q[i] < 0) return;
+        } else {
+            double t = q[i] / p[i];
+            if (p[i] < 0) { if (t > t1) return; if (t > t0) t0 = t; }
+            else          { if (t < t0) return; if (t < t1) t1 = t; }
+        }
+    }
+    bx = ax + t1 * dx;
+    by = ay + t1 * dy;
+    ax += t0 * dx;
+    ay += t0 * dy;
+
+    int y0 = (int)fmax(floor(fmin(ay, by) - reach), 0);
+    int y1 = (int)fmin(ceil(fmax(ay, by) + reach), c->h);
+
+    for (int y = y0; y < y1; y++) {
+        double py = y + 0.5;
+        double lo, hi;
+        if (!canvasCapsuleRow(ax, ay, bx, by, reach, py, &lo, &hi)) continue;
+        int x0 = (int)fmax(floor(lo - 0.5), 0);
+        int x1 = (int)fmin(ceil(hi - 0.5) + 1, c->w);
+        if (x0 >= x1) continue;
+        canvasTouch(c, x0, y, x1, y + 1);
+
+        // Pixels whose centres are half a pixel inside the stroke are full
+        int in0 = x1, in1 = x1;
+        double ilo, ihi;
+        if (r > 0.5 && canvasCapsuleRow(ax, ay, bx, by, r - 0.5, py, &ilo, &ihi)) {
+            in0 = (int)fmax(ceil(ilo - 0.5), x0);
+            in1 = (int)fmin(floor(ihi - 0.5) + 1, x1);
+            if (in0 > in1) in0 = in1 = x1;
+        }
+
+        for (int x = x0; x < x1; x++) {
+            if (x == in0 && in0 < in1) {
+                canvasSpan(c, y, in0, in1, color);
+                x = in1 - 1;
+                continue;
+            }
+            double d = canvasSegmentDistance(ax, ay, bx, by, x + 0.5, py);
+            canvasPlot(c, x, y, color, (float)(reach - d));
+        }
+    }
+}
+
+static inline void canvasDisc(RasterCanvas* c, double cx, double cy, double radius, Uint32 color) {
+    canvasLine(c, cx, cy, cx, cy, 2 * radius, color);
+}
+
+// Antialiased annulus between the two radii
+static inline void canvasRing(RasterCanvas* c, double cx, double cy, double inner, double outer, Uint32 color) {
+    if (!isfinite(cx) || !isfinite(cy)) return;
+    int x0 = (int)fmax(floor(cx - outer - 0.5), 0), x1 = (int)fmin(ceil(cx + outer + 0.5), c->w);
+    int y0 = (int)fmax(floor(cy - outer - 0.5), 0), y1 = (int)fmin(ceil(cy + outer + 0.5), c->h);
+    canvasTouch(c, x0, y0, x1, y1);
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            double d = hypot(x + 0.5 - cx, y + 0.5 - cy);
+            canvasPlot(c, x, y, color, (float)fmin(outer + 0.5 - d, d - inner + 0.5));
+        }
+    }
+}
+
+// Upload what changed and copy the canvas with its top-left at (x, y).
+// A transparent background is skipped: only the drawn area is copied.
+static inline void canvasRender(SDL_Renderer* renderer, RasterCanvas* c, int x, int y) {
+    if (!c->pixels || !c->texture) return;
+    SDL_Rect all = {0, 0, c->w, c->h};
+    SDL_IntersectRect(&c->damage, &all, &c->damage);
+    if (!SDL_RectEmpty(&c->damage)) {
+        void* pixels;
+        int pitch;
+        if (SDL_LockTexture(c->texture, &c->damage, &pixels, &pitch) == 0) {
+            for (int row = 0; row < c->damage.h; row++) {
+                memcpy((Uint8*)pixels + (size_t)row * pitch,
+                       c->pixels + (size_t)(c->damage.y + row) * c->w + c->damage.x,
+                       (size_t)c->damage.w * sizeof(Uint32));
+            }
+            SDL_UnlockTexture(c->texture);
+            c->damage = (SDL_Rect){0, 0, 0, 0};
+        }
+    }
+
+    SDL_Rect src = all;
+    if (c->background >> 24 == 0) SDL_IntersectRect(&c->used, &all, &src);
+    if (SDL_RectEmpty(&src)) return;
+    SDL_SetTextureBlendMode(c->texture, c->background >> 24 == 0xFF ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+    SDL_Rect dst = {x + src.x, y + src.y, src.w, src.h};
+    hudRenderCopy(renderer, c->texture, &src, &dst);
+}
+
+#endif
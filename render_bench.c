@@ -0,0 +1,228 @@
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#define EMBEDDED_ASSETS_IMPLEMENTATION
+#define TRACE_EVENTS_IMPLEMENTATION
+#include "methods_tabs.h"
+
+// Headless render benchmark.
+// Runs every method GUI of the suite without a display (offscreen or
+// dummy video driver, software renderer) through a scripted session and
+// prints ms/frame percentiles for each state it passes through: empty,
+// solved, long table, scrolled. The script of a tab is turned into an
+// event log with one mark per state and replayed by the host, so the GUIs
+// run their normal loops and nothing in them knows it is being measured.
+//
+// Usage: render_bench [frames per state] [tab number]
+
+#define BENCH_DEFAULT_FRAMES 300
+#define BENCH_SETTLE_FRAMES 60      // untimed frames for a solve to finish
+#define BENCH_LOG_PATH "render_bench.evl"
+
+typedef enum { BENCH_END, BENCH_STATE, BENCH_CLICK, BENCH_TYPE, BENCH_WHEEL } BenchOp;
+
+// x, y are content coordinates; amount is the wheel step
+typedef struct {
+    BenchOp op;
+    int x, y, amount;
+    const char* text;
+} BenchStep;
+
+#define STATE(name)         {BENCH_STATE, 0, 0, 0, name}
+#define CLICK(x, y)         {BENCH_CLICK, x, y, 0, NULL}
+#define TYPE(x, y, value)   {BENCH_TYPE, x, y, 0, value}
+#define WHEEL(x, y, amount) {BENCH_WHEEL, x, y, amount, NULL}
+#define END                 {BENCH_END, 0, 0, 0, NULL}
+
+typedef struct {
+    const char* tab;
+    BenchStep steps[16];
+} BenchScript;
+
+// Widget positions are those laid out by each GUI
+static const BenchScript scripts[] = {
+    {"Secant", {
+        STATE("empty"),
+        TYPE(180, 270, "2"), TYPE(470, 270, "1"), TYPE(180, 360, "1"), TYPE(470, 360, "2"),
+        CLICK(320, 475), STATE("solved"),
+        TYPE(180, 360, "10"), TYPE(470, 360, "11"), CLICK(320, 475), STATE("long table"),
+        WHEEL(1100, 400, -3), STATE("scrolled"),
+        END}},
+    {"Newton-Raphson", {
+        STATE("empty"),
+        TYPE(215, 247, "2"), TYPE(215, 307, "1"), TYPE(215, 367, "1"),
+        CLICK(110, 450), STATE("solved"),
+        TYPE(215, 367, "40"), CLICK(110, 450), STATE("long table"),
+        WHEEL(600, 400, -5), STATE("scrolled"),
+        END}},
+    {"False Position", {
+        STATE("empty"),
+        TYPE(215, 247, "2"), TYPE(215, 307, "1"), TYPE(215, 367, "1"), TYPE(215, 427, "2"),
+        CLICK(110, 510), STATE("solved"),
+        TYPE(215, 367, "1"), TYPE(215, 427, "6"), CLICK(110, 510), STATE("long table"),
+        WHEEL(600, 400, -10), STATE("scrolled"),
+        END}},
+    {"Fixed Point", {
+        STATE("empty"),
+        TYPE(215, 237, "1"), TYPE(215, 297, "-3"), TYPE(215, 357, "2"), TYPE(215, 417, "0"),
+        TYPE(215, 477, "2"), CLICK(215, 562), STATE("solved"),
+        TYPE(215, 297, "-2"), TYPE(215, 357, "1"), TYPE(215, 477, "1"), CLICK(215, 562), STATE("long table"),
+        WHEEL(600, 400, -10), STATE("scrolled"),
+        END}},
+    {"Fixed Point e^x", {
+        STATE("empty"),
+        TYPE(215, 257, "3"), TYPE(215, 317, "0"), TYPE(215, 377, "1"),
+        CLICK(110, 630), STATE("solved"),
+        CLICK(180, 554), CLICK(110, 630), STATE("long table"),
+        WHEEL(600, 400, -10), STATE("scrolled"),
+        END}},
+    {"Elimination", {
+        STATE("empty"),
+        TYPE(122, 274, "2"), TYPE(267, 274, "3"), TYPE(427, 274, "8"),
+        TYPE(122, 379, "1"), TYPE(267, 379, "-1"), TYPE(427, 379, "-1"),
+        CLICK(165, 464), STATE("solved"),
+        END}},
+    {"Race", {
+        STATE("empty"),
+        TYPE(185, 147, "2"), TYPE(185, 202, "1"), TYPE(185, 257, "1"), TYPE(185, 312, "2"),
+        CLICK(90, 380), STATE("raced"),
+        END}},
+    {"Sweep", {
+        STATE("empty"),
+        TYPE(185, 400, "200"), CLICK(90, 615), STATE("heatmap"),
+        END}},
+    {"Polynomial", {
+        STATE("empty"),
+        TYPE(185, 106, "200"), CLICK(90, 284), STATE("solved"),
+        END}},
+};
+
+static void benchFrames(EventLog* log, int frames) {
+    for (int i = 0; i < frames; i++) eventLogEndFrame(log);
+}
+
+static void benchMove(EventLog* log, int x, int y) {
+    SDL_Event e;
+    memset(&e, 0, sizeof(e));
+    e.type = SDL_MOUSEMOTION;
+    e.motion.x = x;
+    e.motion.y = y;
+    eventLogWrite(log, &e);
+}
+
+static void benchClick(EventLog* log, int x, int y) {
+    benchMove(log, x, y);
+    SDL_Event e;
+    memset(&e, 0, sizeof(e));
+    e.type = SDL_MOUSEBUTTONDOWN;
+    e.button.button = SDL_BUTTON_LEFT;
+    e.button.clicks = 1;
+    e.button.x = x;
+    e.button.y = y;
+    eventLogWrite(log, &e);
+    eventLogEndFrame(log);
+    e.type = SDL_MOUSEBUTTONUP;
+    eventLogWrite(log, &e);
+    eventLogEndFrame(log);
+}
+
+// Click an input box, empty it and type value, one key per frame
+static void benchType(EventLog* log, int x, int y, const char* value) {
+    benchClick(log, x, y);
+    SDL_Event e;
+    for (int i = 0; i < 8; i++) {
+        memset(&e, 0, sizeof(e));
+        e.type = SDL_KEYDOWN;
+        e.key.keysym.sym = SDLK_BACKSPACE;
+        eventLogWrite(log, &e);
+        eventLogEndFrame(log);
+    }
+    for (const char* c = value; *c; c++) {
+        memset(&e, 0, sizeof(e));
+        e.type = SDL_TEXTINPUT;
+        e.text.text[0] = *c;
+        eventLogWrite(log, &e);
+        eventLogEndFrame(log);
+    }
+}
+
+static void benchWheel(EventLog* log, int x, int y, int amount) {
+    benchMove(log, x, y);
+    SDL_Event e;
+    memset(&e, 0, sizeof(e));
+    e.type = SDL_MOUSEWHEEL;
+    e.wheel.y = amount;
+    eventLogWrite(log, &e);
+    eventLogEndFrame(log);
+}
+
+// Write the session of a script: each state is a timed segment of frames,
+// everything between states (typing, clicks, the solve) is untimed
+static int benchWriteLog(const BenchScript* script, int frames, int offsetY) {
+    EventLog log;
+    if (eventLogRecordOpen(&log, BENCH_LOG_PATH) != 0) return 0;
+    eventLogMark(&log, "");
+    
+    for (const BenchStep* step = script->steps; step->op != BENCH_END; step++) {
+        switch (step->op) {
+            case BENCH_STATE:
+                benchFrames(&log, BENCH_SETTLE_FRAMES);
+                eventLogMark(&log, step->text);
+                benchFrames(&log, frames);
+                eventLogMark(&log, "");
+                break;
+            case BENCH_CLICK:
+                benchClick(&log, step->x, step->y + offsetY);
+                break;
+            case BENCH_TYPE:
+                benchType(&log, step->x, step->y + offsetY, step->text);
+                break;
+            case BENCH_WHEEL:
+                benchWheel(&log, step->x, step->y + offsetY, step->amount);
+                break;
+            default:
+                break;
+        }
+    }
+    fclose(log.out);
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    int frames = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_FRAMES;
+    int only = argc > 2 ? atoi(argv[2]) - 1 : -1;
+    if (frames < 1) frames = BENCH_DEFAULT_FRAMES;
+    
+    SDL_setenv("METHODS_HEADLESS", "1", 1);
+    SDL_setenv("METHODS_SESSION", "", 1);     // the scripted solves stay out of the history
+    AppHost host;
+    const AppTab* first = &methodTabs[only >= 0 && only < METHOD_TAB_COUNT ? only : 0];
+    if (appHostInit(&host, first->title, first->width, first->height, methodTabs, METHOD_TAB_COUNT) != 0) {
+        return 1;
+    }
+    
+    SDL_RendererInfo info;
+    SDL_GetRendererInfo(host.renderer, &info);
+    printf("Render benchmark: %s video driver, %s renderer, %d frames per state\n",
+           SDL_GetCurrentVideoDriver(), info.name, frames);
+    
+    int count = sizeof(scripts) / sizeof(scripts[0]);
+    for (int i = 0; i < count; i++) {
+        int tab = appHostFindTab(&host, scripts[i].tab);
+        if (tab < 0 || (only >= 0 && tab != only)) continue;
+        
+        if (!benchWriteLog(&scripts[i], frames, host.offsetY) ||
+            eventLogReplayOpen(&host.log, BENCH_LOG_PATH) != 0) {
+            printf("Error writing %s\n", BENCH_LOG_PATH);
+            break;
+        }
+        printf("%s\n", scripts[i].tab);
+        appHostRun(&host, tab);
+        eventLogClose(&host.log, NULL);
+    }
+    remove(BENCH_LOG_PATH);
+    
+    appHostFree(&host);
+    return 0;
+}
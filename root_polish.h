@@ -0,0 +1,134 @@
+#ifndef ROOT_POLISH_H
+#define ROOT_POLISH_H
+
+#include <float.h>
+#include "root_problem.h"
+#include "double_double.h"
+
+// High-precision polish of a root a solver has already found.
+// Newton in double continues from it until the steps stop shrinking, which
+// is where double rounding takes over; Newton in double-double then takes
+// the last few steps, each doubling the correct digits, to about 30.
+
+#define POLISH_MAX_DOUBLE_STEPS 50
+#define POLISH_MAX_DD_STEPS 4       // quadratic convergence: 16 -> 32 digits in one or two
+#define POLISH_DIGITS 30
+
+// The problem with its coefficients to double-double precision
+typedef struct {
+    ProblemFamily family;
+    DoubleDouble a, b, c;
+} RootProblemDD;
+
+typedef struct {
+    DoubleDouble root;
+    int doubleSteps;
+    int ddSteps;
+    int settled;            // last double-double step below DD_EPSILON relative
+} RootPolish;
+
+// Parse the coefficients as typed; 0 if one of them is not a number
+static inline int polishProblemParse(RootProblemDD* p, ProblemFamily family,
+                                     const char* a, const char* b, const char* c) {
+    p->family = family;
+    p->c = ddFromDouble(0);
+    return ddParse(a, &p->a) && ddParse(b, &p->b) && (!c || ddParse(c, &p->c));
+}
+
+// f(x) and f'(x) in double-double
+static inline DoubleDouble polishF(const RootProblemDD* p, DoubleDouble x, DoubleDouble* df, SolverCost* cost) {
+    DoubleDouble f;
+    cost->fEvals++;
+    cost->dfEvals++;
+    if (p->family == PROBLEM_QUADRATIC) {
+        // Horner: (ax + b)x + c, and f' = 2ax + b
+        DoubleDouble ax = ddMul(p->a, x);
+        f = ddAdd(ddMul(ddAdd(ax, p->b), x), p->c);
+        *df = ddAdd(ddLdexp(ax, 1), p->b);
+    } else {
+        cost->expCalls++;
+        DoubleDouble ex = ddExp(x);
+        f = ddSub(ddSub(ex, ddMul(p->a, x)), p->b);
+        *df = ddSub(ex, p->a);
+    }
+    return f;
+}
+
+// Polish x to a root of p. Returns 0 if f' vanishes or the result is not
+// finite; a multiple root converges only linearly and ends unsettled.
+static inline int rootPolish(const RootProblemDD* p, double x, RootPolish* out, SolverCost* cost) {
+    SolverCost scratch;
+    if (!cost) cost = &scratch;
+    RootProblem single = {p->family, p->a.hi, p->b.hi, p->c.hi};
+    memset(out, 0, sizeof(*out));
+
+    // Stage 1: double Newton until stagnation
+    double lastStep = INFINITY;
+    for (int i = 0; i < POLISH_MAX_DOUBLE_STEPS; i++) {
+        double fx = problemF(&single, x, cost);
+        double dfx = problemDf(&single, x, cost);
+        if (fx == 0) break;
+        if (dfx == 0 || !isfinite(dfx)) return 0;
+        cost->divisions++;
+        double step = fx / dfx;
+        if (!isfinite(step) || fabs(step) >= lastStep) break;
+        x -= step;
+        out->doubleSteps++;
+        lastStep = fabs(step);
+        if (lastStep <= 4 * DBL_EPSILON * fabs(x)) break;
+    }
+
+    // Stage 2: double-double Newton from there
+    DoubleDouble X = ddFromDouble(x);
+    for (int i = 0; i < POLISH_MAX_DD_STEPS; i++) {
+        DoubleDouble dfX;
+        DoubleDouble fX = polishF(p, X, &dfX, cost);
+        if (fX.hi == 0) {
+            out->settled = 1;
+            break;
+        }
+        if (dfX.hi == 0 || !isfinite(dfX.hi)) return 0;
+        cost->divisions++;
+        DoubleDouble step = ddDiv(fX, dfX);
+        X = ddSub(X, step);
+        out->ddSteps++;
+        if (fabs(step.hi) <= DD_EPSILON * fabs(X.hi)) {
+            out->settled = 1;
+            break;
+        }
+    }
+
+    out->root = X;
+    return isfinite(X.hi);
+}
+
+// The polished root and its steps; sep goes between the three parts
+static inline void polishFormat(char* buffer, size_t size, const RootProblemDD* p, double root,
+                                const char* sep, SolverCost* cost) {
+    RootPolish polish;
+    if (!rootPolish(p, root, &polish, cost)) {
+        snprintf(buffer, size, "Polish failed:%sf'(x) is zero", sep);
+        return;
+    }
+    char digits[64];
+    ddFormat(polish.root, POLISH_DIGITS, digits, sizeof(digits));
+    snprintf(buffer, size, "Polished (F4):%sx = %s%s[%d + %d dd steps%s]", sep, digits, sep,
+             polish.doubleSteps, polish.ddSteps, polish.settled ? "" : ", not settled");
+}
+
+// Text for an app's high-precision toggle: empty when off, the polished
+// root once solved. p is NULL if the coefficients did not parse.
+static inline void polishDescribe(char* buffer, size_t size, const char* sep, int on,
+                                  const RootProblemDD* p, int hasRoot, double root) {
+    if (!on) {
+        buffer[0] = '\0';
+    } else if (!hasRoot) {
+        snprintf(buffer, size, "Polish on (F4): solve first");
+    } else if (!p) {
+        snprintf(buffer, size, "Polish: coefficients must be decimals");
+    } else {
+        polishFormat(buffer, size, p, root, sep, NULL);
+    }
+}
+
+#endif
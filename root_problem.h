@@ -0,0 +1,155 @@
+#ifndef ROOT_PROBLEM_H
+#define ROOT_PROBLEM_H
+
+#include <SDL.h>
+#include <math.h>
+#include "trace_events.h"
+#include "fast_exp.h"
+
+// The equations the solvers work on, and their f, f' and g kernels.
+// Each kernel counts its own work into an optional SolverCost.
+
+typedef enum {
+    PROBLEM_EXPONENTIAL,    // e^x - ax - b
+    PROBLEM_QUADRATIC       // ax^2 + bx + c
+} ProblemFamily;
+
+typedef struct {
+    ProblemFamily family;
+    double a, b, c;
+} RootProblem;
+
+// What a solve actually cost, beyond its iteration count
+typedef struct {
+    int fEvals;
+    int dfEvals;
+    int gEvals;
+    int expCalls;
+    int logCalls;
+    int sqrtCalls;
+    int divisions;
+    int cacheHits;          // f(x) values served by an EvalCache
+    int safeguards;         // guards that fired: zero divisor, domain, overflow, residual
+    Uint64 ns;              // wall-clock time spent in solverInit/solverStep
+} SolverCost;
+
+static inline double problemF(const RootProblem* p, double x, SolverCost* cost) {
+    SolverCost scratch;
+    if (!cost) cost = &scratch;
+    cost->fEvals++;
+
+    double y;
+    TRACE_SCOPE("f(x)") {
+        if (p->family == PROBLEM_QUADRATIC) {
+            y = p->a * x * x + p->b * x + p->c;
+        } else {
+            cost->expCalls++;
+            y = exp(x) - p->a * x - p->b;
+        }
+    }
+    return y;
+}
+
+// f at n points for plotting only, uncounted: e^x is fastExpArray's,
+// within a few ulp of exp()
+static inline void problemFArray(const RootProblem* p, const double* x, double* y, int n) {
+    if (p->family == PROBLEM_QUADRATIC) {
+        for (int i = 0; i < n; i++) y[i] = p->a * x[i] * x[i] + p->b * x[i] + p->c;
+        return;
+    }
+    fastExpArray(x, y, n);
+    for (int i = 0; i < n; i++) y[i] -= p->a * x[i] + p->b;
+}
+
+static inline double problemDf(const RootProblem* p, double x, SolverCost* cost) {
+    SolverCost scratch;
+    if (!cost) cost = &scratch;
+    cost->dfEvals++;
+
+    double y;
+    TRACE_SCOPE("f'(x)") {
+        if (p->family == PROBLEM_QUADRATIC) {
+            y = 2 * p->a * x + p->b;
+        } else {
+            cost->expCalls++;
+            y = exp(x) - p->a;
+        }
+    }
+    return y;
+}
+
+// Fixed point rearrangements x = g(x); NAN outside a form's domain
+static inline double problemGForm(const RootProblem* p, double x, int form, SolverCost* cost) {
+    double a = p->a, b = p->b, c = p->c;
+
+    if (p->family == PROBLEM_QUADRATIC) {
+        switch (form) {
+            case 1:
+                cost->divisions++;
+                return -(a * x * x + c) / b;
+            case 2:
+                if (fabs(a * x + b) < 1e-10) return NAN;
+                cost->divisions++;
+                return -c / (a * x + b);
+            case 3:
+                cost->divisions++;
+                if (a == 0 || (-b * x - c) / a < 0) return NAN;
+                cost->sqrtCalls++;
+                return sqrt((-b * x - c) / a);
+            case 4:
+                cost->divisions++;
+                if (a == 0 || (-b * x - c) / a < 0) return NAN;
+                cost->sqrtCalls++;
+                return -sqrt((-b * x - c) / a);
+            case 5:
+                if (b == 0) return NAN;
+                cost->divisions += 3;
+                return (x * x - c / a) / (-b / a);
+            default: return NAN;
+        }
+    }
+
+    switch (form) {
+        case 1: // ln(ax + b)
+            if (a * x + b <= 0) return NAN;
+            cost->logCalls++;
+            return log(a * x + b);
+        case 2: // (e^x - b) / a
+            if (a == 0) return NAN;
+            cost->expCalls++;
+            cost->divisions++;
+            return (exp(x) - b) / a;
+        case 3: { // ln((e^x - b) / a)
+            if (a == 0) return NAN;
+            cost->expCalls++;
+            double ex = exp(x);
+            if (ex - b <= 0) return NAN;
+            cost->logCalls++;
+            cost->divisions++;
+            return log((ex - b) / a);
+        }
+        case 4: // e^x / a - b / a
+            if (a == 0) return NAN;
+            cost->expCalls++;
+            cost->divisions += 2;
+            return exp(x) / a - b / a;
+        case 5: // x - 0.1 (e^x - ax - b)
+            cost->expCalls++;
+            return x - 0.1 * (exp(x) - a * x - b);
+        default: return NAN;
+    }
+}
+
+static inline double problemG(const RootProblem* p, double x, int form, SolverCost* cost) {
+    SolverCost scratch;
+    if (!cost) cost = &scratch;
+    cost->gEvals++;
+
+    double y;
+    TRACE_SCOPE("g(x)") {
+        y = problemGForm(p, x, form, cost);
+    }
+    return y;
+}
+
+#endif
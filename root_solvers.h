@@ -0,0 +1,373 @@
+#ifndef ROOT_SOLVERS_H
+#define ROOT_SOLVERS_H
+
+#include <SDL.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "root_problem.h"
+#include "eval_cache.h"
+#include "stop_criteria.h"
+#include "trace_events.h"
+
+// Resumable root finders.
+// Every method is an iterator: solverInit() sets it up and each call to
+// solverStep() advances exactly one iteration, so a caller can run a solve
+// to completion, animate it one step per frame, or interleave many solves.
+// When a solve stops is up to its StopPolicy, checked after every step.
+
+typedef enum {
+    SOLVER_SECANT,
+    SOLVER_NEWTON,
+    SOLVER_FALSE_POSITION,
+    SOLVER_FIXED_POINT
+} SolverMethod;
+
+enum { SOLVER_RUNNING, SOLVER_CONVERGED, SOLVER_FAILED };
+
+// Why a solve stopped without converging
+enum {
+    SOLVER_OK,
+    SOLVER_ZERO_DIVISOR,    // secant f(x(n)) == f(x(n-1)), Newton f'(x) ~ 0
+    SOLVER_DIVERGED,        // NaN, Inf or |x| > 1e10
+    SOLVER_MAX_ITER,
+    SOLVER_NOT_BRACKETED,   // false position needs f(x0) * f(x1) < 0
+    SOLVER_SAME_GUESSES,    // secant needs x0 != x1
+    SOLVER_BAD_RESIDUAL,    // settled where a required rule fails, e.g. fixed point |f(x)| > 0.1
+    SOLVER_STAGNATED,       // steps stopped shrinking
+    SOLVER_TIME_BUDGET
+};
+
+// One iteration as shown in the tables.
+// secant:         x(n-1), x(n), f(x(n-1)), f(x(n)), x(n+1), error
+// Newton:         x_n, f(x_n), f'(x_n), x_(n+1), error
+// false position: x0, x1, x2, f(x2), error
+// fixed point:    x_n, x_(n+1), error
+typedef struct {
+    int n;
+    int count;
+    double v[6];
+} SolverRow;
+
+typedef struct {
+    SolverMethod method;
+    RootProblem problem;
+    int form;               // fixed point rearrangement (1-5)
+    StopPolicy stop;        // the method's own rules; may be changed after solverInit
+
+    int n;                  // iterations taken so far
+    double x0, x1;          // previous/current point or bracket ends
+    double f0, f1;
+    double estimate;        // latest root estimate, for the step rules
+    double lastStep;
+    int stalls;             // steps in a row that did not shrink
+    int status;
+    int failure;
+    double root;
+    SolverCost cost;
+    EvalCache* cache;       // optional f(x) memo; set after solverInit
+} RootSolver;
+
+static inline int solverOutOfRange(double x) {
+    return isnan(x) || isinf(x) || fabs(x) > 1e10;
+}
+
+static inline void solverStop(RootSolver* s, int status, int failure, double root) {
+    s->status = status;
+    s->failure = failure;
+    s->root = root;
+}
+
+static inline double solverF(RootSolver* s, double x) {
+    if (s->cache) return evalCacheF(s->cache, &s->problem, x, &s->cost);
+    return problemF(&s->problem, x, &s->cost);
+}
+
+// A guard fired and ended the solve
+static inline void solverGuard(RootSolver* s, int failure, double root) {
+    s->cost.safeguards++;
+    solverStop(s, SOLVER_FAILED, failure, root);
+}
+
+static inline Uint64 solverElapsedNs(Uint64 start) {
+    return (SDL_GetPerformanceCounter() - start) * 1000000000ULL / SDL_GetPerformanceFrequency();
+}
+
+// The rules each method has always stopped on: secant on step or residual,
+// Newton on step, false position on residual, fixed point on step with a
+// residual check of 0.1
+static inline StopPolicy solverDefaultStop(SolverMethod method, double tolerance, int maxIter) {
+    StopPolicy p;
+    memset(&p, 0, sizeof(p));
+    p.absStep = tolerance;
+    p.relStep = tolerance;
+    p.residual = tolerance;
+    p.maxIter = maxIter;
+    switch (method) {
+        case SOLVER_SECANT:         p.any = STOP_ABS_STEP | STOP_RESIDUAL; break;
+        case SOLVER_NEWTON:         p.any = STOP_ABS_STEP; break;
+        case SOLVER_FALSE_POSITION: p.any = STOP_RESIDUAL; break;
+        case SOLVER_FIXED_POINT:
+            p.any = STOP_ABS_STEP;
+            p.all = STOP_RESIDUAL;
+            p.residual = 0.1;
+            break;
+    }
+    return p;
+}
+
+static inline int solverRuleHolds(RootSolver* s, unsigned rule, double step, double x, double* fx, int* haveF) {
+    switch (rule) {
+        case STOP_ABS_STEP: return step < s->stop.absStep;
+        case STOP_REL_STEP: return step < s->stop.relStep * fabs(x);
+        default:
+            if (!*haveF) {
+                *fx = solverF(s, x);
+                *haveF = 1;
+            }
+            return fabs(*fx) < s->stop.residual;
+    }
+}
+
+// every = 0: whether any of the rules holds; every = 1: whether all do
+static inline int solverRulesHold(RootSolver* s, unsigned rules, int every, double step, double x,
+                                  double* fx, int* haveF) {
+    for (unsigned rule = STOP_ABS_STEP; rule <= STOP_RESIDUAL; rule <<= 1) {
+        if ((rules & rule) && solverRuleHolds(s, rule, step, x, fx, haveF) != every) return !every;
+    }
+    return every;
+}
+
+// Check the stop policy against a method's new estimate x. haveF says whether
+// fx is f(x) already; if not, f is evaluated only if a rule gets that far.
+static inline void solverCheckStop(RootSolver* s, double x, double fx, int haveF) {
+    double step = fabs(x - s->estimate);
+    s->estimate = x;
+
+    if (solverRulesHold(s, s->stop.any, 0, step, x, &fx, &haveF)) {
+        if (solverRulesHold(s, s->stop.all, 1, step, x, &fx, &haveF)) {
+            solverStop(s, SOLVER_CONVERGED, SOLVER_OK, x);
+        } else {
+            solverGuard(s, SOLVER_BAD_RESIDUAL, x);
+        }
+        return;
+    }
+
+    // A NAN step (no previous estimate yet) counts as progress
+    s->stalls = step >= s->lastStep ? s->stalls + 1 : 0;
+    s->lastStep = step;
+    if (s->stop.stagnation > 0 && s->stalls >= s->stop.stagnation) {
+        solverGuard(s, SOLVER_STAGNATED, x);
+    }
+}
+
+// x0/x1: the two starting points (x1 is ignored by Newton and fixed point)
+static inline void solverInit(RootSolver* s, SolverMethod method, const RootProblem* problem,
+                              double x0, double x1, double tolerance, int maxIter) {
+    Uint64 start = SDL_GetPerformanceCounter();
+    memset(s, 0, sizeof(*s));
+    s->method = method;
+    s->problem = *problem;
+    s->form = 1;
+    s->stop = solverDefaultStop(method, tolerance, maxIter);
+    s->x0 = x0;
+    s->x1 = x1;
+    s->estimate = method == SOLVER_SECANT ? x1 : method == SOLVER_FALSE_POSITION ? NAN : x0;
+    s->lastStep = INFINITY;
+    s->status = SOLVER_RUNNING;
+
+    if (method == SOLVER_SECANT || method == SOLVER_FALSE_POSITION) {
+        s->f0 = problemF(problem, x0, &s->cost);
+        s->f1 = problemF(problem, x1, &s->cost);
+    }
+    if (method == SOLVER_SECANT && fabs(x1 - x0) < 1e-10) {
+        solverGuard(s, SOLVER_SAME_GUESSES, 0);
+    }
+    if (method == SOLVER_FALSE_POSITION && s->f0 * s->f1 >= 0) {
+        solverGuard(s, SOLVER_NOT_BRACKETED, 0);
+    }
+    s->cost.ns += solverElapsedNs(start);
+}
+
+static inline int secantStep(RootSolver* s, SolverRow* row) {
+    if (s->f1 == 0) {
+        solverStop(s, SOLVER_CONVERGED, SOLVER_OK, s->x1);
+        return 0;
+    }
+
+    // Relative, so a tight stop policy can follow the iterates down to f ~ 0
+    double denominator = s->f1 - s->f0;
+    if (fabs(denominator) <= 1e-10 * fmax(fabs(s->f0), fabs(s->f1))) {
+        solverGuard(s, SOLVER_ZERO_DIVISOR, 0);
+        return 0;
+    }
+
+    s->cost.divisions++;
+    double x2 = s->x1 - s->f1 * (s->x1 - s->x0) / denominator;
+    double error = fabs(x2 - s->x1);
+    double f2 = solverF(s, x2);
+
+    row->count = 6;
+    row->v[0] = s->x0;
+    row->v[1] = s->x1;
+    row->v[2] = s->f0;
+    row->v[3] = s->f1;
+    row->v[4] = x2;
+    row->v[5] = error;
+
+    solverCheckStop(s, x2, f2, 1);
+
+    s->x0 = s->x1;
+    s->f0 = s->f1;
+    s->x1 = x2;
+    s->f1 = f2;
+    return 1;
+}
+
+static inline int newtonStep(RootSolver* s, SolverRow* row) {
+    double x = s->x0;
+    double fx = solverF(s, x);
+    double dfx = problemDf(&s->problem, x, &s->cost);
+
+    if (fabs(dfx) < 1e-12) {
+        solverGuard(s, SOLVER_ZERO_DIVISOR, 0);
+        return 0;
+    }
+
+    s->cost.divisions++;
+    double x1 = x - fx / dfx;
+    double error = fabs(x1 - x);
+
+    row->count = 5;
+    row->v[0] = x;
+    row->v[1] = fx;
+    row->v[2] = dfx;
+    row->v[3] = x1;
+    row->v[4] = error;
+
+    if (solverOutOfRange(x1)) {
+        solverGuard(s, SOLVER_DIVERGED, 0);
+    } else {
+        solverCheckStop(s, x1, 0, 0);
+    }
+
+    s->x0 = x1;
+    return 1;
+}
+
+static inline int falsePositionStep(RootSolver* s, SolverRow* row) {
+    s->cost.divisions++;
+    double x2 = s->x1 - s->f1 * (s->x1 - s->x0) / (s->f1 - s->f0);
+    double f2 = solverF(s, x2);
+    double error = fabs(f2);
+
+    row->count = 5;
+    row->v[0] = s->x0;
+    row->v[1] = s->x1;
+    row->v[2] = x2;
+    row->v[3] = f2;
+    row->v[4] = error;
+
+    solverCheckStop(s, x2, f2, 1);
+    if (s->status != SOLVER_RUNNING) {
+        return 1;
+    } else if (s->f0 * f2 < 0) {
+        s->x1 = x2;
+        s->f1 = f2;
+    } else {
+        s->x0 = x2;
+        s->f0 = f2;
+    }
+    return 1;
+}
+
+static inline int fixedPointStep(RootSolver* s, SolverRow* row) {
+    double x = s->x0;
+    double x1 = problemG(&s->problem, x, s->form, &s->cost);
+    double error = fabs(x1 - x);
+
+    row->count = 3;
+    row->v[0] = x;
+    row->v[1] = x1;
+    row->v[2] = error;
+
+    if (solverOutOfRange(x1)) {
+        solverGuard(s, SOLVER_DIVERGED, x);
+        return 1;
+    }
+
+    s->x0 = x1;
+    solverCheckStop(s, x1, 0, 0);
+    return 1;
+}
+
+// Advance one iteration. Returns the solver status afterwards; row is
+// filled (row->count > 0) only if an iteration was actually performed.
+static inline int solverStep(RootSolver* s, SolverRow* row) {
+    row->count = 0;
+    if (s->status != SOLVER_RUNNING) return s->status;
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    int produced = 0;
+    TRACE_SCOPE("solverStep") {
+        switch (s->method) {
+            case SOLVER_SECANT:         produced = secantStep(s, row); break;
+            case SOLVER_NEWTON:         produced = newtonStep(s, row); break;
+            case SOLVER_FALSE_POSITION: produced = falsePositionStep(s, row); break;
+            case SOLVER_FIXED_POINT:    produced = fixedPointStep(s, row); break;
+        }
+    }
+
+    if (produced) {
+        row->n = ++s->n;
+    }
+
+    s->cost.ns += solverElapsedNs(start);
+    if (s->status == SOLVER_RUNNING) {
+        if (s->n >= s->stop.maxIter) {
+            solverStop(s, SOLVER_FAILED, SOLVER_MAX_ITER, 0);
+        } else if (s->stop.maxMs > 0 && s->cost.ns >= s->stop.maxMs * 1e6) {
+            solverStop(s, SOLVER_FAILED, SOLVER_TIME_BUDGET, 0);
+        }
+    }
+    return s->status;
+}
+
+// Latest estimate, usable while the solve is still running
+static inline double solverCurrentX(const RootSolver* s) {
+    if (s->status == SOLVER_CONVERGED) return s->root;
+    if (s->method == SOLVER_SECANT) return s->x1;
+    return s->x0;
+}
+
+// Short name of a failure code, for tables and legends
+static inline const char* solverFailureName(int failure) {
+    switch (failure) {
+        case SOLVER_ZERO_DIVISOR:   return "Zero divisor";
+        case SOLVER_DIVERGED:       return "Diverged";
+        case SOLVER_MAX_ITER:       return "No convergence";
+        case SOLVER_NOT_BRACKETED:  return "Not bracketed";
+        case SOLVER_SAME_GUESSES:   return "x0 = x1";
+        case SOLVER_BAD_RESIDUAL:   return "Bad residual";
+        case SOLVER_STAGNATED:      return "Stagnated";
+        case SOLVER_TIME_BUDGET:    return "Out of time";
+        default:                    return "Failed";
+    }
+}
+
+// One-line cost summary; sep goes between the evaluation counts and the rest
+static inline void solverFormatCost(char* buffer, size_t size, const SolverCost* cost, const char* sep) {
+    snprintf(buffer, size, "Cost: %d f, %d f', %d g evals, %d cached%s%d exp/log, %d div, %d guards, %.1f us",
+             cost->fEvals, cost->dfEvals, cost->gEvals, cost->cacheHits, sep, cost->expCalls + cost->logCalls,
+             cost->divisions, cost->safeguards, cost->ns / 1000.0);
+}
+
+// Append the cost as two more lines of a result message
+static inline void solverAppendCost(char* message, size_t size, const SolverCost* cost) {
+    size_t len = strlen(message);
+    if (len + 1 >= size) return;
+    message[len++] = '\n';
+    solverFormatCost(message + len, size - len, cost, "\n");
+}
+
+#endif
@@ -3,11 +3,23 @@
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
+#include "frame_hud.h"
+#include "trace_events.h"
+#include "iteration_table.h"
+#include "solve_worker.h"
+#include "app_host.h"
+#include "root_solvers.h"
+#include "eval_cache.h"
+#include "graph_view.h"
+#include "raster_canvas.h"
+#include "root_polish.h"
 
 #define WINDOW_WIDTH 1500
 #define WINDOW_HEIGHT 950
-#define MAX_ITERATIONS 100
+#define MAX_ITERATIONS 100         // default budget; a stop spec may raise it
+#define GRAPH_ITERATIONS 10        // iterations drawn as secant lines on the graph
 #define TOLERANCE 0.0001
+#define ANIMATION_STEP_MS 500
 
 // Iteration data structure
 typedef struct {
@@ -35,90 +47,95 @@ typedef struct {
     int clicked;
 } Button;
 
-// Global iteration storage
-IterationData iterations[MAX_ITERATIONS];
-int iterationCount = 0;
+// What the tab shows, kept while the user is on other tabs (appHostTabState)
+typedef struct {
+    int saved;
+    char values[4][50];
+    char statusMsg[300];
+    char costText[160];
+    int statusSuccess;
+    int hasResult;
+    double root;
+    double a_val, b_val;
+    int scrollOffset;
+    RootProblemDD precise;
+    int preciseOk;
+    int polishMode;
+    char polishText[128];
+    IterationTable table;
+} SecantState;
+
+// First iterations kept for the graph; every row goes to the table
+static IterationData iterations[GRAPH_ITERATIONS];
+static int iterationCount = 0;
+
+// f(x) values shared by the animated solver, the graph and the result box
+static EvalCache evalCache;
 
 // Render text with UTF-8 support
-void renderText(SDL_Renderer* renderer, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
+// (the draw list frees the texture once the frame is submitted)
+static void renderText(DrawList* draw, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
     SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, color);
     if (!surface) return;
     
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
     SDL_Rect rect = {x, y, surface->w, surface->h};
-    SDL_RenderCopy(renderer, texture, NULL, &rect);
+    drawListTexture(draw, texture, NULL, &rect, 1);
     
     SDL_FreeSurface(surface);
-    SDL_DestroyTexture(texture);
 }
 
 // Render bold text
-void renderTextBold(SDL_Renderer* renderer, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
-    renderText(renderer, font, text, x, y, color);
-    renderText(renderer, font, text, x + 1, y, color);
+static void renderTextBold(DrawList* draw, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
+    renderText(draw, font, text, x, y, color);
+    renderText(draw, font, text, x + 1, y, color);
 }
 
 // Draw a styled panel
-void drawPanel(SDL_Renderer* renderer, int x, int y, int w, int h, SDL_Color bg, SDL_Color border, int borderWidth) {
-    SDL_SetRenderDrawColor(renderer, bg.r, bg.g, bg.b, bg.a);
+static void drawPanel(DrawList* draw, int x, int y, int w, int h, SDL_Color bg, SDL_Color border, int borderWidth) {
     SDL_Rect r = {x, y, w, h};
-    SDL_RenderFillRect(renderer, &r);
+    drawListFillRect(draw, &r, bg);
     
-    SDL_SetRenderDrawColor(renderer, border.r, border.g, border.b, border.a);
     for (int i = 0; i < borderWidth; i++) {
         SDL_Rect br = {x + i, y + i, w - 2*i, h - 2*i};
-        SDL_RenderDrawRect(renderer, &br);
+        drawListRect(draw, &br, border);
     }
 }
 
-// Draw rounded corner effect
-void drawRoundedPanel(SDL_Renderer* renderer, int x, int y, int w, int h, SDL_Color bg) {
-    SDL_SetRenderDrawColor(renderer, bg.r, bg.g, bg.b, bg.a);
-    SDL_Rect r = {x + 2, y + 2, w - 4, h - 4};
-    SDL_RenderFillRect(renderer, &r);
-    
-    // Corner pixels
-    SDL_SetRenderDrawColor(renderer, bg.r, bg.g, bg.b, bg.a);
-    SDL_RenderDrawLine(renderer, x + 1, y + 2, x + 1, y + h - 3);
-    SDL_RenderDrawLine(renderer, x + w - 2, y + 2, x + w - 2, y + h - 3);
-    SDL_RenderDrawLine(renderer, x + 2, y + 1, x + w - 3, y + 1);
-    SDL_RenderDrawLine(renderer, x + 2, y + h - 2, x + w - 3, y + h - 2);
-}
-
 // Render input box
-void renderInputBox(SDL_Renderer* renderer, TTF_Font* font, InputBox* box) {
+static void renderInputBox(DrawList* draw, TTF_Font* font, InputBox* box) {
     // Box fill
+    SDL_Color fill;
     if (box->active) {
-        SDL_SetRenderDrawColor(renderer, 255, 240, 240, 255);
+        fill = (SDL_Color){255, 240, 240, 255};
     } else {
-        SDL_SetRenderDrawColor(renderer, 255, 250, 250, 255);
+        fill = (SDL_Color){255, 250, 250, 255};
     }
-    SDL_RenderFillRect(renderer, &box->rect);
+    drawListFillRect(draw, &box->rect, fill);
     
     // Box border
     if (box->active) {
-        SDL_SetRenderDrawColor(renderer, 200, 50, 50, 255);
-        SDL_RenderDrawRect(renderer, &box->rect);
+        SDL_Color border = {200, 50, 50, 255};
+        drawListRect(draw, &box->rect, border);
         SDL_Rect inner = {box->rect.x + 1, box->rect.y + 1, box->rect.w - 2, box->rect.h - 2};
-        SDL_RenderDrawRect(renderer, &inner);
+        drawListRect(draw, &inner, border);
     } else {
-        SDL_SetRenderDrawColor(renderer, 180, 100, 100, 255);
-        SDL_RenderDrawRect(renderer, &box->rect);
+        drawListRect(draw, &box->rect, (SDL_Color){180, 100, 100, 255});
     }
     
     // Label
     SDL_Color labelColor = {120, 30, 30, 255};
-    renderTextBold(renderer, font, box->label, box->rect.x, box->rect.y - 25, labelColor);
+    renderTextBold(draw, font, box->label, box->rect.x, box->rect.y - 25, labelColor);
     
     // Value text
     SDL_Color textColor = {80, 20, 20, 255};
     if (strlen(box->value) > 0) {
-        renderText(renderer, font, box->value, box->rect.x + 10, box->rect.y + 8, textColor);
+        renderText(draw, font, box->value, box->rect.x + 10, box->rect.y + 8, textColor);
     }
 }
 
 // Render button
-void renderButton(SDL_Renderer* renderer, TTF_Font* font, Button* btn) {
+static void renderButton(DrawList* draw, TTF_Font* font, Button* btn) {
     SDL_Color bgColor, textColor = {255, 255, 255, 255};
     
     if (btn->clicked) {
@@ -130,60 +147,123 @@ void renderButton(SDL_Renderer* renderer, TTF_Font* font, Button* btn) {
     }
     
     // Shadow effect
-    SDL_SetRenderDrawColor(renderer, 100, 20, 20, 255);
     SDL_Rect shadow = {btn->rect.x + 3, btn->rect.y + 3, btn->rect.w, btn->rect.h};
-    SDL_RenderFillRect(renderer, &shadow);
+    drawListFillRect(draw, &shadow, (SDL_Color){100, 20, 20, 255});
     
     // Button
-    SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-    SDL_RenderFillRect(renderer, &btn->rect);
+    drawListFillRect(draw, &btn->rect, bgColor);
     
-    SDL_SetRenderDrawColor(renderer, 120, 20, 20, 255);
-    SDL_RenderDrawRect(renderer, &btn->rect);
+    drawListRect(draw, &btn->rect, (SDL_Color){120, 20, 20, 255});
     
     // Text
     SDL_Surface* surface = TTF_RenderText_Blended(font, btn->text, textColor);
     if (surface) {
         int textX = btn->rect.x + (btn->rect.w - surface->w) / 2;
         int textY = btn->rect.y + (btn->rect.h - surface->h) / 2;
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+        SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
         SDL_Rect textRect = {textX, textY, surface->w, surface->h};
-        SDL_RenderCopy(renderer, texture, NULL, &textRect);
+        drawListTexture(draw, texture, NULL, &textRect, 1);
         SDL_FreeSurface(surface);
-        SDL_DestroyTexture(texture);
     }
 }
 
-// Exponential function: e^x - ax - b
-double function(double x, double a, double b) {
-    return exp(x) - a * x - b;
+// Exponential function: e^x - ax - b, memoized in evalCache
+static double function(double x, double a, double b) {
+    RootProblem problem = {PROBLEM_EXPONENTIAL, a, b, 0};
+    return evalCacheF(&evalCache, &problem, x, NULL);
 }
 
-// Draw graph with function and convergence visualization
-void drawGraph(SDL_Renderer* renderer, TTF_Font* fontSmall, double a, double b, 
-               double root, int hasRoot) {
-    int graphX = 40;
-    int graphY = 540;
-    int graphW = 660;
-    int graphH = 360;
-    
-    // Background
-    SDL_SetRenderDrawColor(renderer, 255, 252, 248, 255);
-    SDL_Rect graphRect = {graphX, graphY, graphW, graphH};
-    SDL_RenderFillRect(renderer, &graphRect);
-    
-    // Border
-    drawPanel(renderer, graphX, graphY, graphW, graphH, 
-              (SDL_Color){255, 252, 248, 255}, (SDL_Color){180, 80, 80, 255}, 2);
+// Status text for a finished (or failed) secant solve
+static void describeResult(char* buffer, const RootSolver* solver) {
+    switch (solver->failure) {
+        case SOLVER_OK:
+            sprintf(buffer, "SUCCESS! Converged in %d iterations.\nApproximate root: x = %.3f", 
+                    solver->n, solver->root);
+            break;
+        case SOLVER_SAME_GUESSES:
+            sprintf(buffer, "ERROR: x0 and x1 must be different!\nPlease choose two distinct initial guesses.");
+            break;
+        case SOLVER_ZERO_DIVISOR:
+            sprintf(buffer, "ERROR: Division by zero at iteration %d\nf(x%d) = f(x%d), cannot continue.", 
+                    solver->n + 1, solver->n, solver->n + 1);
+            break;
+        case SOLVER_MAX_ITER:
+            sprintf(buffer, "Did not converge in %d iterations.\nTry different initial guesses.", solver->n);
+            break;
+        default:
+            sprintf(buffer, "Stopped: %s after %d iterations.\nTry different initial guesses.",
+                    solverFailureName(solver->failure), solver->n);
+            break;
+    }
+}
+
+// Format one iteration into the table; its f values seed the cache and the
+// first few are kept for the graph
+static void storeIteration(IterationTable* table, const RootProblem* problem, int n, const double* v) {
+    int row = tableAppendRow(table);
+    if (row < 0) return;
+    
+    evalCacheStore(&evalCache, problem, v[0], v[2]);
+    evalCacheStore(&evalCache, problem, v[1], v[3]);
+    
+    if (iterationCount < GRAPH_ITERATIONS) {
+        IterationData* it = &iterations[iterationCount];
+        it->n = n;
+        it->x_prev = v[0];
+        it->x_curr = v[1];
+        it->f_prev = v[2];
+        it->f_curr = v[3];
+        it->x_next = v[4];
+        it->error = v[5];
+    }
+    iterationCount++;
+    
+    tableSetCell(table, row, 0, "%d", n);
+    tableSetCell(table, row, 1, "%.6f", v[0]);
+    tableSetCell(table, row, 2, "%.6f", v[1]);
+    tableSetCell(table, row, 3, "%.6f", v[2]);
+    tableSetCell(table, row, 4, "%.6f", v[3]);
+    tableSetCell(table, row, 5, "%.6f", v[4]);
+    tableSetCell(table, row, 6, "%.8f", v[5]);
+}
+
+// Secant solve run on a worker thread
+// params: a, b, x0, x1; spec: stop rules; rows: x(n-1), x(n), f(x(n-1)), f(x(n)), x(n+1), error
+static void secantJob(SolveJob* job) {
+    RootProblem problem = {PROBLEM_EXPONENTIAL, job->params[0], job->params[1], 0};
+    RootSolver solver;
+    solverInit(&solver, SOLVER_SECANT, &problem, job->params[2], job->params[3], TOLERANCE, MAX_ITERATIONS);
+    stopPolicyParse(&solver.stop, job->spec);
+    
+    SessionTrace trace;
+    sessionTraceBegin(&trace, job->session, &solver);
+    
+    SolverRow row;
+    int status;
+    do {
+        status = solverStep(&solver, &row);
+        sessionTraceAdd(&trace, &row);
+        if (row.count && !solveJobRow(job, row.n, row.v, row.count)) {
+            sessionTraceFree(&trace);
+            solveJobFinish(job, SOLVE_CANCELLED, 0);
+            return;
+        }
+    } while (status == SOLVER_RUNNING);
+    sessionLogSolve(job->session, &solver, &trace);
     
-    // Determine range
-    double x_min = hasRoot ? root - 3 : -2;
-    double x_max = hasRoot ? root + 3 : 4;
+    describeResult(job->message, &solver);
+    solverFormatCost(job->detail, sizeof(job->detail), &solver.cost, "  |  ");
+    solveJobFinish(job, status == SOLVER_CONVERGED ? SOLVE_CONVERGED : SOLVE_FAILED, solver.root);
+}
+
+// Fit the graph to the default window, or to root +/- 3 once a root is known
+static void frameGraph(GraphView* view, double a, double b, double root, int centered) {
+    double x_min = centered ? root - 3 : -2;
+    double x_max = centered ? root + 3 : 4;
     double y_min = -5, y_max = 5;
     
     // Find y range
-    if (hasRoot) {
-        double testY = function(root, a, b);
+    if (centered) {
         for (double tx = x_min; tx <= x_max; tx += 0.5) {
             double ty = function(tx, a, b);
             if (ty < y_min && ty > -100) y_min = ty;
@@ -193,155 +273,193 @@ void drawGraph(SDL_Renderer* renderer, TTF_Font* fontSmall, double a, double b,
         y_max *= 1.2;
     }
     
-    double scaleX = graphW / (x_max - x_min);
-    double scaleY = graphH / (y_max - y_min);
+    graphViewFrame(view, x_min, x_max, y_min, y_max);
+}
+
+// Draw graph with function and convergence visualization
+// While a solve is being animated, showIterations draws the secant lines
+// gathered so far; root is then the current estimate
+static void drawGraph(DrawList* draw, TTF_Font* fontSmall, GraphView* view, RasterCanvas* marks,
+                      double a, double b, double root, int hasRoot, int showIterations) {
+    SDL_Renderer* renderer = draw->renderer;
+    int graphX = view->rect.x;
+    int graphY = view->rect.y;
+    int graphW = view->rect.w;
+    int graphH = view->rect.h;
     
-    int originX = graphX + (int)((-x_min) * scaleX);
-    int originY = graphY + graphH - (int)((-y_min) * scaleY);
+    // Background
+    drawListFillRect(draw, &view->rect, (SDL_Color){255, 252, 248, 255});
     
     // Grid
-    SDL_SetRenderDrawColor(renderer, 245, 230, 230, 255);
-    for (int gx = graphX; gx < graphX + graphW; gx += 40) {
-        SDL_RenderDrawLine(renderer, gx, graphY, gx, graphY + graphH);
-    }
-    for (int gy = graphY; gy < graphY + graphH; gy += 40) {
-        SDL_RenderDrawLine(renderer, graphX, gy, graphX + graphW, gy);
-    }
+    graphDrawGrid(draw, view, 40, (SDL_Color){245, 230, 230, 255});
     
     // Axes
-    SDL_SetRenderDrawColor(renderer, 100, 40, 40, 255);
-    if (originY >= graphY && originY <= graphY + graphH)
-        SDL_RenderDrawLine(renderer, graphX, originY, graphX + graphW, originY);
-    if (originX >= graphX && originX <= graphX + graphW)
-        SDL_RenderDrawLine(renderer, originX, graphY, originX, graphY + graphH);
-    
-    // Draw function curve
-    SDL_SetRenderDrawColor(renderer, 200, 50, 50, 255);
-    for (int px = 0; px < graphW - 1; px++) {
-        double x1 = x_min + (px / (double)graphW) * (x_max - x_min);
-        double x2 = x_min + ((px + 1) / (double)graphW) * (x_max - x_min);
-        double y1 = function(x1, a, b);
-        double y2 = function(x2, a, b);
-        
-        if (fabs(y1) < 100 && fabs(y2) < 100) {
-            int py1 = graphY + graphH - (int)((y1 - y_min) * scaleY);
-            int py2 = graphY + graphH - (int)((y2 - y_min) * scaleY);
-            
-            if (py1 >= graphY && py1 <= graphY + graphH && py2 >= graphY && py2 <= graphY + graphH) {
-                SDL_RenderDrawLine(renderer, graphX + px, py1, graphX + px + 1, py2);
-            }
-        }
+    graphDrawAxes(draw, view, (SDL_Color){100, 40, 40, 255});
+    drawListFlush(draw);
+    
+    // Function curve from the tile cache
+    RootProblem problem = {PROBLEM_EXPONENTIAL, a, b, 0};
+    graphViewSetProblem(view, &problem);
+    graphViewRender(renderer, view);
+    
+    // Secant lines, iteration points and the root, rasterized together and
+    // only again when the view or what they show changes
+    int shown = iterationCount > 0 && (hasRoot || showIterations) ?
+                (iterationCount < GRAPH_ITERATIONS ? iterationCount : GRAPH_ITERATIONS) : 0;
+    double key[48] = {view->cx, view->cy, graphPpuX(view), graphPpuY(view), root, hasRoot, shown};
+    for (int i = 0; i < shown; i++) {
+        key[8 + 4 * i] = iterations[i].x_prev;
+        key[9 + 4 * i] = iterations[i].f_prev;
+        key[10 + 4 * i] = iterations[i].x_curr;
+        key[11 + 4 * i] = iterations[i].f_curr;
     }
-    
-    // Draw secant lines for iterations
-    if (iterationCount > 0 && hasRoot) {
-        SDL_SetRenderDrawColor(renderer, 255, 150, 100, 150);
-        for (int i = 0; i < iterationCount && i < 8; i++) {
-            double x1 = iterations[i].x_prev;
-            double x2 = iterations[i].x_curr;
+    if (canvasBegin(marks, key, sizeof(key))) {
+        canvasClear(marks, 0);
+        double ox = 0.5 - graphX, oy = 0.5 - graphY;
+        
+        for (int i = 0; i < shown && i < 8; i++) {
             double y1 = iterations[i].f_prev;
             double y2 = iterations[i].f_curr;
-            
-            if (x1 >= x_min && x1 <= x_max && x2 >= x_min && x2 <= x_max) {
-                int px1 = graphX + (int)((x1 - x_min) * scaleX);
-                int py1 = graphY + graphH - (int)((y1 - y_min) * scaleY);
-                int px2 = graphX + (int)((x2 - x_min) * scaleX);
-                int py2 = graphY + graphH - (int)((y2 - y_min) * scaleY);
-                
-                if (py1 >= graphY && py1 <= graphY + graphH && py2 >= graphY && py2 <= graphY + graphH) {
-                    SDL_RenderDrawLine(renderer, px1, py1, px2, py2);
-                }
+            if (fabs(y1) < 1e6 && fabs(y2) < 1e6) {
+                canvasLine(marks, graphToScreenX(view, iterations[i].x_prev) + ox, graphToScreenY(view, y1) + oy,
+                           graphToScreenX(view, iterations[i].x_curr) + ox, graphToScreenY(view, y2) + oy,
+                           1, 0x96FF9664);
             }
         }
-    }
-    
-    // Draw iteration points
-    if (iterationCount > 0 && hasRoot) {
-        for (int i = 0; i < iterationCount && i < 10; i++) {
-            double x = iterations[i].x_curr;
+        
+        // Iteration points, from orange to red
+        for (int i = 0; i < shown; i++) {
             double y = iterations[i].f_curr;
-            
-            if (x >= x_min && x <= x_max && fabs(y) < 100) {
-                int px = graphX + (int)((x - x_min) * scaleX);
-                int py = graphY + graphH - (int)((y - y_min) * scaleY);
-                
-                if (px >= graphX && px < graphX + graphW && py >= graphY && py < graphY + graphH) {
-                    // Gradient from orange to red
-                    int r = 255 - (i * 15);
-                    int g = 150 - (i * 12);
-                    SDL_SetRenderDrawColor(renderer, r, g, 0, 255);
-                    
-                    for (int dx = -5; dx <= 5; dx++) {
-                        for (int dy = -5; dy <= 5; dy++) {
-                            if (dx*dx + dy*dy <= 25) {
-                                SDL_RenderDrawPoint(renderer, px + dx, py + dy);
-                            }
-                        }
-                    }
-                }
+            if (fabs(y) < 1e6) {
+                Uint32 color = 0xFF000000u | (Uint32)(255 - i * 15) << 16 | (Uint32)(150 - i * 12) << 8;
+                canvasDisc(marks, graphToScreenX(view, iterations[i].x_curr) + ox, graphToScreenY(view, y) + oy,
+                           5.5, color);
             }
         }
-    }
-    
-    // Root point
-    if (hasRoot) {
-        double rx = root;
-        double ry = function(rx, a, b);
         
-        if (rx >= x_min && rx <= x_max && fabs(ry) < 100) {
-            int px = graphX + (int)((rx - x_min) * scaleX);
-            int py = graphY + graphH - (int)((ry - y_min) * scaleY);
-            
-            if (px >= graphX && px < graphX + graphW && py >= graphY && py < graphY + graphH) {
-                // Glow effect
-                SDL_SetRenderDrawColor(renderer, 255, 200, 150, 255);
-                for (int r = 10; r > 6; r--) {
-                    for (int angle = 0; angle < 360; angle += 10) {
-                        int dx = (int)(r * cos(angle * M_PI / 180));
-                        int dy = (int)(r * sin(angle * M_PI / 180));
-                        SDL_RenderDrawPoint(renderer, px + dx, py + dy);
-                    }
-                }
-                
-                // Center dot
-                SDL_SetRenderDrawColor(renderer, 220, 20, 60, 255);
-                for (int dx = -6; dx <= 6; dx++) {
-                    for (int dy = -6; dy <= 6; dy++) {
-                        if (dx*dx + dy*dy <= 36) {
-                            SDL_RenderDrawPoint(renderer, px + dx, py + dy);
-                        }
-                    }
-                }
-            }
+        // Root point with its glow
+        double ry = function(root, a, b);
+        if (hasRoot && fabs(ry) < 1e6) {
+            double px = graphToScreenX(view, root) + ox, py = graphToScreenY(view, ry) + oy;
+            canvasRing(marks, px, py, 7, 10, 0xFFFFC896);
+            canvasDisc(marks, px, py, 6.5, 0xFFDC143C);
         }
     }
+    canvasRender(renderer, marks, graphX, graphY);
     
-    // Labels
-    renderText(renderer, fontSmall, "y", originX + 8, graphY + 5, (SDL_Color){100, 40, 40, 255});
-    renderText(renderer, fontSmall, "x", graphX + graphW - 15, originY + 5, (SDL_Color){100, 40, 40, 255});
-    renderTextBold(renderer, fontSmall, "f(x) = e^x - ax - b", graphX + 15, graphY + 15, (SDL_Color){200, 50, 50, 255});
+    // Border
+    drawPanel(draw, graphX, graphY, graphW, graphH, 
+              (SDL_Color){255, 252, 248, 0}, (SDL_Color){180, 80, 80, 255}, 2);
+    
+    // Labels, pinned to the border while the axis is out of view
+    int originX = (int)lround(graphToScreenX(view, 0));
+    int originY = (int)lround(graphToScreenY(view, 0));
+    if (originX < graphX) originX = graphX;
+    if (originX > graphX + graphW - 20) originX = graphX + graphW - 20;
+    if (originY < graphY) originY = graphY;
+    if (originY > graphY + graphH - 25) originY = graphY + graphH - 25;
+    renderText(draw, fontSmall, "y", originX + 8, graphY + 5, (SDL_Color){100, 40, 40, 255});
+    renderText(draw, fontSmall, "x", graphX + graphW - 15, originY + 5, (SDL_Color){100, 40, 40, 255});
+    renderTextBold(draw, fontSmall, "f(x) = e^x - ax - b", graphX + 15, graphY + 15, (SDL_Color){200, 50, 50, 255});
 }
 
-int main(int argc, char* argv[]) {
-    SDL_Init(SDL_INIT_VIDEO);
-    TTF_Init();
+// Static layer: background, banner, credits, panel frames and the method
+// explanation. Nothing here depends on state, so it is drawn once into the
+// chrome texture and copied each frame.
+static void drawChrome(DrawList* draw, TTF_Font* fontTitle, TTF_Font* fontLarge, TTF_Font* fontMedium,
+                       TTF_Font* font, TTF_Font* fontSmall) {
+    SDL_Color bgMain = {255, 248, 245, 255};
+    SDL_SetRenderDrawColor(draw->renderer, bgMain.r, bgMain.g, bgMain.b, bgMain.a);
+    hudRenderClear(draw->renderer);
+    
+    // ---- TOP BANNER ----
+    SDL_Rect banner = {0, 0, WINDOW_WIDTH, 80};
+    drawListFillRect(draw, &banner, (SDL_Color){190, 50, 50, 255});
+    
+    // Gradient effect
+    for (int i = 0; i < 5; i++) {
+        drawListLine(draw, 0, i, WINDOW_WIDTH, i, (SDL_Color){220 - i * 10, 60 - i * 5, 60 - i * 5, 255});
+    }
+    for (int i = 0; i < 5; i++) {
+        drawListLine(draw, 0, 75 + i, WINDOW_WIDTH, 75 + i, (SDL_Color){160 + i * 6, 40 + i * 2, 40 + i * 2, 255});
+    }
+    
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color lightPink = {255, 220, 220, 255};
+    
+    renderTextBold(draw, fontTitle, "SECANT METHOD", 50, 15, white);
+    renderText(draw, fontLarge, "for Exponential Equations", 50, 48, lightPink);
     
-    SDL_Window* window = SDL_CreateWindow("Secant Method - Exponential Equations",
-        SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
-        WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_SHOWN);
+    renderText(draw, fontSmall, "MT211 - Numerical Methods  |  Semestral Project", 950, 12, lightPink);
+    renderText(draw, font, "BSCPE 22001", 1050, 36, white);
+    renderText(draw, fontSmall, "Jayboy Acilo  |  Billy Jay Penalba", 1028, 60, lightPink);
     
-    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    // ---- LEFT PANEL: Input & Graph ----
+    drawPanel(draw, 25, 95, 700, 830, (SDL_Color){255, 252, 250, 255}, 
+              (SDL_Color){180, 80, 80, 255}, 2);
+    
+    SDL_Color sectionColor = {140, 30, 30, 255};
+    SDL_Color hintColor = {150, 90, 90, 255};
+    
+    // Method explanation box
+    drawPanel(draw, 40, 110, 670, 105, (SDL_Color){255, 245, 245, 255}, 
+              (SDL_Color){220, 120, 120, 255}, 1);
+    
+    renderTextBold(draw, fontMedium, "HOW IT WORKS:", 55, 118, sectionColor);
+    renderText(draw, fontSmall, "The Secant Method finds roots using two initial points without", 55, 143, hintColor);
+    renderText(draw, fontSmall, "calculating derivatives. It draws secant lines between points to", 55, 163, hintColor);
+    renderText(draw, fontSmall, "converge to the root. Formula:", 55, 183, hintColor);
+    renderTextBold(draw, font, "x(n+1) = x(n) - f(x(n)) * [x(n) - x(n-1)] / [f(x(n)) - f(x(n-1))]", 255, 183, (SDL_Color){180, 40, 40, 255});
+    
+    // ---- RIGHT PANEL: Results ----
+    drawPanel(draw, 740, 95, 735, 830, (SDL_Color){255, 252, 250, 255}, 
+              (SDL_Color){180, 80, 80, 255}, 2);
+    
+    renderTextBold(draw, fontLarge, "ITERATION TABLE", 1000, 110, sectionColor);
+}
+    
+// Render the static layer into the target texture.
+// Returns 0 if render targets are unsupported; the caller then draws it directly.
+static int buildChrome(DrawList* draw, SDL_Texture* chrome, TTF_Font* fontTitle, TTF_Font* fontLarge,
+                       TTF_Font* fontMedium, TTF_Font* font, TTF_Font* fontSmall) {
+    drawListFlush(draw);
+    if (!chrome || SDL_SetRenderTarget(draw->renderer, chrome) != 0) return 0;
+    SDL_SetTextureBlendMode(chrome, SDL_BLENDMODE_NONE);   // opaque, a plain copy
+    drawChrome(draw, fontTitle, fontLarge, fontMedium, font, fontSmall);
+    drawListFlush(draw);
+    SDL_SetRenderTarget(draw->renderer, NULL);
+    return 1;
+}
+
+static void secantStateFree(void* state) {
+    SecantState* saved = state;
+    if (saved->saved) tableFree(&saved->table);
+}
+
+int secantRun(AppHost* host) {
+    SDL_Renderer* renderer = host->renderer;
+    DrawList* draw = &host->draw;
+    evalCacheInit(&evalCache);
+    
+    // Static chrome layer, rebuilt whenever chromeValid is cleared
+    SDL_Texture* chrome = NULL;
+    if (SDL_RenderTargetSupported(renderer)) {
+        chrome = hudCreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                   WINDOW_WIDTH, WINDOW_HEIGHT);
+    }
+    int chromeValid = 0;
     
     // Load fonts
-    TTF_Font* fontTitle = TTF_OpenFont("font.ttf", 28);
-    TTF_Font* fontLarge = TTF_OpenFont("font.ttf", 20);
-    TTF_Font* fontMedium = TTF_OpenFont("font.ttf", 18);
-    TTF_Font* font = TTF_OpenFont("font.ttf", 16);
-    TTF_Font* fontSmall = TTF_OpenFont("font.ttf", 14);
-    TTF_Font* fontTiny = TTF_OpenFont("font.ttf", 13);
-    
-    if (!fontTitle || !fontLarge || !fontMedium || !font || !fontSmall || !fontTiny) {
-        printf("Error loading font: %s\n", TTF_GetError());
+    TTF_Font* fontTitle = appHostFont(host, 28);
+    TTF_Font* fontLarge = appHostFont(host, 20);
+    TTF_Font* fontMedium = appHostFont(host, 18);
+    TTF_Font* font = appHostFont(host, 16);
+    TTF_Font* fontSmall = appHostFont(host, 14);
+    TTF_Font* fontTiny = appHostFont(host, 13);
+    
+    SecantState* saved = appHostTabState(host, sizeof(SecantState), secantStateFree);
+    if (!fontTitle || !fontLarge || !fontMedium || !font || !fontSmall || !fontTiny || !saved) {
+        if (chrome) SDL_DestroyTexture(chrome);
         return 1;
     }
     
@@ -357,12 +475,28 @@ int main(int argc, char* argv[]) {
     for (int i = 0; i < 4; i++) {
         inputs[i].rect = (SDL_Rect){60 + (i % 2) * 290, 250 + (i / 2) * 90, 240, 40};
         strcpy(inputs[i].label, labels[i]);
-        strcpy(inputs[i].value, "");
+        strcpy(inputs[i].value, saved->saved ? saved->values[i] : "");
         inputs[i].active = 0;
     }
     
+    // Inputs handed over by another tab, e.g. a cell picked in the sweep
+    for (int i = 0; i < 4; i++) {
+        appHostPreset(host, i, inputs[i].value, sizeof(inputs[i].value));
+    }
+    
     Button computeBtn = {{230, 450, 180, 50}, "COMPUTE", 0, 0};
     Button clearBtn = {{440, 450, 180, 50}, "CLEAR", 0, 0};
+    Button animateBtn = {{40, 450, 170, 50}, "ANIMATE", 0, 0};
+    
+    // Iteration table (rows formatted once per solve)
+    const int tableColumns[] = {12, 45, 160, 275, 395, 510, 615};
+    IterationTable table;
+    if (saved->saved) {
+        table = saved->table;
+    } else {
+        tableInit(&table, fontTiny, 705, 22, 5, 7, tableColumns, (SDL_Color){80, 30, 30, 255},
+                  (SDL_Color){255, 250, 250, 255}, (SDL_Color){255, 245, 245, 255});
+    }
     
     // State variables
     int activeInput = -1;
@@ -370,16 +504,81 @@ int main(int argc, char* argv[]) {
     double root = 0;
     double a_val = 0, b_val = 0;
     char statusMsg[300] = "Ready to compute. Enter values and press COMPUTE.";
+    char costText[160] = "";
     int statusSuccess = 0;
     int scrollOffset = 0;
     
+    // Root polished to ~30 digits in double-double, toggled with F4
+    RootProblemDD precise;
+    int preciseOk = 0;
+    int polishMode = 0;
+    char polishText[128] = "";
+    
+    // Back on this tab: show what it showed when the user left
+    if (saved->saved) {
+        strcpy(statusMsg, saved->statusMsg);
+        strcpy(costText, saved->costText);
+        statusSuccess = saved->statusSuccess;
+        hasResult = saved->hasResult;
+        root = saved->root;
+        a_val = saved->a_val;
+        b_val = saved->b_val;
+        scrollOffset = saved->scrollOffset;
+        precise = saved->precise;
+        preciseOk = saved->preciseOk;
+        polishMode = saved->polishMode;
+        strcpy(polishText, saved->polishText);
+    }
+    
+    // Solves run on the host's worker pool and stream their rows back,
+    // with this tab's stop rules (F6)
+    SolveWorkerPool* pool = &host->pool;
+    appHostUseStopRules(host);
+    SolveJob* activeJob = NULL;
+    
+    // Pannable graph; curve tiles are rasterized on a background thread
+    GraphView graphView;
+    graphViewInit(&graphView, (SDL_Rect){40, 540, 660, 360}, (SDL_Color){200, 50, 50, 255}, 1);
+    frameGraph(&graphView, a_val, b_val, root, hasResult);
+    RasterCanvas markCanvas;
+    canvasInit(&markCanvas, renderer, graphView.rect.w, graphView.rect.h);
+    
+    // Frame timing overlay, toggled with F3
+    FrameHud hud;
+    hudInit(&hud);
+    
+    // Animated solve: stepped on this thread, one iteration per tick
+    RootSolver animSolver;
+    SessionTrace animTrace;
+    memset(&animTrace, 0, sizeof(animTrace));
+    int animating = 0;
+    int animPaused = 0;
+    int stepRequested = 0;
+    Uint32 lastStepTicks = 0;
+    
     int quit = 0;
     SDL_Event e;
     
-    while (!quit) {
-        while (SDL_PollEvent(&e)) {
+    while (!quit && !appHostSwitching(host)) {
+        hudBeginFrame(&hud);
+        
+        while (appHostPollEvent(host, &e)) {
+            if (appHostEvent(host, &e)) continue;
+            if (graphViewHandleEvent(&graphView, &e)) continue;
             if (e.type == SDL_QUIT) quit = 1;
             
+            // Target contents are lost on reset (the texture itself on a
+            // device reset); redraw the chrome
+            if (e.type == SDL_RENDER_DEVICE_RESET && chrome) {
+                SDL_DestroyTexture(chrome);
+                chrome = hudCreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                           WINDOW_WIDTH, WINDOW_HEIGHT);
+            }
+            if (e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET ||
+                (e.type == SDL_WINDOWEVENT && e.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)) {
+                chromeValid = 0;
+            }
+            
             if (e.type == SDL_MOUSEBUTTONDOWN) {
                 int mx = e.button.x;
                 int my = e.button.y;
@@ -393,71 +592,90 @@ int main(int argc, char* argv[]) {
                     inputs[i].active = (i == activeInput);
                 }
                 
-                // Compute button
+                // Compute button (doubles as CANCEL while a solve is running)
                 if (mx >= computeBtn.rect.x && mx <= computeBtn.rect.x + computeBtn.rect.w &&
                     my >= computeBtn.rect.y && my <= computeBtn.rect.y + computeBtn.rect.h) {
                     computeBtn.clicked = 1;
                     
-                    a_val = atof(inputs[0].value);
-                    b_val = atof(inputs[1].value);
-                    double x0 = atof(inputs[2].value);
-                    double x1 = atof(inputs[3].value);
-                    
-                    hasResult = 0;
-                    iterationCount = 0;
-                    statusSuccess = 0;
-                    
-                    // Validation
-                    if (fabs(x1 - x0) < 1e-10) {
-                        sprintf(statusMsg, "ERROR: x0 and x1 must be different!\nPlease choose two distinct initial guesses.");
+                    if (activeJob) {
+                        solveJobCancel(activeJob);
+                        solveJobRelease(activeJob);
+                        activeJob = NULL;
+                        strcpy(computeBtn.text, "COMPUTE");
+                        sprintf(statusMsg, "Cancelled after %d iterations.\nPress COMPUTE to start again.", iterationCount);
                     } else {
-                        double x_prev = x0;
-                        double x_curr = x1;
-                        double f_prev = function(x_prev, a_val, b_val);
-                        double f_curr = function(x_curr, a_val, b_val);
-                        int converged = 0;
+                        animating = 0;
+                        sessionTraceFree(&animTrace);
+                        strcpy(animateBtn.text, "ANIMATE");
                         
-                        for (int iter = 0; iter < MAX_ITERATIONS; iter++) {
-                            double denominator = f_curr - f_prev;
-                            
-                            if (fabs(denominator) < 1e-10) {
-                                sprintf(statusMsg, "ERROR: Division by zero at iteration %d\nf(x%d) = f(x%d), cannot continue.", 
-                                        iter + 1, iter, iter + 1);
-                                break;
-                            }
-                            
-                            double x_next = x_curr - f_curr * (x_curr - x_prev) / denominator;
-                            double error = fabs(x_next - x_curr);
-                            
-                            // Store iteration
-                            iterations[iterationCount].n = iter + 1;
-                            iterations[iterationCount].x_prev = x_prev;
-                            iterations[iterationCount].x_curr = x_curr;
-                            iterations[iterationCount].f_prev = f_prev;
-                            iterations[iterationCount].f_curr = f_curr;
-                            iterations[iterationCount].x_next = x_next;
-                            iterations[iterationCount].error = error;
-                            iterationCount++;
-                            
-                            if (error < TOLERANCE || fabs(function(x_next, a_val, b_val)) < TOLERANCE) {
-                                root = x_next;
-                                hasResult = 1;
-                                statusSuccess = 1;
-                                sprintf(statusMsg, "SUCCESS! Converged in %d iterations.\nApproximate root: x = %.3f", 
-                                        iterationCount, root);
-                                converged = 1;
-                                break;
+                        a_val = atof(inputs[0].value);
+                        b_val = atof(inputs[1].value);
+                        preciseOk = polishProblemParse(&precise, PROBLEM_EXPONENTIAL, inputs[0].value, inputs[1].value, NULL);
+                        double x0 = atof(inputs[2].value);
+                        double x1 = atof(inputs[3].value);
+                        
+                        hasResult = 0;
+                        iterationCount = 0;
+                        statusSuccess = 0;
+                        scrollOffset = 0;
+                        costText[0] = '\0';
+                        polishDescribe(polishText, sizeof(polishText), "  ", polishMode, NULL, 0, 0);
+                        tableClear(&table);
+                        
+                        // Validation
+                        if (fabs(x1 - x0) < 1e-10) {
+                            sprintf(statusMsg, "ERROR: x0 and x1 must be different!\nPlease choose two distinct initial guesses.");
+                        } else {
+                            activeJob = solveJobCreate(secantJob);
+                            if (activeJob) {
+                                activeJob->params[0] = a_val;
+                                activeJob->params[1] = b_val;
+                                activeJob->params[2] = x0;
+                                activeJob->params[3] = x1;
+                                snprintf(activeJob->spec, sizeof(activeJob->spec), "%s", appHostStopSpec(host));
+                                activeJob->session = &host->session;
+                                solvePoolSubmit(pool, activeJob);
+                                strcpy(computeBtn.text, "CANCEL");
+                                strcpy(statusMsg, "Solving...");
                             }
-                            
-                            x_prev = x_curr;
-                            x_curr = x_next;
-                            f_prev = f_curr;
-                            f_curr = function(x_curr, a_val, b_val);
                         }
+                    }
+                }
+                
+                // Animate button: start, then pause/resume
+                if (mx >= animateBtn.rect.x && mx <= animateBtn.rect.x + animateBtn.rect.w &&
+                    my >= animateBtn.rect.y && my <= animateBtn.rect.y + animateBtn.rect.h) {
+                    animateBtn.clicked = 1;
+                    
+                    if (animating) {
+                        animPaused = !animPaused;
+                        strcpy(animateBtn.text, animPaused ? "RESUME" : "PAUSE");
+                    } else if (!activeJob) {
+                        a_val = atof(inputs[0].value);
+                        b_val = atof(inputs[1].value);
+                        preciseOk = polishProblemParse(&precise, PROBLEM_EXPONENTIAL, inputs[0].value, inputs[1].value, NULL);
+                        double x0 = atof(inputs[2].value);
+                        double x1 = atof(inputs[3].value);
                         
-                        if (!converged && iterationCount > 0) {
-                            sprintf(statusMsg, "Did not converge in %d iterations.\nTry different initial guesses.", MAX_ITERATIONS);
-                        }
+                        hasResult = 0;
+                        iterationCount = 0;
+                        statusSuccess = 0;
+                        scrollOffset = 0;
+                        costText[0] = '\0';
+                        polishDescribe(polishText, sizeof(polishText), "  ", polishMode, NULL, 0, 0);
+                        tableClear(&table);
+                        
+                        RootProblem problem = {PROBLEM_EXPONENTIAL, a_val, b_val, 0};
+                        solverInit(&animSolver, SOLVER_SECANT, &problem, x0, x1, TOLERANCE, MAX_ITERATIONS);
+                        stopPolicyParse(&animSolver.stop, appHostStopSpec(host));
+                        animSolver.cache = &evalCache;
+                        sessionTraceFree(&animTrace);
+                        sessionTraceBegin(&animTrace, &host->session, &animSolver);
+                        frameGraph(&graphView, a_val, b_val, x1, 1);
+                        animating = 1;
+                        animPaused = 0;
+                        stepRequested = 1;
+                        strcpy(animateBtn.text, "PAUSE");
                     }
                 }
                 
@@ -465,18 +683,32 @@ int main(int argc, char* argv[]) {
                 if (mx >= clearBtn.rect.x && mx <= clearBtn.rect.x + clearBtn.rect.w &&
                     my >= clearBtn.rect.y && my <= clearBtn.rect.y + clearBtn.rect.h) {
                     clearBtn.clicked = 1;
+                    if (activeJob) {
+                        solveJobCancel(activeJob);
+                        solveJobRelease(activeJob);
+                        activeJob = NULL;
+                        strcpy(computeBtn.text, "COMPUTE");
+                    }
+                    animating = 0;
+                    sessionTraceFree(&animTrace);
+                    strcpy(animateBtn.text, "ANIMATE");
                     for (int i = 0; i < 4; i++) strcpy(inputs[i].value, "");
                     strcpy(statusMsg, "Ready to compute. Enter values and press COMPUTE.");
                     hasResult = 0;
                     iterationCount = 0;
                     statusSuccess = 0;
                     scrollOffset = 0;
+                    costText[0] = '\0';
+                    polishDescribe(polishText, sizeof(polishText), "  ", polishMode, NULL, 0, 0);
+                    tableClear(&table);
+                    frameGraph(&graphView, 0, 0, 0, 0);
                 }
             }
             
             if (e.type == SDL_MOUSEBUTTONUP) {
                 computeBtn.clicked = 0;
                 clearBtn.clicked = 0;
+                animateBtn.clicked = 0;
             }
             
             if (e.type == SDL_MOUSEMOTION) {
@@ -486,6 +718,8 @@ int main(int argc, char* argv[]) {
                                      my >= computeBtn.rect.y && my <= computeBtn.rect.y + computeBtn.rect.h);
                 clearBtn.hovered = (mx >= clearBtn.rect.x && mx <= clearBtn.rect.x + clearBtn.rect.w &&
                                    my >= clearBtn.rect.y && my <= clearBtn.rect.y + clearBtn.rect.h);
+                animateBtn.hovered = (mx >= animateBtn.rect.x && mx <= animateBtn.rect.x + animateBtn.rect.w &&
+                                     my >= animateBtn.rect.y && my <= animateBtn.rect.y + animateBtn.rect.h);
             }
             
             if (e.type == SDL_MOUSEWHEEL) {
@@ -505,65 +739,112 @@ int main(int argc, char* argv[]) {
                 }
             }
             
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F3) {
+                hudToggle(&hud);
+            }
+            
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F4) {
+                polishMode = !polishMode;
+                polishDescribe(polishText, sizeof(polishText), "  ", polishMode,
+                               preciseOk ? &precise : NULL, hasResult, root);
+            }
+            
             if (e.type == SDL_KEYDOWN && activeInput >= 0) {
                 if (e.key.keysym.sym == SDLK_BACKSPACE) {
                     int len = strlen(inputs[activeInput].value);
                     if (len > 0) inputs[activeInput].value[len - 1] = '\0';
                 }
             }
+            
+            // Animation controls: SPACE pauses/resumes, N or RIGHT single-steps
+            if (e.type == SDL_KEYDOWN && activeInput < 0 && animating) {
+                if (e.key.keysym.sym == SDLK_SPACE) {
+                    animPaused = !animPaused;
+                    strcpy(animateBtn.text, animPaused ? "RESUME" : "PAUSE");
+                } else if (e.key.keysym.sym == SDLK_n || e.key.keysym.sym == SDLK_RIGHT) {
+                    animPaused = 1;
+                    stepRequested = 1;
+                    strcpy(animateBtn.text, "RESUME");
+                }
+            }
         }
         
-        // ==================== RENDER ====================
-        SDL_Color bgMain = {255, 248, 245, 255};
-        SDL_SetRenderDrawColor(renderer, bgMain.r, bgMain.g, bgMain.b, bgMain.a);
-        SDL_RenderClear(renderer);
-        
-        // ---- TOP BANNER ----
-        SDL_SetRenderDrawColor(renderer, 190, 50, 50, 255);
-        SDL_Rect banner = {0, 0, WINDOW_WIDTH, 80};
-        SDL_RenderFillRect(renderer, &banner);
+        hudPhase(&hud, HUD_SOLVE);
         
-        // Gradient effect
-        for (int i = 0; i < 5; i++) {
-            SDL_SetRenderDrawColor(renderer, 220 - i * 10, 60 - i * 5, 60 - i * 5, 255);
-            SDL_RenderDrawLine(renderer, 0, i, WINDOW_WIDTH, i);
-        }
-        for (int i = 0; i < 5; i++) {
-            SDL_SetRenderDrawColor(renderer, 160 + i * 6, 40 + i * 2, 40 + i * 2, 255);
-            SDL_RenderDrawLine(renderer, 0, 75 + i, WINDOW_WIDTH, 75 + i);
+        // ==================== ANIMATION ====================
+        if (animating && (stepRequested || (!animPaused && appHostTicks(host) - lastStepTicks >= ANIMATION_STEP_MS))) {
+            SolverRow row;
+            int status = solverStep(&animSolver, &row);
+            if (row.count) storeIteration(&table, &animSolver.problem, row.n, row.v);
+            sessionTraceAdd(&animTrace, &row);
+            
+            if (status != SOLVER_RUNNING) {
+                describeResult(statusMsg, &animSolver);
+                solverFormatCost(costText, sizeof(costText), &animSolver.cost, "  |  ");
+                if (status == SOLVER_CONVERGED) {
+                    root = animSolver.root;
+                    hasResult = 1;
+                    frameGraph(&graphView, a_val, b_val, root, 1);
+                    statusSuccess = 1;
+                }
+                polishDescribe(polishText, sizeof(polishText), "  ", polishMode,
+                               preciseOk ? &precise : NULL, hasResult, root);
+                sessionLogSolve(&host->session, &animSolver, &animTrace);
+                animating = 0;
+                strcpy(animateBtn.text, "ANIMATE");
+            } else {
+                sprintf(statusMsg, "%s iteration %d: x = %.6f\nSPACE pauses/resumes, N steps once.",
+                        animPaused ? "Paused at" : "Animating", animSolver.n, solverCurrentX(&animSolver));
+            }
+            stepRequested = 0;
+            lastStepTicks = appHostTicks(host);
         }
         
-        SDL_Color white = {255, 255, 255, 255};
-        SDL_Color lightPink = {255, 220, 220, 255};
-        
-        renderTextBold(renderer, fontTitle, "SECANT METHOD", 50, 15, white);
-        renderText(renderer, fontLarge, "for Exponential Equations", 50, 48, lightPink);
-        
-        renderText(renderer, fontSmall, "MT211 - Numerical Methods  |  Semestral Project", 950, 12, lightPink);
-        renderText(renderer, font, "BSCPE 22001", 1050, 36, white);
-        renderText(renderer, fontSmall, "Jayboy Acilo  |  Billy Jay Penalba", 1028, 60, lightPink);
+        // ==================== SOLVER RESULTS ====================
+        if (activeJob) {
+            SolveMessage msg;
+            RootProblem problem = {PROBLEM_EXPONENTIAL, a_val, b_val, 0};
+            int budget = SOLVE_DRAIN_BUDGET;
+            while (activeJob && budget-- > 0 && solveJobPop(activeJob, &msg)) {
+                if (msg.type == SOLVE_MSG_ROW) {
+                    storeIteration(&table, &problem, msg.n, msg.v);
+                    sprintf(statusMsg, "Solving... %d iterations so far.", iterationCount);
+                } else if (msg.type == SOLVE_MSG_DONE) {
+                    strcpy(statusMsg, activeJob->message);
+                    strcpy(costText, activeJob->detail);
+                    if (activeJob->status == SOLVE_CONVERGED) {
+                        root = activeJob->root;
+                        hasResult = 1;
+                        frameGraph(&graphView, a_val, b_val, root, 1);
+                        statusSuccess = 1;
+                    }
+                    polishDescribe(polishText, sizeof(polishText), "  ", polishMode,
+                                   preciseOk ? &precise : NULL, hasResult, root);
+                    solveJobRelease(activeJob);
+                    activeJob = NULL;
+                    strcpy(computeBtn.text, "COMPUTE");
+                }
+            }
+        }
         
-        // ---- LEFT PANEL: Input & Graph ----
-        drawPanel(renderer, 25, 95, 700, 830, (SDL_Color){255, 252, 250, 255}, 
-                  (SDL_Color){180, 80, 80, 255}, 2);
+        // ==================== RENDER ====================
+        hudPhase(&hud, HUD_TEXT);
+        if (!chromeValid) {
+            chromeValid = buildChrome(draw, chrome, fontTitle, fontLarge, fontMedium, font, fontSmall);
+        }
+        if (chromeValid) {
+            // Fixed size, like the other cached layers: NULL would stretch
+            // it over whatever viewport is current after a resize
+            SDL_Rect chromeRect = {0, 0, WINDOW_WIDTH, WINDOW_HEIGHT};
+            hudRenderCopy(renderer, chrome, NULL, &chromeRect);
+        } else {
+            drawChrome(draw, fontTitle, fontLarge, fontMedium, font, fontSmall);
+        }
         
-        SDL_Color sectionColor = {140, 30, 30, 255};
         SDL_Color hintColor = {150, 90, 90, 255};
         
-        // Method explanation box
-        drawPanel(renderer, 40, 110, 670, 105, (SDL_Color){255, 245, 245, 255}, 
-                  (SDL_Color){220, 120, 120, 255}, 1);
-        
-        renderTextBold(renderer, fontMedium, "HOW IT WORKS:", 55, 118, sectionColor);
-        renderText(renderer, fontSmall, "The Secant Method finds roots using two initial points without", 55, 143, hintColor);
-        renderText(renderer, fontSmall, "calculating derivatives. It draws secant lines between points to", 55, 163, hintColor);
-        renderText(renderer, fontSmall, "converge to the root. Formula:", 55, 183, hintColor);
-        renderTextBold(renderer, font, "x(n+1) = x(n) - f(x(n)) * [x(n) - x(n-1)] / [f(x(n)) - f(x(n-1))]", 255, 183, (SDL_Color){180, 40, 40, 255});
-        
-      
-        
         for (int i = 0; i < 4; i++) {
-            renderInputBox(renderer, font, &inputs[i]);
+            renderInputBox(draw, font, &inputs[i]);
         }
 
         // Live equation preview using current input values
@@ -584,26 +865,28 @@ int main(int argc, char* argv[]) {
         } else {
             strcpy(eqPreview, "Equation: e^x - a x - b = 0");
         }
-        renderTextBold(renderer, fontMedium, eqPreview, 60, 380, (SDL_Color){140, 30, 30, 255});
+        renderTextBold(draw, fontMedium, eqPreview, 60, 380, (SDL_Color){140, 30, 30, 255});
 
         // Hint text
-        renderText(renderer, fontTiny, "Note: x0 and x1 should be close to the expected root", 140, 410, hintColor);
+        renderText(draw, fontTiny, "Note: x0 and x1 should be close to the expected root", 140, 410, hintColor);
         
         // Buttons
-        renderButton(renderer, font, &computeBtn);
-        renderButton(renderer, font, &clearBtn);
+        renderButton(draw, font, &computeBtn);
+        renderButton(draw, font, &clearBtn);
+        renderButton(draw, font, &animateBtn);
         
         // Status box
-        drawPanel(renderer, 40, 515, 670, 10, (SDL_Color){255, 245, 240, 255}, 
+        drawPanel(draw, 40, 515, 670, 10, (SDL_Color){255, 245, 240, 255}, 
                   (SDL_Color){200, 100, 100, 255}, 1);
         
+        SDL_Color statusFill;
         if (statusSuccess) {
-            SDL_SetRenderDrawColor(renderer, 220, 255, 220, 255);
+            statusFill = (SDL_Color){220, 255, 220, 255};
         } else {
-            SDL_SetRenderDrawColor(renderer, 255, 240, 240, 255);
+            statusFill = (SDL_Color){255, 240, 240, 255};
         }
         SDL_Rect statusBg = {40, 515, 670, 10};
-        SDL_RenderFillRect(renderer, &statusBg);
+        drawListFillRect(draw, &statusBg, statusFill);
         
         SDL_Color statusColor = statusSuccess ? (SDL_Color){0, 120, 0, 255} : (SDL_Color){180, 40, 40, 255};
         char statusCopy[300];
@@ -611,107 +894,127 @@ int main(int argc, char* argv[]) {
         char* line = strtok(statusCopy, "\n");
         int sy = 518;
         while (line) {
-            renderText(renderer, fontSmall, line, 55, sy, statusColor);
+            renderText(draw, fontSmall, line, 55, sy, statusColor);
             sy += 20;
             line = strtok(NULL, "\n");
         }
         
         // Graph
-        drawGraph(renderer, fontSmall, a_val, b_val, root, hasResult);
-        
-        // ---- RIGHT PANEL: Results ----
-        drawPanel(renderer, 740, 95, 735, 830, (SDL_Color){255, 252, 250, 255}, 
-                  (SDL_Color){180, 80, 80, 255}, 2);
+        hudPhase(&hud, HUD_GRAPH);
+        TRACE_SCOPE("drawGraph") {
+            if (animating) {
+                drawGraph(draw, fontSmall, &graphView, &markCanvas, a_val, b_val, solverCurrentX(&animSolver), 0, 1);
+            } else {
+                drawGraph(draw, fontSmall, &graphView, &markCanvas, a_val, b_val, root, hasResult, hasResult);
+            }
+        }
+        hudPhase(&hud, HUD_TEXT);
         
-        renderTextBold(renderer, fontLarge, "ITERATION TABLE", 1000, 110, sectionColor);
+        // Cost of the last solve, under the graph
+        if (costText[0]) {
+            renderText(draw, fontSmall, costText, 55, 903, hintColor);
+        }
+        if (polishText[0]) {
+            renderText(draw, fontSmall, polishText, 55, 923, hintColor);
+        }
         
+        // ---- RIGHT PANEL: Results ----
         if (iterationCount > 0) {
-            renderText(renderer, fontSmall, "(Scroll with mouse wheel to see all iterations)", 900, 135, hintColor);
+            renderText(draw, fontSmall, "(Scroll with mouse wheel to see all iterations)", 900, 135, hintColor);
             
             // Table header
             int tableX = 755;
             int tableY = 165;
             
-            drawPanel(renderer, tableX, tableY, 705, 30, (SDL_Color){200, 70, 70, 255}, 
+            drawPanel(draw, tableX, tableY, 705, 30, (SDL_Color){200, 70, 70, 255}, 
                       (SDL_Color){150, 40, 40, 255}, 1);
             
             SDL_Color headerColor = {255, 255, 255, 255};
-            renderTextBold(renderer, fontSmall, "n", tableX + 10, tableY + 8, headerColor);
-            renderTextBold(renderer, fontSmall, "x(n-1)", tableX + 50, tableY + 8, headerColor);
-            renderTextBold(renderer, fontSmall, "x(n)", tableX + 165, tableY + 8, headerColor);
-            renderTextBold(renderer, fontSmall, "f(x(n-1))", tableX + 280, tableY + 8, headerColor);
-            renderTextBold(renderer, fontSmall, "f(x(n))", tableX + 400, tableY + 8, headerColor);
-            renderTextBold(renderer, fontSmall, "x(n+1)", tableX + 515, tableY + 8, headerColor);
-            renderTextBold(renderer, fontSmall, "Error", tableX + 630, tableY + 8, headerColor);
+            renderTextBold(draw, fontSmall, "n", tableX + 10, tableY + 8, headerColor);
+            renderTextBold(draw, fontSmall, "x(n-1)", tableX + 50, tableY + 8, headerColor);
+            renderTextBold(draw, fontSmall, "x(n)", tableX + 165, tableY + 8, headerColor);
+            renderTextBold(draw, fontSmall, "f(x(n-1))", tableX + 280, tableY + 8, headerColor);
+            renderTextBold(draw, fontSmall, "f(x(n))", tableX + 400, tableY + 8, headerColor);
+            renderTextBold(draw, fontSmall, "x(n+1)", tableX + 515, tableY + 8, headerColor);
+            renderTextBold(draw, fontSmall, "Error", tableX + 630, tableY + 8, headerColor);
             
-            // Table rows
-            int rowY = tableY + 35;
+            // Table rows (only the visible window is blitted)
             int maxRows = 32;
-            int startIdx = scrollOffset / 22;
-            
-            for (int i = startIdx; i < iterationCount && i < startIdx + maxRows; i++) {
-                SDL_Color rowBg = (i % 2 == 0) ? (SDL_Color){255, 250, 250, 255} : (SDL_Color){255, 245, 245, 255};
-                SDL_SetRenderDrawColor(renderer, rowBg.r, rowBg.g, rowBg.b, rowBg.a);
-                SDL_Rect rowRect = {tableX, rowY, 705, 22};
-                SDL_RenderFillRect(renderer, &rowRect);
-                
-                SDL_Color textColor = {80, 30, 30, 255};
-                char buf[50];
-                
-                sprintf(buf, "%d", iterations[i].n);
-                renderText(renderer, fontTiny, buf, tableX + 12, rowY + 5, textColor);
-                
-                sprintf(buf, "%.6f", iterations[i].x_prev);
-                renderText(renderer, fontTiny, buf, tableX + 45, rowY + 5, textColor);
-                
-                sprintf(buf, "%.6f", iterations[i].x_curr);
-                renderText(renderer, fontTiny, buf, tableX + 160, rowY + 5, textColor);
-                
-                sprintf(buf, "%.6f", iterations[i].f_prev);
-                renderText(renderer, fontTiny, buf, tableX + 275, rowY + 5, textColor);
-                
-                sprintf(buf, "%.6f", iterations[i].f_curr);
-                renderText(renderer, fontTiny, buf, tableX + 395, rowY + 5, textColor);
-                
-                sprintf(buf, "%.6f", iterations[i].x_next);
-                renderText(renderer, fontTiny, buf, tableX + 510, rowY + 5, textColor);
-                
-                sprintf(buf, "%.8f", iterations[i].error);
-                renderText(renderer, fontTiny, buf, tableX + 615, rowY + 5, textColor);
-                
-                rowY += 22;
-            }
+            drawListFlush(draw);
+            tableRender(renderer, &table, tableX, tableY + 35, scrollOffset / 22, maxRows);
             
             // Final result box
             if (hasResult) {
                 int resultY = 880;
-                drawPanel(renderer, 755, resultY, 705, 35, (SDL_Color){230, 255, 230, 255}, 
+                drawPanel(draw, 755, resultY, 705, 35, (SDL_Color){230, 255, 230, 255}, 
                           (SDL_Color){100, 180, 100, 255}, 2);
                 
                 char resultText[200];
                 sprintf(resultText, "FINAL ROOT:  x = %.3f     |     f(x) = %.2e     |     Iterations: %d", 
                         root, function(root, a_val, b_val), iterationCount);
-                renderTextBold(renderer, font, resultText, 770, resultY + 9, (SDL_Color){0, 100, 0, 255});
+                renderTextBold(draw, font, resultText, 770, resultY + 9, (SDL_Color){0, 100, 0, 255});
             }
         } else {
-            renderText(renderer, fontMedium, "No iterations yet.", 1020, 400, hintColor);
-            renderText(renderer, font, "Enter values and press COMPUTE to see results.", 920, 440, hintColor);
+            renderText(draw, fontMedium, "No iterations yet.", 1020, 400, hintColor);
+            renderText(draw, font, "Enter values and press COMPUTE to see results.", 920, 440, hintColor);
         }
         
-        SDL_RenderPresent(renderer);
-        SDL_Delay(16);
+        appHostRenderTabs(host);
+        hudRender(renderer, fontSmall, &hud, WINDOW_WIDTH - 270, 10);
+        
+        hudPhase(&hud, HUD_PRESENT);
+        TRACE_SCOPE("SDL_RenderPresent") {
+            SDL_RenderPresent(renderer);
+        }
+        hudPhase(&hud, HUD_IDLE);
+        appHostEndFrame(host);
     }
     
-    TTF_CloseFont(fontTitle);
-    TTF_CloseFont(fontLarge);
-    TTF_CloseFont(fontMedium);
-    TTF_CloseFont(font);
-    TTF_CloseFont(fontSmall);
-    TTF_CloseFont(fontTiny);
-    SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
-    TTF_Quit();
-    SDL_Quit();
+    // A solve or animation still running is cancelled; everything else is
+    // kept for the next visit
+    if (activeJob) {
+        solveJobCancel(activeJob);
+        solveJobRelease(activeJob);
+    }
+    if (activeJob || animating) {
+        sprintf(statusMsg, "Cancelled after %d iterations.\nPress COMPUTE to start again.", iterationCount);
+    }
+    graphViewFree(&graphView);
+    canvasFree(&markCanvas);
+    sessionTraceFree(&animTrace);
+    if (chrome) SDL_DestroyTexture(chrome);
+    
+    for (int i = 0; i < 4; i++) {
+        strcpy(saved->values[i], inputs[i].value);
+    }
+    strcpy(saved->statusMsg, statusMsg);
+    strcpy(saved->costText, costText);
+    saved->statusSuccess = statusSuccess;
+    saved->hasResult = hasResult;
+    saved->root = root;
+    saved->a_val = a_val;
+    saved->b_val = b_val;
+    saved->scrollOffset = scrollOffset;
+    saved->precise = precise;
+    saved->preciseOk = preciseOk;
+    saved->polishMode = polishMode;
+    strcpy(saved->polishText, polishText);
+    saved->table = table;
+    saved->saved = 1;
     
     return 0;
 }
+
+#ifndef METHODS_SUITE
+int main(int argc, char* argv[]) {
+    AppHost host;
+    if (appHostInit(&host, "Secant Method - Exponential Equations", WINDOW_WIDTH, WINDOW_HEIGHT, NULL, 0) != 0) {
+        return 1;
+    }
+    
+    int result = secantRun(&host);
+    
+    appHostFree(&host);
+    return result;
+}
+#endif
@@ -0,0 +1,579 @@
+#ifndef SESSION_LOG_H
+#define SESSION_LOG_H
+
+#include <SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+#include "mapped_file.h"
+#include "root_solvers.h"
+
+#define SESSION_LOG_MAGIC "MTSL"
+#define SESSION_INDEX_MAGIC "MTSI"
+#define SESSION_LOG_VERSION 1
+#define SESSION_HEADER_SIZE 8
+#define SESSION_RECORD_SIZE 168     // fixed part of a solve record, before its rows
+#define SESSION_ENTRY_SIZE 32
+#define SESSION_TRAILER_SIZE 16
+#define SESSION_MAX_COLUMNS 6       // values in a SolverRow
+#define SESSION_FLAG_TRUNCATED 1    // memory ran out while the trace was recorded
+#define SESSION_LOG_MAX_SIZE ((Uint64)256 << 20)   // a bigger log is rotated to <path>.1 on open
+#define SESSION_LOG_KEEP 4         // rotated logs kept: <path>.1 (newest) to <path>.4
+
+// Solve history on disk.
+// Every finished solve is appended to a binary log: its inputs, stop
+// settings, outcome, cost counters and full iteration trace, so a session
+// can be looked at again instead of solved again. An old log is read
+// through a memory mapping. Opening it decodes only the index at the end
+// of the file, and a trace row is decoded from the mapping when it is
+// shown, so a solve of millions of iterations opens and scrolls as fast as
+// a short one.
+//
+// File, all numbers little-endian:
+//   header   "MTSL", version byte, 3 zero bytes
+//   records  one per solve: SESSION_RECORD_SIZE bytes laid out as in
+//            sessionEncodeRecord, then rows * columns doubles
+//   index    one SESSION_ENTRY_SIZE entry per solve (sessionEncodeEntry)
+//   trailer  u64 index offset, u32 solve count, "MTSI"
+// The index is written once, when the log is closed. While it is open,
+// solves are plain appends: the first one cuts off the old index, and a
+// reader (or a log cut short because the program died) finds no trailer
+// and recovers the index by walking the records by their sizes.
+
+// What the index keeps of a solve
+typedef struct {
+    Uint64 offset;          // of its record
+    Uint64 time;            // seconds since 1970 when it finished
+    double root;
+    int rows;
+    int columns;
+    int method;
+    int status;             // SOLVER_CONVERGED or SOLVER_FAILED
+} SessionEntry;
+
+// A solve decoded from a mapped log; its rows stay in the mapping
+typedef struct {
+    SolverMethod method;
+    RootProblem problem;
+    int form;
+    double x0, x1;          // starting points
+    StopPolicy stop;
+    int status;
+    int failure;
+    int flags;
+    double root;
+    SolverCost cost;
+    Uint64 time;
+    int rows;
+    int columns;
+    const unsigned char* data;
+} SessionSolve;
+
+// Appends solves; shared by every worker thread
+typedef struct SessionLog {
+    FILE* out;
+    SDL_mutex* lock;
+    SessionEntry* entries;
+    int count;
+    int capacity;
+    Uint64 end;             // end of the last record, where the index goes
+    int indexed;            // the file still ends with the index of every solve
+} SessionLog;
+
+// Reads a log through a mapping
+typedef struct {
+    MappedFile file;
+    SessionEntry* entries;
+    int count;
+    int recovered;          // the log had no valid trailer and was walked
+} SessionView;
+
+// The rows of one solve, gathered on the thread running it
+typedef struct {
+    int enabled;
+    int flags;
+    double x0, x1;
+    int columns;
+    size_t rows;
+    size_t capacity;
+    double* values;
+} SessionTrace;
+
+static inline void sessionPutU32(unsigned char* p, Uint32 v) {
+    for (int i = 0; i < 4; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+static inline void sessionPutU64(unsigned char* p, Uint64 v) {
+    for (int i = 0; i < 8; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+static inline void sessionPutF64(unsigned char* p, double v) {
+    Uint64 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    sessionPutU64(p, bits);
+}
+
+static inline Uint32 sessionGetU32(const unsigned char* p) {
+    Uint32 v = 0;
+    for (int i = 0; i < 4; i++) v |= (Uint32)p[i] << (8 * i);
+    return v;
+}
+
+static inline Uint64 sessionGetU64(const unsigned char* p) {
+    Uint64 v = 0;
+    for (int i = 0; i < 8; i++) v |= (Uint64)p[i] << (8 * i);
+    return v;
+}
+
+static inline double sessionGetF64(const unsigned char* p) {
+    Uint64 bits = sessionGetU64(p);
+    double v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+static inline int sessionSeek(FILE* f, Uint64 pos) {
+#ifdef _WIN32
+    return _fseeki64(f, (long long)pos, SEEK_SET);
+#else
+    return fseeko(f, (off_t)pos, SEEK_SET);
+#endif
+}
+
+// Cut the file at size; the stream position must be set again afterwards
+static inline int sessionTruncate(FILE* f, Uint64 size) {
+    fflush(f);
+#ifdef _WIN32
+    HANDLE handle = (HANDLE)_get_osfhandle(_fileno(f));
+    LARGE_INTEGER end;
+    end.QuadPart = (LONGLONG)size;
+    return SetFilePointerEx(handle, end, NULL, FILE_BEGIN) && SetEndOfFile(handle) ? 0 : -1;
+#else
+    return ftruncate(fileno(f), (off_t)size);
+#endif
+}
+
+static inline Uint64 sessionRecordSize(Uint64 rows, Uint64 columns) {
+    return SESSION_RECORD_SIZE + rows * columns * 8;
+}
+
+// Fixed part of a record: u64 record size, then method, family, form,
+// status, failure, columns, a reserved 0 and flags bytes, u64 time, the
+// problem and starting points, the stop policy, the root and the cost
+static inline void sessionEncodeRecord(unsigned char* p, const RootSolver* s, const SessionTrace* t,
+                                       Uint64 when) {
+    memset(p, 0, SESSION_RECORD_SIZE);
+    sessionPutU64(p, sessionRecordSize(t->rows, t->columns));
+    p[8] = (unsigned char)s->method;
+    p[9] = (unsigned char)s->problem.family;
+    p[10] = (unsigned char)s->form;
+    p[11] = (unsigned char)s->status;
+    p[12] = (unsigned char)s->failure;
+    p[13] = (unsigned char)t->columns;
+    p[15] = (unsigned char)t->flags;
+    sessionPutU64(p + 16, when);
+
+    sessionPutF64(p + 24, s->problem.a);
+    sessionPutF64(p + 32, s->problem.b);
+    sessionPutF64(p + 40, s->problem.c);
+    sessionPutF64(p + 48, t->x0);
+    sessionPutF64(p + 56, t->x1);
+
+    sessionPutU32(p + 64, s->stop.any);
+    sessionPutU32(p + 68, s->stop.all);
+    sessionPutF64(p + 72, s->stop.absStep);
+    sessionPutF64(p + 80, s->stop.relStep);
+    sessionPutF64(p + 88, s->stop.residual);
+    sessionPutU32(p + 96, (Uint32)s->stop.stagnation);
+    sessionPutU32(p + 100, (Uint32)s->stop.maxIter);
+    sessionPutF64(p + 104, s->stop.maxMs);
+    sessionPutF64(p + 112, s->root);
+
+    const SolverCost* c = &s->cost;
+    int counts[9] = {c->fEvals, c->dfEvals, c->gEvals, c->expCalls, c->logCalls,
+                     c->sqrtCalls, c->divisions, c->cacheHits, c->safeguards};
+    for (int i = 0; i < 9; i++) sessionPutU32(p + 120 + 4 * i, (Uint32)counts[i]);
+    sessionPutU32(p + 156, (Uint32)t->rows);
+    sessionPutU64(p + 160, c->ns);
+}
+
+// Index entry: u64 record offset, u64 time, f64 root, u32 rows, then
+// method, status and columns bytes
+static inline void sessionEncodeEntry(unsigned char* p, const SessionEntry* e) {
+    memset(p, 0, SESSION_ENTRY_SIZE);
+    sessionPutU64(p, e->offset);
+    sessionPutU64(p + 8, e->time);
+    sessionPutF64(p + 16, e->root);
+    sessionPutU32(p + 24, (Uint32)e->rows);
+    p[28] = (unsigned char)e->method;
+    p[29] = (unsigned char)e->status;
+    p[30] = (unsigned char)e->columns;
+}
+
+static inline void sessionDecodeEntry(const unsigned char* p, SessionEntry* e) {
+    e->offset = sessionGetU64(p);
+    e->time = sessionGetU64(p + 8);
+    e->root = sessionGetF64(p + 16);
+    e->rows = (int)sessionGetU32(p + 24);
+    e->method = p[28];
+    e->status = p[29];
+    e->columns = p[30];
+}
+
+// The entry of the record at offset, if a whole record of a consistent
+// size is there
+static inline int sessionRecordEntry(const unsigned char* data, Uint64 size, Uint64 offset, SessionEntry* e) {
+    if (offset < SESSION_HEADER_SIZE || offset > size || size - offset < SESSION_RECORD_SIZE) return 0;
+    const unsigned char* p = data + offset;
+    Uint64 rows = sessionGetU32(p + 156);
+    Uint64 recordSize = sessionGetU64(p);
+    if (p[13] > SESSION_MAX_COLUMNS || recordSize != sessionRecordSize(rows, p[13]) || recordSize > size - offset) {
+        return 0;
+    }
+
+    e->offset = offset;
+    e->time = sessionGetU64(p + 16);
+    e->root = sessionGetF64(p + 112);
+    e->rows = (int)rows;
+    e->columns = p[13];
+    e->method = p[8];
+    e->status = p[11];
+    return 1;
+}
+
+// Index of a log image: from its trailer, or by walking the records when
+// there is none. Returns 0 if it is not a session log, 1 if the trailer
+// was read and 2 if it was walked; *end is where the last record ends.
+static inline int sessionReadIndex(const unsigned char* data, Uint64 size, SessionEntry** entries,
+                                   int* count, Uint64* end) {
+    *entries = NULL;
+    *count = 0;
+    if (size < SESSION_HEADER_SIZE || memcmp(data, SESSION_LOG_MAGIC, 4) != 0 ||
+        data[4] != SESSION_LOG_VERSION) {
+        return 0;
+    }
+
+    if (size >= SESSION_HEADER_SIZE + SESSION_TRAILER_SIZE &&
+        memcmp(data + size - 4, SESSION_INDEX_MAGIC, 4) == 0) {
+        const unsigned char* trailer = data + size - SESSION_TRAILER_SIZE;
+        Uint64 indexOffset = sessionGetU64(trailer);
+        Uint64 n = sessionGetU32(trailer + 8);
+        if (indexOffset >= SESSION_HEADER_SIZE &&
+            indexOffset + n * SESSION_ENTRY_SIZE + SESSION_TRAILER_SIZE == size) {
+            *entries = (SessionEntry*)malloc((n ? n : 1) * sizeof(SessionEntry));
+            if (!*entries) return 0;
+            for (Uint64 i = 0; i < n; i++) {
+                sessionDecodeEntry(data + indexOffset + i * SESSION_ENTRY_SIZE, &(*entries)[i]);
+            }
+            *count = (int)n;
+            *end = indexOffset;
+            return 1;
+        }
+    }
+
+    int capacity = 0;
+    Uint64 pos = SESSION_HEADER_SIZE;
+    SessionEntry e;
+    while (sessionRecordEntry(data, size, pos, &e)) {
+        if (*count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            SessionEntry* grown = (SessionEntry*)realloc(*entries, capacity * sizeof(SessionEntry));
+            if (!grown) break;
+            *entries = grown;
+        }
+        (*entries)[(*count)++] = e;
+        pos += sessionRecordSize(e.rows, e.columns);
+    }
+    *end = pos;
+    return 2;
+}
+
+// Start gathering the trace of a solve right after solverInit; does
+// nothing when log is NULL or closed
+static inline void sessionTraceBegin(SessionTrace* t, const SessionLog* log, const RootSolver* s) {
+    memset(t, 0, sizeof(*t));
+    t->enabled = log && log->out;
+    t->x0 = s->x0;
+    t->x1 = s->x1;
+}
+
+static inline void sessionTraceAdd(SessionTrace* t, const SolverRow* row) {
+    if (!t->enabled || row->count == 0 || (t->flags & SESSION_FLAG_TRUNCATED)) return;
+    if (t->rows == 0) t->columns = row->count;
+
+    if (t->rows == t->capacity) {
+        size_t capacity = t->capacity ? t->capacity * 2 : 256;
+        double* values = (double*)realloc(t->values, capacity * t->columns * sizeof(double));
+        if (!values) {
+            t->flags |= SESSION_FLAG_TRUNCATED;
+            return;
+        }
+        t->values = values;
+        t->capacity = capacity;
+    }
+    double* dst = t->values + t->rows * t->columns;
+    for (int i = 0; i < t->columns; i++) {
+        dst[i] = i < row->count ? row->v[i] : 0;
+    }
+    t->rows++;
+}
+
+static inline void sessionTraceFree(SessionTrace* t) {
+    free(t->values);
+    memset(t, 0, sizeof(*t));
+}
+
+// Write the index and trailer at the current position
+static inline int sessionWriteIndex(SessionLog* log) {
+    unsigned char entry[SESSION_ENTRY_SIZE];
+    for (int i = 0; i < log->count; i++) {
+        sessionEncodeEntry(entry, &log->entries[i]);
+        if (fwrite(entry, 1, sizeof(entry), log->out) != sizeof(entry)) return 0;
+    }
+    unsigned char trailer[SESSION_TRAILER_SIZE];
+    sessionPutU64(trailer, log->end);
+    sessionPutU32(trailer + 8, (Uint32)log->count);
+    memcpy(trailer + 12, SESSION_INDEX_MAGIC, 4);
+    return fwrite(trailer, 1, sizeof(trailer), log->out) == sizeof(trailer);
+}
+
+// Move path to <path>.1, shifting the logs rotated before it up by one.
+// The last SESSION_LOG_KEEP logs are kept; the one past them is deleted,
+// and said so on stdout. Returns 0 on success.
+static inline int sessionLogRotate(const char* path) {
+    char from[1024], to[1024];
+    snprintf(to, sizeof(to), "%s.%d", path, SESSION_LOG_KEEP);
+    FILE* oldest = fopen(to, "rb");
+    if (oldest) {
+        fclose(oldest);
+        if (remove(to) != 0) return -1;
+        printf("Session log: deleted %s, the oldest of %d rotated logs\n", to, SESSION_LOG_KEEP);
+    }
+    for (int i = SESSION_LOG_KEEP - 1; i >= 1; i--) {
+        snprintf(from, sizeof(from), "%s.%d", path, i);
+        snprintf(to, sizeof(to), "%s.%d", path, i + 1);
+        FILE* f = fopen(from, "rb");
+        if (!f) continue;
+        fclose(f);
+        if (rename(from, to) != 0) return -1;
+    }
+    snprintf(to, sizeof(to), "%s.1", path);
+    return rename(path, to);
+}
+
+// Open a log for appending, creating it if missing. Fails rather than
+// overwrite a file that is not a session log. A log grown past
+// SESSION_LOG_MAX_SIZE is rotated to <path>.1 (sessionLogRotate), so the
+// last SESSION_LOG_KEEP full logs stay on disk, and a new log is started.
+// Returns 0 on success.
+static inline int sessionLogOpen(SessionLog* log, const char* path) {
+    memset(log, 0, sizeof(*log));
+
+    MappedFile old;
+    int found = 0;
+    if (mappedFileOpen(&old, path) == 0) {
+        found = sessionReadIndex(old.data, old.size, &log->entries, &log->count, &log->end);
+        int full = old.size > SESSION_LOG_MAX_SIZE;
+        mappedFileClose(&old);
+        if (!found) return -1;
+        log->capacity = log->count;
+        if (full) {
+            free(log->entries);
+            memset(log, 0, sizeof(*log));
+            if (sessionLogRotate(path) != 0) return -1;
+            found = 0;
+        }
+    }
+
+    log->out = fopen(path, found ? "r+b" : "w+b");
+    if (!log->out) {
+        free(log->entries);
+        memset(log, 0, sizeof(*log));
+        return -1;
+    }
+
+    // A walked log drops whatever follows its last whole record; an indexed
+    // one keeps its index until the first solve is appended
+    int ok = 1;
+    if (!found) {
+        unsigned char header[SESSION_HEADER_SIZE] = {'M', 'T', 'S', 'L', SESSION_LOG_VERSION, 0, 0, 0};
+        ok = fwrite(header, 1, sizeof(header), log->out) == sizeof(header) && fflush(log->out) == 0;
+        log->end = SESSION_HEADER_SIZE;
+    } else if (found == 2) {
+        ok = sessionTruncate(log->out, log->end) == 0 && sessionSeek(log->out, log->end) == 0;
+    }
+    log->indexed = found == 1;
+    log->lock = SDL_CreateMutex();
+    if (!ok || !log->lock) {
+        fclose(log->out);
+        if (log->lock) SDL_DestroyMutex(log->lock);
+        free(log->entries);
+        memset(log, 0, sizeof(*log));
+        return -1;
+    }
+    return 0;
+}
+
+// Append a finished solve and its trace, then free the trace. Callable
+// from any thread; a solve that cannot be written is dropped.
+static inline void sessionLogSolve(SessionLog* log, const RootSolver* s, SessionTrace* t) {
+    if (!log || !log->out || !t->enabled) {
+        sessionTraceFree(t);
+        return;
+    }
+
+    unsigned char record[SESSION_RECORD_SIZE];
+    Uint64 when = (Uint64)time(NULL);
+    sessionEncodeRecord(record, s, t, when);
+
+    SDL_LockMutex(log->lock);
+    if (log->count == log->capacity) {
+        int capacity = log->capacity ? log->capacity * 2 : 64;
+        SessionEntry* entries = (SessionEntry*)realloc(log->entries, capacity * sizeof(SessionEntry));
+        if (entries) {
+            log->entries = entries;
+            log->capacity = capacity;
+        }
+    }
+
+    // The stream is left at log->end, so a solve is one sequential write
+    // with no seek or flush; only the first cuts the old index off
+    int ok = log->count < log->capacity;
+    if (ok && log->indexed) {
+        ok = sessionTruncate(log->out, log->end) == 0 && sessionSeek(log->out, log->end) == 0;
+        log->indexed = !ok;
+    }
+    ok = ok && fwrite(record, 1, sizeof(record), log->out) == sizeof(record);
+
+    // Rows go out in chunks, each double encoded little-endian
+    unsigned char chunk[4096];
+    size_t used = 0;
+    size_t values = t->rows * t->columns;
+    for (size_t i = 0; ok && i < values; i++) {
+        sessionPutF64(chunk + used, t->values[i]);
+        used += 8;
+        if (used == sizeof(chunk) || i + 1 == values) {
+            ok = fwrite(chunk, 1, used, log->out) == used;
+            used = 0;
+        }
+    }
+
+    if (ok) {
+        SessionEntry* e = &log->entries[log->count++];
+        e->offset = log->end;
+        e->time = when;
+        e->root = s->root;
+        e->rows = (int)t->rows;
+        e->columns = t->columns;
+        e->method = s->method;
+        e->status = s->status;
+        log->end += sessionRecordSize(t->rows, t->columns);
+    }
+
+    // A partial record is written over by the next solve, or cut off at close
+    if (!ok && !log->indexed) sessionSeek(log->out, log->end);
+    SDL_UnlockMutex(log->lock);
+    sessionTraceFree(t);
+}
+
+// Push the solves appended so far out to the file, e.g. before mapping it
+// for reading in the same process
+static inline void sessionLogFlush(SessionLog* log) {
+    if (!log->out) return;
+    SDL_LockMutex(log->lock);
+    fflush(log->out);
+    SDL_UnlockMutex(log->lock);
+}
+
+// Write the index and close. Call once no solve can still be appending.
+static inline void sessionLogClose(SessionLog* log) {
+    if (log->out && !log->indexed && sessionSeek(log->out, log->end) == 0 && sessionWriteIndex(log)) {
+        Uint64 size = log->end + (Uint64)log->count * SESSION_ENTRY_SIZE + SESSION_TRAILER_SIZE;
+        sessionTruncate(log->out, size);
+    }
+    if (log->out) fclose(log->out);
+    if (log->lock) SDL_DestroyMutex(log->lock);
+    free(log->entries);
+    memset(log, 0, sizeof(*log));
+}
+
+// Map a log and read its index. Returns 0 on success.
+static inline int sessionViewOpen(SessionView* view, const char* path) {
+    memset(view, 0, sizeof(*view));
+    if (mappedFileOpen(&view->file, path) != 0) return -1;
+
+    Uint64 end;
+    int found = sessionReadIndex(view->file.data, view->file.size, &view->entries, &view->count, &end);
+    if (!found) {
+        mappedFileClose(&view->file);
+        return -1;
+    }
+    view->recovered = found == 2;
+    return 0;
+}
+
+static inline void sessionViewClose(SessionView* view) {
+    mappedFileClose(&view->file);
+    free(view->entries);
+    memset(view, 0, sizeof(*view));
+}
+
+// Decode solve i; returns 0 if its record is damaged
+static inline int sessionViewSolve(const SessionView* view, int i, SessionSolve* out) {
+    SessionEntry e;
+    if (i < 0 || i >= view->count ||
+        !sessionRecordEntry(view->file.data, view->file.size, view->entries[i].offset, &e)) {
+        return 0;
+    }
+
+    const unsigned char* p = view->file.data + e.offset;
+    memset(out, 0, sizeof(*out));
+    out->method = (SolverMethod)p[8];
+    out->problem.family = (ProblemFamily)p[9];
+    out->form = p[10];
+    out->status = p[11];
+    out->failure = p[12];
+    out->columns = p[13];
+    out->flags = p[15];
+    out->time = sessionGetU64(p + 16);
+
+    out->problem.a = sessionGetF64(p + 24);
+    out->problem.b = sessionGetF64(p + 32);
+    out->problem.c = sessionGetF64(p + 40);
+    out->x0 = sessionGetF64(p + 48);
+    out->x1 = sessionGetF64(p + 56);
+
+    out->stop.any = sessionGetU32(p + 64);
+    out->stop.all = sessionGetU32(p + 68);
+    out->stop.absStep = sessionGetF64(p + 72);
+    out->stop.relStep = sessionGetF64(p + 80);
+    out->stop.residual = sessionGetF64(p + 88);
+    out->stop.stagnation = (int)sessionGetU32(p + 96);
+    out->stop.maxIter = (int)sessionGetU32(p + 100);
+    out->stop.maxMs = sessionGetF64(p + 104);
+    out->root = sessionGetF64(p + 112);
+
+    SolverCost* c = &out->cost;
+    int* counts[9] = {&c->fEvals, &c->dfEvals, &c->gEvals, &c->expCalls, &c->logCalls,
+                      &c->sqrtCalls, &c->divisions, &c->cacheHits, &c->safeguards};
+    for (int k = 0; k < 9; k++) *counts[k] = (int)sessionGetU32(p + 120 + 4 * k);
+    out->rows = e.rows;
+    c->ns = sessionGetU64(p + 160);
+    out->data = p + SESSION_RECORD_SIZE;
+    return 1;
+}
+
+// Row r of a decoded solve into v[columns]; only its page is touched
+static inline void sessionSolveRow(const SessionSolve* s, int r, double* v) {
+    const unsigned char* p = s->data + (size_t)r * s->columns * 8;
+    for (int i = 0; i < s->columns; i++) v[i] = sessionGetF64(p + 8 * i);
+}
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef SOLVE_WORKER_H
+#define SOLVE_WORKER_H
+
+#include <SDL.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SOLVE_QUEUE_CAPACITY 1024   // must be a power of two
+#define SOLVE_MAX_WORKERS 8
+#define SOLVE_DRAIN_BUDGET 4096     // messages consumed per frame at most
+
+// Messages streamed from a worker to the render loop
+enum { SOLVE_MSG_ROW, SOLVE_MSG_PROGRESS, SOLVE_MSG_DONE };
+
+// Final status of a job
+enum { SOLVE_RUNNING, SOLVE_CONVERGED, SOLVE_FAILED, SOLVE_CANCELLED };
+
+typedef struct {
+    int type;
+    int n;
+    double v[7];
+} SolveMessage;
+
+typedef struct SolveJob SolveJob;
+typedef void (*SolveJobFn)(SolveJob* job);
+
+// One background solve.
+// The worker is the only producer and the UI the only consumer of the ring,
+// so head/tail need no lock. The result fields are written by the worker
+// before SOLVE_MSG_DONE is published and read by the UI after it pops it.
+struct SolveJob {
+    SolveJobFn run;
+    double params[8];
+    int intParams[4];
+    void* data;             // optional shared input owned by the submitter
+    char spec[128];         // optional settings text copied at submit, e.g. stop rules
+    struct SessionLog* session;     // optional solve history to append the finished solve to
+    SolveJobFn drop;        // optional: undo what run would have for a job dropped unrun
+
+    SDL_atomic_t cancel;
+    SDL_atomic_t refs;
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+    SolveMessage ring[SOLVE_QUEUE_CAPACITY];
+
+    int status;
+    double root;
+    char message[300];
+    char detail[160];       // optional extra result line, e.g. the solve cost
+    double stats[8];        // optional numeric results, e.g. evaluation counts
+
+    SolveJob* next;
+};
+
+typedef struct {
+    SDL_Thread* threads[SOLVE_MAX_WORKERS];
+    int threadCount;
+    SDL_mutex* lock;
+    SDL_cond* wake;
+    SolveJob* pendingHead;
+    SolveJob* pendingTail;
+    int quit;
+} SolveWorkerPool;
+
+// Create a job holding one reference for the caller
+static inline SolveJob* solveJobCreate(SolveJobFn run) {
+    SolveJob* job = calloc(1, sizeof(SolveJob));
+    if (!job) return NULL;
+    job->run = run;
+    job->status = SOLVE_RUNNING;
+    SDL_AtomicSet(&job->refs, 1);
+    return job;
+}
+
+static inline void solveJobRelease(SolveJob* job) {
+    if (job && SDL_AtomicAdd(&job->refs, -1) == 1) {
+        free(job);
+    }
+}
+
+static inline void solveJobCancel(SolveJob* job) {
+    SDL_AtomicSet(&job->cancel, 1);
+}
+
+static inline int solveJobCancelled(SolveJob* job) {
+    return SDL_AtomicGet(&job->cancel) != 0;
+}
+
+// Producer side: returns 0 if the job was cancelled while waiting for room
+static inline int solveJobPush(SolveJob* job, const SolveMessage* msg) {
+    int tail = SDL_AtomicGet(&job->tail);
+    while (tail - SDL_AtomicGet(&job->head) >= SOLVE_QUEUE_CAPACITY) {
+        if (solveJobCancelled(job)) return 0;
+        SDL_Delay(1);
+    }
+    job->ring[tail & (SOLVE_QUEUE_CAPACITY - 1)] = *msg;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&job->tail, tail + 1);
+    return 1;
+}
+
+// Consumer side: returns 0 when the ring is empty
+static inline int solveJobPop(SolveJob* job, SolveMessage* msg) {
+    int head = SDL_AtomicGet(&job->head);
+    if (head == SDL_AtomicGet(&job->tail)) return 0;
+    SDL_MemoryBarrierAcquire();
+    *msg = job->ring[head & (SOLVE_QUEUE_CAPACITY - 1)];
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&job->head, head + 1);
+    return 1;
+}
+
+// Push one iteration row; returns 0 once the job should stop
+static inline int solveJobRow(SolveJob* job, int n, const double* values, int count) {
+    SolveMessage msg = {SOLVE_MSG_ROW, n, {0}};
+    for (int i = 0; i < count && i < 7; i++) msg.v[i] = values[i];
+    return solveJobPush(job, &msg) && !solveJobCancelled(job);
+}
+
+// Record the result and publish SOLVE_MSG_DONE
+static inline void solveJobFinish(SolveJob* job, int status, double root) {
+    job->status = solveJobCancelled(job) ? SOLVE_CANCELLED : status;
+    job->root = root;
+    SolveMessage msg = {SOLVE_MSG_DONE, 0, {0}};
+    solveJobPush(job, &msg);
+}
+
+// Finish a job without running it, letting it release what it holds
+static inline void solveJobDrop(SolveJob* job) {
+    solveJobCancel(job);
+    if (job->drop) job->drop(job);
+    solveJobFinish(job, SOLVE_CANCELLED, 0);
+}
+
+static inline int solveWorkerMain(void* data) {
+    SolveWorkerPool* pool = data;
+
+    for (;;) {
+        SDL_LockMutex(pool->lock);
+        while (!pool->quit && !pool->pendingHead) {
+            SDL_CondWait(pool->wake, pool->lock);
+        }
+        if (pool->quit) {
+            SDL_UnlockMutex(pool->lock);
+            return 0;
+        }
+        SolveJob* job = pool->pendingHead;
+        pool->pendingHead = job->next;
+        if (!pool->pendingHead) pool->pendingTail = NULL;
+        SDL_UnlockMutex(pool->lock);
+
+        if (solveJobCancelled(job)) {
+            solveJobDrop(job);
+        } else {
+            job->run(job);
+        }
+        solveJobRelease(job);
+    }
+}
+
+// Start the pool; threadCount <= 0 picks one worker per spare core
+static inline int solvePoolStart(SolveWorkerPool* pool, int threadCount) {
+    memset(pool, 0, sizeof(*pool));
+    if (threadCount <= 0) threadCount = SDL_GetCPUCount() - 1;
+    if (threadCount < 1) threadCount = 1;
+    if (threadCount > SOLVE_MAX_WORKERS) threadCount = SOLVE_MAX_WORKERS;
+
+    pool->lock = SDL_CreateMutex();
+    pool->wake = SDL_CreateCond();
+    if (!pool->lock || !pool->wake) return 0;
+
+    for (int i = 0; i < threadCount; i++) {
+        pool->threads[i] = SDL_CreateThread(solveWorkerMain, "solve-worker", pool);
+        if (!pool->threads[i]) break;
+        pool->threadCount++;
+    }
+    return pool->threadCount > 0;
+}
+
+// Queue a job; the pool takes its own reference
+static inline void solvePoolSubmit(SolveWorkerPool* pool, SolveJob* job) {
+    SDL_AtomicAdd(&job->refs, 1);
+    job->next = NULL;
+
+    SDL_LockMutex(pool->lock);
+    if (pool->pendingTail) {
+        pool->pendingTail->next = job;
+    } else {
+        pool->pendingHead = job;
+    }
+    pool->pendingTail = job;
+    SDL_CondSignal(pool->wake);
+    SDL_UnlockMutex(pool->lock);
+}
+
+// Stop all workers; jobs still queued are dropped through solveJobDrop
+static inline void solvePoolStop(SolveWorkerPool* pool) {
+    if (!pool->lock) return;
+
+    SDL_LockMutex(pool->lock);
+    pool->quit = 1;
+    SDL_CondBroadcast(pool->wake);
+    SDL_UnlockMutex(pool->lock);
+
+    for (int i = 0; i < pool->threadCount; i++) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+
+    while (pool->pendingHead) {
+        SolveJob* job = pool->pendingHead;
+        pool->pendingHead = job->next;
+        solveJobDrop(job);
+        solveJobRelease(job);
+    }
+
+    SDL_DestroyCond(pool->wake);
+    SDL_DestroyMutex(pool->lock);
+    memset(pool, 0, sizeof(*pool));
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef STOP_CRITERIA_H
+#define STOP_CRITERIA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// When a solve stops, as data rather than code.
+// A solve converges once any rule in `any` holds and every rule in `all`
+// holds as well; if a rule in `any` holds but one in `all` does not, the
+// estimate has settled somewhere that is not a root and the solve fails.
+// Stagnation and the two budgets end a solve as failed.
+
+#define STOP_SPEC_SIZE 128      // room for a spec string, terminator included
+
+enum {
+    STOP_ABS_STEP = 1 << 0,     // |x(n+1) - x(n)| < absStep
+    STOP_REL_STEP = 1 << 1,     // |x(n+1) - x(n)| < relStep * |x(n+1)|
+    STOP_RESIDUAL = 1 << 2      // |f(x(n+1))| < residual
+};
+
+typedef struct {
+    unsigned any;
+    unsigned all;
+    double absStep;
+    double relStep;
+    double residual;
+    int stagnation;             // fail after this many steps in a row that did not shrink; 0 = off
+    int maxIter;
+    double maxMs;               // solver time budget; 0 = none
+} StopPolicy;
+
+// Apply a spec of space or comma separated settings over a policy:
+//   abs=1e-8 rel=1e-12 res=1e-10   converge when any of these holds
+//   &res=1e-6                       and only if this holds as well
+//   stag=5 iter=200 ms=10           stagnation, iteration and time budgets
+// The first step or residual rule replaces the method's own rules. Each rule
+// has one threshold, so a rule named in both sets (res=1e-10 &res=1e-6) is
+// rejected rather than one value silently winning. Returns 0 and leaves the
+// policy untouched if the spec does not parse.
+static inline int stopPolicyParse(StopPolicy* p, const char* spec) {
+    if (!spec) return 1;
+    StopPolicy q = *p;
+    int replaced = 0;
+
+    const char* s = spec;
+    while (*s) {
+        if (*s == ' ' || *s == ',') {
+            s++;
+            continue;
+        }
+        int required = *s == '&';
+        if (required) s++;
+
+        const char* eq = strchr(s, '=');
+        if (!eq) return 0;
+        size_t len = (size_t)(eq - s);
+        char* end;
+        double value = strtod(eq + 1, &end);
+        if (end == eq + 1 || !(value >= 0)) return 0;
+
+        unsigned rule = 0;
+        if (len == 3 && !strncmp(s, "abs", 3)) {
+            rule = STOP_ABS_STEP;
+            q.absStep = value;
+        } else if (len == 3 && !strncmp(s, "rel", 3)) {
+            rule = STOP_REL_STEP;
+            q.relStep = value;
+        } else if (len == 3 && !strncmp(s, "res", 3)) {
+            rule = STOP_RESIDUAL;
+            q.residual = value;
+        } else if (len == 4 && !strncmp(s, "stag", 4) && !required) {
+            q.stagnation = (int)value;
+        } else if (len == 4 && !strncmp(s, "iter", 4) && !required && value >= 1) {
+            q.maxIter = (int)value;
+        } else if (len == 2 && !strncmp(s, "ms", 2) && !required) {
+            q.maxMs = value;
+        } else {
+            return 0;
+        }
+
+        if (rule) {
+            if (!replaced) {
+                q.any = q.all = 0;
+                replaced = 1;
+            }
+            if ((required ? q.any : q.all) & rule) return 0;
+            if (required) q.all |= rule;
+            else q.any |= rule;
+        }
+        s = end;
+        if (*s && *s != ' ' && *s != ',') return 0;
+    }
+
+    if (replaced && !q.any) return 0;   // required rules alone never fire
+    *p = q;
+    return 1;
+}
+
+// The policy as a spec stopPolicyParse reads back, e.g. "abs=1e-06 &res=0.1 iter=100"
+static inline void stopPolicyFormat(char* buffer, size_t size, const StopPolicy* p) {
+    static const char* names[] = {"abs", "rel", "res"};
+    double values[] = {p->absStep, p->relStep, p->residual};
+    size_t len = 0;
+    buffer[0] = '\0';
+    for (int pass = 0; pass < 2; pass++) {
+        unsigned rules = pass ? p->all : p->any;
+        for (int i = 0; i < 3; i++) {
+            if (!(rules & (1u << i)) || len >= size) continue;
+            len += snprintf(buffer + len, size - len, "%s%s=%g ", pass ? "&" : "", names[i], values[i]);
+        }
+    }
+    if (len < size && p->stagnation > 0) len += snprintf(buffer + len, size - len, "stag=%d ", p->stagnation);
+    if (len < size) len += snprintf(buffer + len, size - len, "iter=%d", p->maxIter);
+    if (len < size && p->maxMs > 0) snprintf(buffer + len, size - len, " ms=%g", p->maxMs);
+}
+
+#endif
@@ -0,0 +1,659 @@
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include "frame_hud.h"
+#include "trace_events.h"
+#include "app_host.h"
+#include "param_sweep.h"
+
+#define MAX_ITER 100
+#define TOLERANCE 0.0001
+#define WINDOW_WIDTH 1400
+#define WINDOW_HEIGHT 800
+#define SWEEP_INPUTS 8
+#define SWEEP_UPLOAD_MS 100         // heatmap refresh interval while a sweep runs
+
+// Parameter sweep: one solve per cell of an (a, b) grid, with c fixed for
+// the quadratic family, shown as a heatmap of the root, the iteration
+// count or the outcome. Clicking a cell opens it in its method's tab.
+
+enum { SHOW_ROOT, SHOW_ITERATIONS, SHOW_STATUS, SHOW_COUNT };
+
+static const char* methodNames[] = {"Secant", "Newton-Raphson", "False Position", "Fixed Point"};
+static const char* showNames[] = {"Root", "Iterations", "Status"};
+
+// Outcome colors, indexed by SweepCell.outcome
+static const SDL_Color outcomeColors[] = {
+    {230, 233, 240, 255},   // pending
+    {60, 170, 90, 255},     // converged
+    {120, 120, 120, 255},   // failed (no code)
+    {240, 150, 30, 255},    // zero divisor
+    {210, 50, 50, 255},     // diverged
+    {130, 60, 190, 255},    // no convergence
+    {70, 110, 170, 255},    // not bracketed
+    {150, 100, 60, 255},    // x0 = x1
+    {220, 110, 170, 255},   // bad residual
+    {190, 170, 60, 255},    // stagnated
+    {90, 170, 200, 255},    // out of time
+};
+#define OUTCOME_COLORS (int)(sizeof(outcomeColors) / sizeof(outcomeColors[0]))
+
+// UI component structures
+typedef struct {
+    SDL_Rect rect;
+    char label[50];
+    char value[50];
+    int active;
+} InputBox;
+
+typedef struct {
+    SDL_Rect rect;
+    char text[50];
+    int hovered;
+    int clicked;
+} Button;
+
+// What the tab shows, kept while the user is on other tabs (appHostTabState)
+typedef struct {
+    int saved;
+    char values[SWEEP_INPUTS][50];
+    int family, method, form, show;
+    SweepGrid* grid;        // the last sweep, cancelled if it was still running
+    char statusText[300];
+} SweepState;
+
+// Five-stop blue-green-yellow ramp, t in [0, 1]
+static Uint32 rampColor(double t) {
+    static const Uint8 stops[5][3] = {
+        {68, 1, 84}, {59, 82, 139}, {33, 145, 140}, {94, 201, 98}, {253, 231, 37}
+    };
+    if (!(t > 0)) t = 0;
+    if (t > 1) t = 1;
+    double s = t * 4;
+    int i = s >= 4 ? 3 : (int)s;
+    double f = s - i;
+    Uint32 r = (Uint32)(stops[i][0] + f * (stops[i + 1][0] - stops[i][0]));
+    Uint32 g = (Uint32)(stops[i][1] + f * (stops[i + 1][1] - stops[i][1]));
+    Uint32 b = (Uint32)(stops[i][2] + f * (stops[i + 1][2] - stops[i][2]));
+    return 0xFF000000u | (r << 16) | (g << 8) | b;
+}
+
+static Uint32 outcomeColor(int outcome) {
+    SDL_Color c = outcomeColors[outcome < OUTCOME_COLORS ? outcome : SWEEP_FAILED_BASE];
+    return 0xFF000000u | ((Uint32)c.r << 16) | ((Uint32)c.g << 8) | c.b;
+}
+
+// Value range of the converged cells for the ramp modes
+static void sweepRange(const SweepGrid* grid, int show, double* lo, double* hi) {
+    *lo = INFINITY;
+    *hi = -INFINITY;
+    int count = grid->cols * grid->rows;
+    for (int i = 0; i < count; i++) {
+        const SweepCell* cell = &grid->cells[i];
+        if (cell->outcome != SWEEP_CONVERGED) continue;
+        double v = show == SHOW_ROOT ? cell->root : cell->iterations;
+        if (v < *lo) *lo = v;
+        if (v > *hi) *hi = v;
+    }
+    if (*lo > *hi) {
+        *lo = 0;
+        *hi = 1;
+    }
+}
+
+// Write the grid into the streaming heatmap texture, b increasing upwards
+static void sweepUpload(SDL_Texture* texture, const SweepGrid* grid, int show, double lo, double hi) {
+    void* pixels;
+    int pitch;
+    if (SDL_LockTexture(texture, NULL, &pixels, &pitch) != 0) return;
+    
+    double scale = hi > lo ? 1.0 / (hi - lo) : 0;
+    Uint32 failed = outcomeColor(SWEEP_FAILED_BASE);
+    for (int row = 0; row < grid->rows; row++) {
+        Uint32* line = (Uint32*)((Uint8*)pixels + (size_t)(grid->rows - 1 - row) * pitch);
+        const SweepCell* cell = &grid->cells[(size_t)row * grid->cols];
+        for (int col = 0; col < grid->cols; col++, cell++) {
+            if (show == SHOW_STATUS || cell->outcome == SWEEP_PENDING) {
+                line[col] = outcomeColor(cell->outcome);
+            } else if (cell->outcome != SWEEP_CONVERGED) {
+                line[col] = failed;
+            } else {
+                double v = show == SHOW_ROOT ? cell->root : cell->iterations;
+                line[col] = rampColor((v - lo) * scale);
+            }
+        }
+    }
+    SDL_UnlockTexture(texture);
+}
+
+// Open a cell in the tab of its method, if the suite has one
+static int sweepOpenCell(AppHost* host, const SweepGrid* grid, int col, int row) {
+    char a[32], b[32], c[32], x0[32], x1[32], form[32];
+    snprintf(a, sizeof(a), "%.6g", sweepCellA(grid, col));
+    snprintf(b, sizeof(b), "%.6g", sweepCellB(grid, row));
+    snprintf(c, sizeof(c), "%.6g", grid->problem.c);
+    snprintf(x0, sizeof(x0), "%.6g", grid->x0);
+    snprintf(x1, sizeof(x1), "%.6g", grid->x1);
+    snprintf(form, sizeof(form), "%d", grid->form);
+    
+    if (grid->problem.family == PROBLEM_QUADRATIC) {
+        if (grid->method != SOLVER_FIXED_POINT) return 0;
+        const char* values[] = {a, b, c, x0, form};
+        return appHostOpen(host, appHostFindTab(host, "Fixed Point"), values, 5);
+    }
+    
+    if (grid->method == SOLVER_FIXED_POINT) {
+        const char* values[] = {a, b, x0, form};
+        return appHostOpen(host, appHostFindTab(host, "Fixed Point e^x"), values, 4);
+    }
+    
+    const char* values[] = {a, b, x0, x1};
+    switch (grid->method) {
+        case SOLVER_SECANT:         return appHostOpen(host, appHostFindTab(host, "Secant"), values, 4);
+        case SOLVER_NEWTON:         return appHostOpen(host, appHostFindTab(host, "Newton-Raphson"), values, 3);
+        case SOLVER_FALSE_POSITION: return appHostOpen(host, appHostFindTab(host, "False Position"), values, 4);
+        default:                    return appHostOpen(host, appHostFindTab(host, "Race"), values, 4);
+    }
+}
+
+// Render text with UTF-8 support
+// (the draw list frees the texture once the frame is submitted)
+static void renderText(DrawList* draw, TTF_Font* font, const char* text, int x, int y, SDL_Color color) {
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, color);
+    if (!surface) return;
+    
+    SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+    SDL_Rect rect = {x, y, surface->w, surface->h};
+    drawListTexture(draw, texture, NULL, &rect, 1);
+    
+    SDL_FreeSurface(surface);
+}
+
+// Render input box with label and value
+static void renderInputBox(DrawList* draw, TTF_Font* font, InputBox* box) {
+    SDL_Color fill;
+    if (box->active) {
+        fill = (SDL_Color){220, 232, 250, 255};
+    } else {
+        fill = (SDL_Color){240, 245, 252, 255};
+    }
+    drawListFillRect(draw, &box->rect, fill);
+    
+    drawListRect(draw, &box->rect, (SDL_Color){50, 90, 150, 255});
+    
+    renderText(draw, font, box->label, box->rect.x - 80, box->rect.y + 5, (SDL_Color){30, 60, 110, 255});
+    if (strlen(box->value) > 0) {
+        renderText(draw, font, box->value, box->rect.x + 5, box->rect.y + 5, (SDL_Color){20, 40, 80, 255});
+    }
+}
+
+// Render button with hover and click effects
+static void renderButton(DrawList* draw, TTF_Font* font, Button* btn) {
+    SDL_Color fill;
+    if (btn->clicked) {
+        fill = (SDL_Color){20, 50, 100, 255};
+    } else if (btn->hovered) {
+        fill = (SDL_Color){60, 100, 170, 255};
+    } else {
+        fill = (SDL_Color){40, 80, 140, 255};
+    }
+    drawListFillRect(draw, &btn->rect, fill);
+    
+    drawListRect(draw, &btn->rect, (SDL_Color){20, 40, 80, 255});
+    
+    SDL_Surface* surface = TTF_RenderText_Blended(font, btn->text, (SDL_Color){255, 255, 255, 255});
+    if (surface) {
+        int textX = btn->rect.x + (btn->rect.w - surface->w) / 2;
+        int textY = btn->rect.y + (btn->rect.h - surface->h) / 2;
+        SDL_Texture* texture = hudCreateTextureFromSurface(draw->renderer, surface);
+        SDL_Rect rect = {textX, textY, surface->w, surface->h};
+        drawListTexture(draw, texture, NULL, &rect, 1);
+        SDL_FreeSurface(surface);
+    }
+}
+
+static int insideRect(const SDL_Rect* r, int x, int y) {
+    return x >= r->x && x <= r->x + r->w && y >= r->y && y <= r->y + r->h;
+}
+
+// Grid cell under a point of the heatmap; returns 0 outside it
+static int cellAt(const SweepGrid* grid, const SDL_Rect* map, int x, int y, int* col, int* row) {
+    if (!grid || x < map->x || x >= map->x + map->w || y < map->y || y >= map->y + map->h) return 0;
+    *col = (x - map->x) * grid->cols / map->w;
+    *row = grid->rows - 1 - (y - map->y) * grid->rows / map->h;
+    return 1;
+}
+
+static void setDefaults(InputBox* inputs) {
+    const char* defaults[SWEEP_INPUTS] = {"0.5", "5", "-2", "4", "-4", "0", "1", "500"};
+    for (int i = 0; i < SWEEP_INPUTS; i++) {
+        strcpy(inputs[i].value, defaults[i]);
+    }
+}
+
+static void sweepStateFree(void* state) {
+    SweepState* saved = state;
+    sweepGridRelease(saved->grid);
+}
+
+int sweepRun(AppHost* host) {
+    SDL_Renderer* renderer = host->renderer;
+    DrawList* draw = &host->draw;
+    
+    // Load fonts
+    TTF_Font* font = appHostFont(host, 18);
+    TTF_Font* fontSmall = appHostFont(host, 14);
+    TTF_Font* fontMedium = appHostFont(host, 16);
+    TTF_Font* fontTitle = appHostFont(host, 24);
+    
+    SweepState* saved = appHostTabState(host, sizeof(SweepState), sweepStateFree);
+    if (!font || !fontSmall || !fontMedium || !fontTitle || !saved) {
+        return 1;
+    }
+    
+    // Grid bounds, the quadratic's c, starting guesses and cells per side
+    InputBox inputs[SWEEP_INPUTS];
+    const char* labels[] = {"a min:", "a max:", "b min:", "b max:", "c:", "x0:", "x1:", "cells:"};
+    for (int i = 0; i < SWEEP_INPUTS; i++) {
+        inputs[i].rect = (SDL_Rect){110, 90 + i * 42, 150, 32};
+        strcpy(inputs[i].label, labels[i]);
+        inputs[i].active = 0;
+    }
+    setDefaults(inputs);
+    
+    // Choices cycled by clicking
+    int family = PROBLEM_EXPONENTIAL;
+    int method = SOLVER_SECANT;
+    int form = 1;
+    int show = SHOW_ROOT;
+    Button familyBtn = {{30, 435, 250, 32}, "", 0, 0};
+    Button methodBtn = {{30, 473, 250, 32}, "", 0, 0};
+    Button formBtn = {{30, 511, 250, 32}, "", 0, 0};
+    Button showBtn = {{30, 549, 250, 32}, "", 0, 0};
+    Button sweepBtn = {{30, 595, 120, 40}, "SWEEP", 0, 0};
+    Button clearBtn = {{170, 595, 120, 40}, "CLEAR", 0, 0};
+    Button* buttons[] = {&familyBtn, &methodBtn, &formBtn, &showBtn, &sweepBtn, &clearBtn};
+    
+    SDL_Rect map = {390, 85, 680, 680};
+    
+    // Every cell is solved with this tab's stop rules (F6)
+    SweepGrid* grid = NULL;
+    appHostUseStopRules(host);
+    SDL_Texture* heatmap = NULL;
+    int texCols = 0, texRows = 0;
+    int heatmapDirty = 0;
+    double rangeLo = 0, rangeHi = 1;
+    Uint32 sweepStart = 0, sweepMs = 0, lastUpload = 0;
+    int running = 0;
+    int mouseX = -1, mouseY = -1;
+    
+    char statusText[300] = "Set the grid and press SWEEP.\nClick a cell to open it in its method's tab.";
+    int activeInput = -1;
+    int quit = 0;
+    
+    // Back on this tab, e.g. after opening a cell: the grid as it was left
+    if (saved->saved) {
+        for (int i = 0; i < SWEEP_INPUTS; i++) {
+            strcpy(inputs[i].value, saved->values[i]);
+        }
+        family = saved->family;
+        method = saved->method;
+        form = saved->form;
+        show = saved->show;
+        grid = saved->grid;
+        saved->grid = NULL;
+        heatmapDirty = 1;
+        strcpy(statusText, saved->statusText);
+    }
+    
+    // Frame timing overlay, toggled with F3
+    FrameHud hud;
+    hudInit(&hud);
+    SDL_Event e;
+    
+    while (!quit && !appHostSwitching(host)) {
+        hudBeginFrame(&hud);
+        
+        while (appHostPollEvent(host, &e)) {
+            if (appHostEvent(host, &e)) continue;
+            if (e.type == SDL_QUIT) quit = 1;
+            
+            if (e.type == SDL_MOUSEBUTTONDOWN) {
+                int mx = e.button.x;
+                int my = e.button.y;
+                
+                activeInput = -1;
+                for (int i = 0; i < SWEEP_INPUTS; i++) {
+                    if (insideRect(&inputs[i].rect, mx, my)) activeInput = i;
+                    inputs[i].active = (i == activeInput);
+                }
+                
+                if (insideRect(&familyBtn.rect, mx, my)) {
+                    familyBtn.clicked = 1;
+                    family = family == PROBLEM_EXPONENTIAL ? PROBLEM_QUADRATIC : PROBLEM_EXPONENTIAL;
+                }
+                if (insideRect(&methodBtn.rect, mx, my)) {
+                    methodBtn.clicked = 1;
+                    method = (method + 1) % 4;
+                }
+                if (insideRect(&formBtn.rect, mx, my)) {
+                    formBtn.clicked = 1;
+                    form = form % 5 + 1;
+                }
+                if (insideRect(&showBtn.rect, mx, my)) {
+                    showBtn.clicked = 1;
+                    show = (show + 1) % SHOW_COUNT;
+                    heatmapDirty = 1;
+                }
+                
+                int onSweep = insideRect(&sweepBtn.rect, mx, my);
+                int onClear = insideRect(&clearBtn.rect, mx, my);
+                
+                // A new sweep, CANCEL and CLEAR all drop the running one;
+                // its workers stop after their current chunk
+                if ((onSweep || onClear) && grid) {
+                    if (running) sweepGridCancel(grid);
+                    if (onClear || !running) {
+                        sweepGridRelease(grid);
+                        grid = NULL;
+                    }
+                }
+                
+                if (onSweep) {
+                    sweepBtn.clicked = 1;
+                    if (running) {
+                        running = 0;
+                        heatmapDirty = 1;
+                        strcpy(sweepBtn.text, "SWEEP");
+                        sprintf(statusText, "Sweep cancelled at %d of %d cells.",
+                                SDL_AtomicGet(&grid->done), grid->cols * grid->rows);
+                    } else {
+                        int side = atoi(inputs[7].value);
+                        grid = sweepGridCreate(side, side);
+                        if (!grid) {
+                            strcpy(statusText, "Not enough memory for the grid.");
+                        } else {
+                            grid->problem = (RootProblem){family, 0, 0, atof(inputs[4].value)};
+                            grid->method = method;
+                            grid->form = form;
+                            grid->x0 = atof(inputs[5].value);
+                            grid->x1 = atof(inputs[6].value);
+                            grid->stop = solverDefaultStop(method, TOLERANCE, MAX_ITER);
+                            stopPolicyParse(&grid->stop, appHostStopSpec(host));
+                            grid->aMin = atof(inputs[0].value);
+                            grid->aMax = atof(inputs[1].value);
+                            grid->bMin = atof(inputs[2].value);
+                            grid->bMax = atof(inputs[3].value);
+                            
+                            if (sweepGridStart(grid, &host->pool) == 0) {
+                                strcpy(statusText, "Could not start the sweep workers.");
+                            } else {
+                                running = 1;
+                                sweepStart = SDL_GetTicks();
+                                lastUpload = 0;
+                                strcpy(sweepBtn.text, "CANCEL");
+                                strcpy(statusText, "Sweeping...");
+                            }
+                        }
+                    }
+                }
+                
+                if (onClear) {
+                    clearBtn.clicked = 1;
+                    running = 0;
+                    strcpy(sweepBtn.text, "SWEEP");
+                    setDefaults(inputs);
+                    strcpy(statusText, "Set the grid and press SWEEP.\nClick a cell to open it in its method's tab.");
+                }
+                
+                // Open the clicked cell
+                int col, row;
+                if (!running && cellAt(grid, &map, mx, my, &col, &row)) {
+                    if (!sweepOpenCell(host, grid, col, row)) {
+                        sprintf(statusText, "No single-solve view for %s on this family\nin this build.",
+                                methodNames[grid->method]);
+                    }
+                }
+            }
+            
+            if (e.type == SDL_MOUSEBUTTONUP) {
+                for (int i = 0; i < 6; i++) buttons[i]->clicked = 0;
+            }
+            
+            if (e.type == SDL_MOUSEMOTION) {
+                int mx = e.motion.x;
+                int my = e.motion.y;
+                for (int i = 0; i < 6; i++) buttons[i]->hovered = insideRect(&buttons[i]->rect, mx, my);
+                mouseX = mx;
+                mouseY = my;
+            }
+            
+            if (e.type == SDL_TEXTINPUT && activeInput >= 0) {
+                char c = e.text.text[0];
+                if ((c >= '0' && c <= '9') || c == '.' || c == '-') {
+                    int len = strlen(inputs[activeInput].value);
+                    if (len < 19) {
+                        inputs[activeInput].value[len] = c;
+                        inputs[activeInput].value[len + 1] = '\0';
+                    }
+                }
+            }
+            
+            if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F3) {
+                hudToggle(&hud);
+            }
+            
+            if (e.type == SDL_KEYDOWN && activeInput >= 0 && e.key.keysym.sym == SDLK_BACKSPACE) {
+                int len = strlen(inputs[activeInput].value);
+                if (len > 0) inputs[activeInput].value[len - 1] = '\0';
+            }
+        }
+        
+        sprintf(familyBtn.text, "Family: %s", family == PROBLEM_EXPONENTIAL ? "e^x - ax - b" : "ax^2 + bx + c");
+        sprintf(methodBtn.text, "Method: %s", methodNames[method]);
+        sprintf(formBtn.text, "Fixed point form: g%d", form);
+        sprintf(showBtn.text, "Show: %s", showNames[show]);
+        
+        hudPhase(&hud, HUD_SOLVE);
+        
+        if (running) {
+            int done = SDL_AtomicGet(&grid->done);
+            int total = grid->cols * grid->rows;
+            if (!sweepGridRunning(grid)) {
+                running = 0;
+                heatmapDirty = 1;
+                sweepMs = SDL_GetTicks() - sweepStart;
+                strcpy(sweepBtn.text, "SWEEP");
+                sprintf(statusText, "%d cells in %.2f s (%.0f cells/s)\n%d workers, %d steals",
+                        total, sweepMs / 1000.0, sweepMs ? total * 1000.0 / sweepMs : 0.0,
+                        grid->workerCount, SDL_AtomicGet(&grid->steals));
+            } else {
+                sprintf(statusText, "Sweeping... %d of %d cells (%.0f%%)", done, total, 100.0 * done / total);
+                if (SDL_GetTicks() - lastUpload >= SWEEP_UPLOAD_MS) heatmapDirty = 1;
+            }
+        }
+        
+        // Refresh the heatmap texture, recreating it when the grid size changed
+        if (grid && heatmapDirty) {
+            if (!heatmap || texCols != grid->cols || texRows != grid->rows) {
+                if (heatmap) SDL_DestroyTexture(heatmap);
+                heatmap = hudCreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                            grid->cols, grid->rows);
+                texCols = grid->cols;
+                texRows = grid->rows;
+            }
+            if (heatmap) {
+                TRACE_SCOPE("sweepUpload") {
+                    sweepRange(grid, show, &rangeLo, &rangeHi);
+                    sweepUpload(heatmap, grid, show, rangeLo, rangeHi);
+                }
+            }
+            heatmapDirty = 0;
+            lastUpload = SDL_GetTicks();
+        }
+        
+        int hoverCol, hoverRow;
+        int hovering = cellAt(grid, &map, mouseX, mouseY, &hoverCol, &hoverRow);
+        
+        // ==================== RENDER ====================
+        hudPhase(&hud, HUD_TEXT);
+        SDL_SetRenderDrawColor(renderer, 240, 244, 250, 255);
+        hudRenderClear(renderer);
+        
+        SDL_Rect banner = {0, 0, WINDOW_WIDTH, 70};
+        drawListFillRect(draw, &banner, (SDL_Color){30, 60, 110, 255});
+        renderText(draw, fontTitle, "PARAMETER SWEEP", 30, 10, (SDL_Color){255, 255, 255, 255});
+        renderText(draw, fontMedium, family == PROBLEM_EXPONENTIAL
+                       ? "One solve of e^x - ax - b = 0 per (a, b) cell"
+                       : "One solve of ax^2 + bx + c = 0 per (a, b) cell, c fixed",
+                   30, 42, (SDL_Color){200, 220, 255, 255});
+        
+        SDL_Color sectionColor = {30, 60, 110, 255};
+        SDL_Color hintColor = {90, 100, 120, 255};
+        
+        for (int i = 0; i < SWEEP_INPUTS; i++) {
+            renderInputBox(draw, font, &inputs[i]);
+        }
+        for (int i = 0; i < 6; i++) {
+            renderButton(draw, i < 4 ? fontSmall : font, buttons[i]);
+        }
+        
+        char statusCopy[300];
+        strcpy(statusCopy, statusText);
+        char* line = strtok(statusCopy, "\n");
+        int sy = 650;
+        while (line) {
+            renderText(draw, fontSmall, line, 30, sy, (SDL_Color){60, 60, 80, 255});
+            sy += 20;
+            line = strtok(NULL, "\n");
+        }
+        
+        // Heatmap with its coefficient ranges along the edges
+        hudPhase(&hud, HUD_GRAPH);
+        drawListFillRect(draw, &map, (SDL_Color){255, 255, 255, 255});
+        if (grid && heatmap) {
+            drawListTexture(draw, heatmap, NULL, &map, 0);
+            
+            char label[48];
+            sprintf(label, "a = %.4g", grid->aMin);
+            renderText(draw, fontSmall, label, map.x, map.y + map.h + 4, hintColor);
+            sprintf(label, "a = %.4g", grid->aMax);
+            renderText(draw, fontSmall, label, map.x + map.w - 80, map.y + map.h + 4, hintColor);
+            sprintf(label, "b = %.4g", grid->bMax);
+            renderText(draw, fontSmall, label, map.x - 85, map.y, hintColor);
+            sprintf(label, "b = %.4g", grid->bMin);
+            renderText(draw, fontSmall, label, map.x - 85, map.y + map.h - 18, hintColor);
+            
+            if (hovering) {
+                int x0 = map.x + hoverCol * map.w / grid->cols;
+                int x1 = map.x + (hoverCol + 1) * map.w / grid->cols;
+                int y0 = map.y + (grid->rows - 1 - hoverRow) * map.h / grid->rows;
+                int y1 = map.y + (grid->rows - hoverRow) * map.h / grid->rows;
+                SDL_Rect mark = {x0 - 2, y0 - 2, x1 - x0 + 4, y1 - y0 + 4};
+                drawListRect(draw, &mark, (SDL_Color){255, 255, 255, 255});
+            }
+        }
+        drawListRect(draw, &map, (SDL_Color){50, 90, 150, 255});
+        hudPhase(&hud, HUD_TEXT);
+        
+        // Legend: a color ramp with its range, or the outcome colors
+        int lx = map.x + map.w + 40;
+        renderText(draw, font, showNames[show], lx, 90, sectionColor);
+        if (show == SHOW_STATUS) {
+            int y = 125;
+            for (int i = SWEEP_CONVERGED; i < OUTCOME_COLORS; i++) {
+                if (i == SWEEP_FAILED_BASE) continue;   // every failure has a code
+                SDL_Color c = outcomeColors[i];
+                SDL_Rect key = {lx, y + 2, 16, 16};
+                drawListFillRect(draw, &key, (SDL_Color){c.r, c.g, c.b, 255});
+                const char* name = i == SWEEP_CONVERGED ? "Converged" : solverFailureName(i - SWEEP_FAILED_BASE);
+                renderText(draw, fontSmall, name, lx + 26, y, hintColor);
+                y += 26;
+            }
+        } else {
+            for (int y = 0; y < 300; y++) {
+                Uint32 c = rampColor(1.0 - y / 299.0);
+                drawListLine(draw, lx, 125 + y, lx + 30, 125 + y, (SDL_Color){(c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF, 255});
+            }
+            char label[32];
+            sprintf(label, "%.4g", rangeHi);
+            renderText(draw, fontSmall, label, lx + 40, 120, hintColor);
+            sprintf(label, "%.4g", rangeLo);
+            renderText(draw, fontSmall, label, lx + 40, 412, hintColor);
+            SDL_Color failed = outcomeColors[SWEEP_FAILED_BASE];
+            SDL_Rect key = {lx, 445, 30, 16};
+            drawListFillRect(draw, &key, (SDL_Color){failed.r, failed.g, failed.b, 255});
+            renderText(draw, fontSmall, "Failed", lx + 40, 443, hintColor);
+        }
+        
+        // Cell under the mouse
+        if (hovering) {
+            const SweepCell* cell = &grid->cells[hoverRow * grid->cols + hoverCol];
+            char info[64];
+            renderText(draw, font, "CELL", lx, 500, sectionColor);
+            sprintf(info, "a = %.6g", sweepCellA(grid, hoverCol));
+            renderText(draw, fontSmall, info, lx, 530, hintColor);
+            sprintf(info, "b = %.6g", sweepCellB(grid, hoverRow));
+            renderText(draw, fontSmall, info, lx, 550, hintColor);
+            if (cell->outcome == SWEEP_CONVERGED) {
+                sprintf(info, "Root: x = %.6f", cell->root);
+            } else if (cell->outcome == SWEEP_PENDING) {
+                strcpy(info, "Pending");
+            } else {
+                sprintf(info, "%s", solverFailureName(cell->outcome - SWEEP_FAILED_BASE));
+            }
+            renderText(draw, fontSmall, info, lx, 570, hintColor);
+            sprintf(info, "Iterations: %d", cell->iterations);
+            renderText(draw, fontSmall, info, lx, 590, hintColor);
+        }
+        
+        appHostRenderTabs(host);
+        hudRender(renderer, fontSmall, &hud, WINDOW_WIDTH - 270, 10);
+        
+        hudPhase(&hud, HUD_PRESENT);
+        TRACE_SCOPE("SDL_RenderPresent") {
+            SDL_RenderPresent(renderer);
+        }
+        hudPhase(&hud, HUD_IDLE);
+        appHostEndFrame(host);
+    }
+    
+    // A sweep still running is cancelled; the cells it finished stay on the
+    // map for the next visit
+    if (running) {
+        sweepGridCancel(grid);
+        sprintf(statusText, "Sweep cancelled at %d of %d cells.",
+                SDL_AtomicGet(&grid->done), grid->cols * grid->rows);
+    }
+    if (heatmap) SDL_DestroyTexture(heatmap);
+    
+    for (int i = 0; i < SWEEP_INPUTS; i++) {
+        strcpy(saved->values[i], inputs[i].value);
+    }
+    saved->family = family;
+    saved->method = method;
+    saved->form = form;
+    saved->show = show;
+    saved->grid = grid;
+    strcpy(saved->statusText, statusText);
+    saved->saved = 1;
+    
+    return 0;
+}
+
+#ifndef METHODS_SUITE
+int main(int argc, char* argv[]) {
+    AppHost host;
+    if (appHostInit(&host, "Parameter Sweep", WINDOW_WIDTH, WINDOW_HEIGHT, NULL, 0) != 0) {
+        return 1;
+    }
+    
+    int result = sweepRun(&host);
+    
+    appHostFree(&host);
+    return result;
+}
+#endif
@@ -0,0 +1,123 @@
+#ifndef TRACE_EVENTS_H
+#define TRACE_EVENTS_H
+
+// Scoped trace probes written as Chrome trace-event JSON.
+// Build with -DTRACE_EVENTS to enable them; otherwise every macro below
+// expands to nothing. Open the resulting file in chrome://tracing or
+// ui.perfetto.dev.
+//
+//     TRACE_INIT("trace.json");           // once, after SDL_Init
+//     TRACE_SCOPE("drawGraph") {
+//         drawGraph(...);
+//     }
+//     TRACE_SHUTDOWN();                   // writes the file
+//
+// The app host does the init and shutdown, so the GUIs only add scopes.
+// A TRACE_SCOPE body must not break/continue out of an enclosing loop or
+// return, since the end of the scope would then never be recorded.
+//
+// The event buffer is shared by every translation unit of a program and
+// defined in exactly one: the one that defines TRACE_EVENTS_IMPLEMENTATION
+// before including this header (again, if it was already included).
+
+#ifdef TRACE_EVENTS
+
+#include <SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TRACE_MAX_EVENTS (1 << 18)
+
+typedef struct {
+    const char* name;
+    Uint64 start;
+    Uint64 end;
+    unsigned long tid;
+} TraceEvent;
+
+extern TraceEvent* traceEvents;
+extern SDL_atomic_t traceCount;
+extern Uint64 traceOrigin;
+extern double traceUsPerTick;
+extern const char* tracePath;
+
+static inline void traceInit(const char* path) {
+    traceEvents = malloc(sizeof(TraceEvent) * TRACE_MAX_EVENTS);
+    SDL_AtomicSet(&traceCount, 0);
+    traceOrigin = SDL_GetPerformanceCounter();
+    traceUsPerTick = 1000000.0 / (double)SDL_GetPerformanceFrequency();
+    tracePath = path;
+}
+
+static inline Uint64 traceBegin(void) {
+    return SDL_GetPerformanceCounter();
+}
+
+// Record a complete event; events past the buffer capacity are dropped
+static inline void traceEnd(const char* name, Uint64 start) {
+    if (!traceEvents) return;
+    int index = SDL_AtomicAdd(&traceCount, 1);
+    if (index >= TRACE_MAX_EVENTS) return;
+
+    TraceEvent* ev = &traceEvents[index];
+    ev->name = name;
+    ev->start = start;
+    ev->end = SDL_GetPerformanceCounter();
+    ev->tid = SDL_ThreadID();
+}
+
+// Write the JSON file; call once all traced threads have stopped
+static inline void traceShutdown(void) {
+    if (!traceEvents) return;
+
+    int count = SDL_AtomicGet(&traceCount);
+    if (count > TRACE_MAX_EVENTS) count = TRACE_MAX_EVENTS;
+
+    FILE* file = fopen(tracePath, "w");
+    if (file) {
+        fprintf(file, "{\"traceEvents\":[\n");
+        for (int i = 0; i < count; i++) {
+            TraceEvent* ev = &traceEvents[i];
+            fprintf(file, "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+                    ev->name, ev->tid,
+                    (double)(ev->start - traceOrigin) * traceUsPerTick,
+                    (double)(ev->end - ev->start) * traceUsPerTick,
+                    i + 1 < count ? "," : "");
+        }
+        fprintf(file, "],\"displayTimeUnit\":\"ms\"}\n");
+        fclose(file);
+    }
+
+    free(traceEvents);
+    traceEvents = NULL;
+}
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name) \
+    for (Uint64 TRACE_CONCAT(traceStart, __LINE__) = traceBegin(), TRACE_CONCAT(traceOnce, __LINE__) = 1; \
+         TRACE_CONCAT(traceOnce, __LINE__); \
+         TRACE_CONCAT(traceOnce, __LINE__) = 0, traceEnd(name, TRACE_CONCAT(traceStart, __LINE__)))
+#define TRACE_INIT(path) traceInit(path)
+#define TRACE_SHUTDOWN() traceShutdown()
+
+#else
+
+#define TRACE_SCOPE(name)
+#define TRACE_INIT(path)
+#define TRACE_SHUTDOWN()
+
+#endif
+
+#endif
+
+#if defined(TRACE_EVENTS) && defined(TRACE_EVENTS_IMPLEMENTATION) && !defined(TRACE_EVENTS_IMPLEMENTED)
+#define TRACE_EVENTS_IMPLEMENTED
+
+TraceEvent* traceEvents;
+SDL_atomic_t traceCount;
+Uint64 traceOrigin;
+double traceUsPerTick;
+const char* tracePath;
+
+#endif